@@ -418,6 +418,34 @@ public:
 
     std::string toYamlString() const;
 
+    //! Create an AnyMap from a binary file written using toBinaryString().
+    /*!
+     *  The file is located in the same way as for fromYamlFile(). If the map
+     *  contains the hidden `__source__` entry with the name and checksum of the
+     *  YAML file it was created from, and that file still exists, an exception
+     *  is thrown if the checksum of that file has changed, as this indicates
+     *  that the binary file is out of date. The same check is applied to the
+     *  files from which the source imports elements, species or reactions.
+     *  Line numbers in error messages refer to the YAML source file.
+     */
+    static AnyMap fromBinaryFile(const std::string& name,
+                                 const std::string& parent_name="");
+
+    //! Create an AnyMap from a string containing the binary representation
+    //! written by toBinaryString()
+    static AnyMap fromBinaryString(const std::string& data);
+
+    //! Compact binary representation of this AnyMap, including hidden keys,
+    //! which can be read without the overhead of parsing YAML. Line and column
+    //! information is retained, so the ordering of fields when writing the
+    //! map to YAML is preserved. The representation is specific to the byte
+    //! order and floating point format of the machine that created it.
+    std::string toBinaryString() const;
+
+    //! Checksum of the contents of a file, as used to identify the source of
+    //! a binary file. See fromBinaryFile().
+    static std::string fileChecksum(const std::string& filename);
+
     //! Get the value of the item stored in `key`.
     AnyValue& operator[](const std::string& key);
     const AnyValue& operator[](const std::string& key) const;
@@ -666,6 +694,24 @@ public:
     static void clearCachedFile(const std::string& filename);
 
 private:
+    //! Append the binary representation of this map to `out`
+    void writeBinary(std::string& out) const;
+
+    //! Append the binary representation of `value` to `out`
+    static void writeBinary(std::string& out, const AnyValue& value);
+
+    //! Read the contents of this map from binary data starting at `pos`, which
+    //! is advanced to the end of the data read. `end` is the end of the
+    //! binary data.
+    void readBinary(const char*& pos, const char* end);
+
+    //! Read the contents of `value` from binary data starting at `pos`
+    static void readBinary(const char*& pos, const char* end, AnyValue& value);
+
+    //! Find the full path to the input file `name`, see fromYamlFile()
+    static std::string findFile(const std::string& name,
+                                const std::string& parent_name);
+
     //! The stored data
     std::unordered_map<std::string, AnyValue> m_data;
 
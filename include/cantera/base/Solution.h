@@ -87,6 +87,9 @@ protected:
  * This constructor wraps newPhase(), newKinetics() and
  * newTransportMgr() routines for initialization.
  *
+ * Input files can be YAML files, binary files created using
+ * compileMechanism() (with the extension `.ctb`), or legacy CTI/XML files.
+ *
  * @param infile name of the input file
  * @param name   name of the phase in the file.
  *               If this is blank, the first phase in the file is used.
@@ -117,6 +120,33 @@ shared_ptr<Solution> newSolution(AnyMap& phaseNode,
                                  const std::string& transport="",
                                  const std::vector<shared_ptr<Solution>>& adjacent={});
 
+//! Create a binary file from a YAML input file, which can be loaded using
+//! newSolution() much faster than the YAML file itself.
+/*!
+ * The binary file contains the input data of the YAML file, including units
+ * declarations and line numbers of all entries. Parsing of the YAML file is
+ * thus avoided when the binary file is loaded. In addition, for phases that
+ * specify a gas transport model, polynomial fits of transport properties and
+ * collision integrals are stored, so the (typically dominant) cost of fitting
+ * these properties is avoided when creating transport managers for the same
+ * models. Species and reactions imported from other files are still read from
+ * these YAML files when the binary file is loaded.
+ *
+ * The binary file records the names and checksums of the YAML file and of
+ * all files from which its phases import elements, species or reactions, and
+ * loading it throws an exception if any of these files has changed since. The
+ * binary file is specific to the byte order and floating point format of the
+ * machine that created it.
+ *
+ * @param infile  Name of the YAML input file
+ * @param outfile  Name of the binary file, which should use the extension
+ *     `.ctb` to be recognized by newSolution()
+ * @param transport  Transport models for which fits are stored in addition to
+ *     the default transport model of each phase, for example "multicomponent"
+ */
+void compileMechanism(const std::string& infile, const std::string& outfile,
+                      const std::vector<std::string>& transport={});
+
 }
 
 #endif
@@ -282,6 +282,17 @@ public:
         return m_A * std::exp(m_b * shared_data.logT - Ea_R * shared_data.recipT);
     }
 
+    //! Evaluate derivative of reaction rate with respect to temperature
+    //! at constant enthalpy of reaction
+    /*!
+     *  @param shared_data  data shared by all reactions of a given type
+     */
+    double ddTFromStruct(const BlowersMaselData& shared_data) const {
+        double Ea_R = activationEnergy_R(m_deltaH_R);
+        return m_A * (m_b + Ea_R * shared_data.recipT) *
+            std::exp((m_b - 1) * shared_data.logT - Ea_R * shared_data.recipT);
+    }
+
     //! Return the actual activation energy (a function of the delta H of reaction)
     //! divided by the gas constant (i.e. the activation temperature) [K]
     double activationEnergy_R(double deltaH_R) const {
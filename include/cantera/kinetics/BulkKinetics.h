@@ -58,6 +58,9 @@ protected:
     std::vector<unique_ptr<MultiRateBase>> m_bulk_rates;
     std::map<std::string, size_t> m_bulk_types; //!< Mapping of rate handlers
 
+    //! Instrumentation section of each rate handler
+    std::vector<size_t> m_bulk_sections;
+
     Rate1<Arrhenius> m_rates; //!< @deprecated (legacy only)
     std::vector<size_t> m_revindex; //!< Indices of reversible reactions
     std::vector<size_t> m_irrev; //!< Indices of irreversible reactions
@@ -67,6 +70,12 @@ protected:
     //! valued stoichiometries.
     vector_fp m_dn;
 
+    //! Third-body efficiencies of all reactions with third bodies
+    ThirdBodyEfficiencies m_efficiencies;
+
+    //! Effective third-body concentrations of all rows of #m_efficiencies
+    vector_fp m_concm_rows;
+
     ThirdBodyCalc3 m_multi_concm; //!< used with MultiRate evaluator
 
     //! Third body concentrations
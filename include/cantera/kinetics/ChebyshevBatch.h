@@ -0,0 +1,103 @@
+/**
+ * @file ChebyshevBatch.h
+ * Batched evaluation of Chebyshev rate constants
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_CHEBYSHEVBATCH_H
+#define CT_CHEBYSHEVBATCH_H
+
+#include "cantera/base/Array.h"
+
+namespace Cantera
+{
+
+struct ChebyshevData;
+class ChebyshevRate3;
+
+//! Batched evaluation of rate constants of Chebyshev reactions.
+/*!
+ * Reactions are grouped by the dimensions of their coefficient matrices and by
+ * their temperature and pressure ranges, such that all reactions of a group
+ * share the same Chebyshev polynomials of the reduced temperature and
+ * pressure, which are evaluated once per group. Coefficients of a group are
+ * packed with the reaction index varying fastest, and \f$ \log k \f$ of all
+ * reactions is obtained by two matrix-vector products: a contraction with the
+ * pressure polynomials, which is retained until the pressure changes, and a
+ * contraction with the temperature polynomials. The inner loops run over
+ * reactions and are vectorized by the compiler, while the order of
+ * operations for each reaction is the same as in ChebyshevRate3, which yields
+ * identical results.
+ * @ingroup chemkinetics
+ */
+class ChebyshevBatch
+{
+public:
+    ChebyshevBatch();
+
+    //! Discard all reactions
+    void clear();
+
+    //! Add a Chebyshev reaction
+    void add(size_t rxn, const ChebyshevRate3& rate);
+
+    //! Evaluate rate constants of all reactions.
+    /*!
+     * @param data  Shared data of the Chebyshev reactions
+     * @param kf  Rate constants, where values are written at the positions of
+     *     the reaction indices
+     * @returns `true`, as batched evaluation is always possible
+     */
+    bool getRateConstants(const ChebyshevData& data, double* kf);
+
+    //! Number of groups of reactions sharing Chebyshev polynomials
+    size_t nGroups() const {
+        return m_groups.size();
+    }
+
+protected:
+    //! Reactions sharing dimensions and ranges of their Chebyshev fits
+    struct Group
+    {
+        size_t nT, nP; //!< Number of coefficients for temperature and pressure
+        double Tmin, Tmax, Pmin, Pmax; //!< Valid temperature and pressure range
+        std::vector<size_t> rxn; //!< Reaction indices
+        std::vector<Array2D> data; //!< Coefficient arrays of all reactions
+
+        //! Packed coefficients, where the coefficient (t, p) of reaction `i` is
+        //! located at `(t * nP + p) * rxn.size() + i`
+        vector_fp coeffs;
+
+        //! Contraction of the coefficients with the pressure polynomials, where
+        //! the entry for degree `t` of reaction `i` is located at
+        //! `t * rxn.size() + i`
+        vector_fp dotProd;
+
+        vector_fp k; //!< Rate constants
+    };
+
+    //! Pack coefficients of all groups into contiguous arrays
+    void pack();
+
+    //! Update contractions with the pressure polynomials
+    void updatePressure(double log10P);
+
+    //! Update rate constants for a new temperature
+    void updateTemperature(double recipT);
+
+    //! Evaluate Chebyshev polynomials of degree 0 to `n-1` at `x`
+    static void polynomials(double x, size_t n, vector_fp& phi);
+
+    std::vector<Group> m_groups;
+    bool m_packed; //!< `true` if the packed coefficients are current
+
+    double m_recipT; //!< Inverse temperature of the cached rate constants
+    double m_log10P; //!< Pressure of the cached contractions
+    vector_fp m_phi; //!< Work array for Chebyshev polynomials
+};
+
+}
+
+#endif
@@ -0,0 +1,257 @@
+/**
+ * @file DirectedRelationGraph.h
+ * Mechanism reduction using the directed relation graph method
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_DIRECTEDRELATIONGRAPH_H
+#define CT_DIRECTEDRELATIONGRAPH_H
+
+#include "cantera/base/ct_defs.h"
+#include <functional>
+
+namespace Cantera
+{
+
+class Solution;
+class ThermoPhase;
+class Kinetics;
+
+//! Graph of species interactions through reactions, which is the basis of the
+//! directed relation graph methods.
+/*!
+ * Species participating in the same reaction, either as reactants, products or
+ * explicit collision partners, are connected by edges. For given net rates of
+ * progress, evaluate() determines the edge weights and the resulting path
+ * coefficients of all species as described for DirectedRelationGraph.
+ * @ingroup chemkinetics
+ */
+class RelationGraph
+{
+public:
+    RelationGraph() {}
+
+    //! Set up the graph for the reactions of `kin`, which needs to be
+    //! associated with a single phase
+    void build(Kinetics& kin);
+
+    //! Number of species of the graph
+    size_t nSpecies() const {
+        return m_edgeStart.empty() ? 0 : m_edgeStart.size() - 1;
+    }
+
+    //! Number of reactions of the graph
+    size_t nReactions() const {
+        return m_spStart.empty() ? 0 : m_spStart.size() - 1;
+    }
+
+    //! Evaluate path coefficients from the target species
+    /*!
+     * @param ropnet  Net rates of progress of all reactions
+     * @param targets  Indices of the target species
+     * @param drg  If `true`, use the DRG definition of edge weights and path
+     *     coefficients; otherwise, use DRGEP
+     * @param R  Path coefficients of all species, which are one for targets
+     *     and zero for species that are not reachable
+     */
+    void evaluate(const double* ropnet, const std::vector<size_t>& targets,
+                  bool drg, double* R);
+
+    //! Find reactions for which all participating species are active
+    void getActiveReactions(const std::vector<bool>& speciesActive,
+                            std::vector<bool>& reactionActive) const;
+
+protected:
+    //! Adjacency of species in CSR format: edges starting at species `k` lead
+    //! to species `m_edgeTarget[e]` for `m_edgeStart[k] <= e < m_edgeStart[k+1]`
+    std::vector<size_t> m_edgeStart;
+    std::vector<size_t> m_edgeTarget;
+
+    //! Contributions to edge weights: reaction `i` contributes to edges
+    //! `m_rxnEdge[j]` using the net stoichiometric coefficient `m_rxnNu[j]` of
+    //! the starting species for `m_rxnStart[i] <= j < m_rxnStart[i+1]`
+    std::vector<size_t> m_rxnStart;
+    std::vector<size_t> m_rxnEdge;
+    vector_fp m_rxnNu;
+
+    //! Net stoichiometric coefficients of all species participating in each
+    //! reaction, stored in CSR format using `m_spStart`
+    std::vector<size_t> m_spStart;
+    std::vector<size_t> m_spIndex;
+    vector_fp m_spNu;
+
+    //! Work arrays
+    vector_fp m_num, m_prod, m_cons, m_weight;
+};
+
+//! Skeletal mechanism reduction using the directed relation graph (DRG)
+//! method or the directed relation graph with error propagation (DRGEP).
+/*!
+ * Species of a detailed mechanism are vertices of a graph, where the weight
+ * \f$ r_{AB} \f$ of the edge from species A to species B measures how much the
+ * production rate of A depends on reactions involving B. For DRG (Lu and Law,
+ * Proc. Combust. Inst. 30:1333-1341, 2005),
+ * \f[
+ *     r_{AB} = \frac{\sum_i |\nu_{A,i} \omega_i \delta_{B,i}|}
+ *                   {\sum_i |\nu_{A,i} \omega_i|},
+ * \f]
+ * while for DRGEP (Pepiot-Desjardins and Pitsch, Combust. Flame
+ * 154:67-81, 2008),
+ * \f[
+ *     r_{AB} = \frac{|\sum_i \nu_{A,i} \omega_i \delta_{B,i}|}
+ *                   {\max(P_A, C_A)},
+ * \f]
+ * where \f$ \omega_i \f$ is the net rate of progress of reaction i,
+ * \f$ \nu_{A,i} \f$ the net stoichiometric coefficient of A, \f$ \delta_{B,i}
+ * \f$ is one if B is a reactant or product of reaction i and zero otherwise,
+ * and \f$ P_A \f$ and \f$ C_A \f$ are the total production and consumption
+ * rates of A.
+ *
+ * The overall importance \f$ R_B \f$ of a species is found by a graph search
+ * starting at the target species. For DRG, it is the largest threshold for
+ * which B is reachable from a target using only edges whose weights are not
+ * smaller than the threshold. For DRGEP, it is the largest product of edge
+ * weights along any path from a target to B. The importance is the maximum
+ * over all sampled states, which is accumulated by addSample() without
+ * retaining the states themselves.
+ *
+ * A skeletal mechanism for a given threshold contains all species whose
+ * importance is not smaller than the threshold, together with the target
+ * species and any species that are to be retained unconditionally, and all
+ * reactions whose reactants and products are retained. The largest threshold
+ * that satisfies user-defined error tolerances on quantities such as ignition
+ * delay times or flame speeds can be found by findThreshold().
+ *
+ * States are sampled from phases with the same species as the detailed
+ * mechanism. Functions sampling the states of reactor network integrations
+ * and one-dimensional flames are provided by sampleReactor() and
+ * sampleFlame(), and ignitionDelay() can be used as an error metric.
+ *
+ * Example:
+ *
+ * @code
+ *     auto gas = newSolution("gri30.yaml", "gri30", "None");
+ *     DirectedRelationGraph drg(gas, "DRGEP");
+ *     drg.setTargets({"CH4", "O2"});
+ *     drg.setRetainedSpecies({"N2"});
+ *     // ... sample states with addSample(), sampleReactor() or sampleFlame()
+ *     drg.addErrorTarget([](shared_ptr<Solution> soln) {
+ *         return ignitionDelay(soln, 1200, OneAtm, "CH4:1, O2:2, N2:7.52", 1.0);
+ *     }, 0.05);
+ *     double threshold = drg.findThreshold();
+ *     YamlWriter writer;
+ *     writer.addPhase(drg.reducedSolution(threshold));
+ *     writer.toYamlFile("reduced.yaml");
+ * @endcode
+ *
+ * @ingroup chemkinetics
+ */
+class DirectedRelationGraph
+{
+public:
+    //! Constructor
+    /*!
+     * @param soln  Solution holding the detailed mechanism. Its kinetics
+     *     manager needs to be associated with a single phase.
+     * @param method  Either "DRG" or "DRGEP"
+     */
+    DirectedRelationGraph(shared_ptr<Solution> soln,
+                          const std::string& method="DRGEP");
+
+    //! Method used to evaluate interaction coefficients
+    const std::string& method() const {
+        return m_method;
+    }
+
+    //! Set the target species, from which the graph search starts
+    void setTargets(const std::vector<std::string>& targets);
+
+    //! Set species that are retained irrespective of their importance, for
+    //! example inert bath gases
+    void setRetainedSpecies(const std::vector<std::string>& species);
+
+    //! Add the current state of the detailed mechanism as a sample
+    void addSample();
+
+    //! Add the state of `phase`, which needs to have the same species as the
+    //! detailed mechanism, as a sample
+    void addSample(const ThermoPhase& phase);
+
+    //! Number of states sampled so far
+    size_t nSamples() const {
+        return m_nSamples;
+    }
+
+    //! Discard all samples
+    void clearSamples();
+
+    //! Overall importance of each species, which is the maximum over all
+    //! samples
+    const vector_fp& importance() const {
+        return m_importance;
+    }
+
+    //! Names of species retained for a given threshold, in the order of the
+    //! detailed mechanism
+    std::vector<std::string> retainedSpecies(double threshold) const;
+
+    //! Create a Solution object containing the skeletal mechanism for a given
+    //! threshold. The skeletal mechanism can be written to a YAML file using
+    //! YamlWriter.
+    shared_ptr<Solution> reducedSolution(double threshold) const;
+
+    //! Add an error tolerance for a quantity evaluated by `metric`.
+    /*!
+     * @param metric  Function evaluating a quantity of interest, such as an
+     *     ignition delay time or a flame speed, for a Solution object
+     * @param rtol  Maximum relative deviation of the quantity evaluated for a
+     *     skeletal mechanism from its value for the detailed mechanism
+     */
+    void addErrorTarget(std::function<double(shared_ptr<Solution>)> metric,
+                        double rtol);
+
+    //! Find the largest threshold for which all error targets are satisfied.
+    /*!
+     * Thresholds are chosen among the distinct importance values of the
+     * species, each of which yields a different skeletal mechanism. The search
+     * uses bisection, which assumes that the errors grow with the threshold.
+     * Skeletal mechanisms for which the evaluation of a metric fails are
+     * considered to violate the error targets.
+     */
+    double findThreshold();
+
+protected:
+    //! Update the importance of all species for the current state
+    void update();
+
+    //! Evaluate all error metrics for `soln` and check whether they are within
+    //! their tolerances
+    bool satisfiesErrorTargets(shared_ptr<Solution> soln);
+
+    shared_ptr<Solution> m_soln; //!< Detailed mechanism
+    shared_ptr<ThermoPhase> m_thermo;
+    shared_ptr<Kinetics> m_kin;
+    std::string m_method;
+
+    std::vector<size_t> m_targets; //!< Indices of target species
+    std::vector<size_t> m_retained; //!< Species retained unconditionally
+
+    RelationGraph m_graph;
+
+    size_t m_nSamples;
+    vector_fp m_importance; //!< Overall importance of each species
+
+    //! Error metrics, tolerances and values for the detailed mechanism
+    std::vector<std::function<double(shared_ptr<Solution>)>> m_metrics;
+    vector_fp m_rtol;
+    vector_fp m_reference;
+
+    //! Work arrays
+    vector_fp m_ropnet, m_R;
+};
+
+}
+
+#endif
@@ -100,6 +100,44 @@ public:
         return 1.0;
     }
 
+    /**
+     * Partial derivatives of the natural logarithm of the falloff function.
+     * If not overloaded, both derivatives are zero, which corresponds to
+     * \f$ F = 1 \f$.
+     *
+     * @param T  Temperature [K].
+     * @param pr  reduced pressure (dimensionless).
+     * @param work  array of size workSize() containing cached
+     *             temperature-dependent intermediate results from a prior call
+     *             to updateTemp.
+     * @param[out] dlnF_dT  derivative of \f$ \ln F \f$ with respect to
+     *     temperature at constant reduced pressure
+     * @param[out] dlnF_dlnPr  derivative of \f$ \ln F \f$ with respect to
+     *     \f$ \ln Pr \f$ at constant temperature
+     */
+    virtual void getDerivativesF(double T, double pr, const double* work,
+                                 double& dlnF_dT, double& dlnF_dlnPr) const {
+        dlnF_dT = 0.0;
+        dlnF_dlnPr = 0.0;
+    }
+
+    //! Logarithmic temperature derivative of the rate constant
+    /*!
+     * Evaluates \f$ \partial \ln k / \partial T \f$ at constant third-body
+     * concentration from the derivatives of the rate constants of the low- and
+     * high-pressure limits and the derivatives of the falloff function.
+     *
+     * @param T  Temperature [K].
+     * @param pr  reduced pressure (dimensionless).
+     * @param work  cached temperature-dependent intermediate results from a
+     *     prior call to updateTemp.
+     * @param dlnk_low  derivative of \f$ \ln k_0 \f$ with respect to T
+     * @param dlnk_high  derivative of \f$ \ln k_\infty \f$ with respect to T
+     * @param chemAct  `true` for chemically activated reactions
+     */
+    double ddTScaled(double T, double pr, const double* work, double dlnk_low,
+                     double dlnk_high, bool chemAct) const;
+
     //! Evaluate falloff function at current conditions
     double evalF(double T, double conc3b) {
         FalloffData data;
@@ -166,6 +204,11 @@ public:
         return pr * m_rc_high;
     }
 
+    //! Evaluate derivative of reaction rate with respect to temperature
+    //! at constant third-body concentration
+    //! @param shared_data  data shared by all reactions of a given type
+    virtual double ddTFromStruct(const FalloffData& shared_data) const;
+
     void check(const std::string& equation, const AnyMap& node);
 
     //! Get flag indicating whether negative A values are permitted
@@ -215,6 +258,8 @@ public:
     void setHighRate(const ArrheniusRate& high);
 
 protected:
+    friend class FalloffBatch;
+
     ArrheniusRate m_lowRate; //!< The reaction rate in the low-pressure limit
     ArrheniusRate m_highRate; //!< The reaction rate in the high-pressure limit
 
@@ -340,6 +385,9 @@ public:
 
     virtual double F(double pr, const double* work) const;
 
+    virtual void getDerivativesF(double T, double pr, const double* work,
+                                 double& dlnF_dT, double& dlnF_dlnPr) const;
+
     virtual size_t workSize() const {
         return 1;
     }
@@ -363,6 +411,8 @@ public:
     virtual void getParameters(AnyMap& node) const;
 
 protected:
+    friend class FalloffBatch;
+
     //! parameter a in the 4-parameter Troe falloff function. Dimensionless
     double m_a;
 
@@ -443,6 +493,9 @@ public:
 
     virtual double F(double pr, const double* work) const;
 
+    virtual void getDerivativesF(double T, double pr, const double* work,
+                                 double& dlnF_dT, double& dlnF_dlnPr) const;
+
     virtual size_t workSize() const {
         return 2;
     }
@@ -466,6 +519,8 @@ public:
     virtual void getParameters(AnyMap& node) const;
 
 protected:
+    friend class FalloffBatch;
+
     //! parameter a in the 5-parameter SRI falloff function. Dimensionless.
     double m_a;
 
@@ -552,6 +607,9 @@ public:
 
     virtual double F(double pr, const double* work) const;
 
+    virtual void getDerivativesF(double T, double pr, const double* work,
+                                 double& dlnF_dT, double& dlnF_dlnPr) const;
+
     virtual size_t workSize() const {
         return 1;
     }
@@ -0,0 +1,101 @@
+/**
+ * @file FalloffBatch.h
+ * Batched evaluation of falloff rate constants
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_FALLOFFBATCH_H
+#define CT_FALLOFFBATCH_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+struct FalloffData;
+class FalloffRate;
+class TroeRate;
+class SriRate;
+
+//! Batched evaluation of rate constants of falloff reactions using the Troe or
+//! SRI parameterizations.
+/*!
+ * Parameters of the low- and high-pressure limits and of the falloff function
+ * of all reactions handled by a MultiBulkRate evaluator are stored in
+ * contiguous arrays. Exponentials and logarithms are evaluated for all
+ * reactions at once using vectorExp() and vectorLog(). Results that only
+ * depend on temperature (the rate constants of both limits and the
+ * temperature-dependent part of the falloff function) are retained until the
+ * temperature changes.
+ *
+ * All reactions need to use the same falloff parameterization.
+ * @ingroup falloffGroup
+ */
+class FalloffBatch
+{
+public:
+    FalloffBatch();
+
+    //! Discard all reactions
+    void clear();
+
+    //! Add a reaction using the Troe falloff function
+    void add(size_t rxn, const TroeRate& rate);
+
+    //! Add a reaction using the SRI falloff function
+    void add(size_t rxn, const SriRate& rate);
+
+    //! Evaluate rate constants of all reactions.
+    /*!
+     * @param data  Shared data of the falloff reactions
+     * @param kf  Rate constants, where values are written at the positions of
+     *     the reaction indices
+     * @returns `false` if effective third-body concentrations are not
+     *     available from the shared data, in which case nothing is evaluated.
+     *     This is the case until the data container has been resized by the
+     *     kinetics manager.
+     */
+    bool getRateConstants(const FalloffData& data, double* kf);
+
+protected:
+    //! Add parameters of the low- and high-pressure limits
+    void addLimits(size_t rxn, const FalloffRate& rate);
+
+    //! Update temperature-dependent quantities
+    void updateTemp(const FalloffData& data);
+
+    //! Falloff parameterization: 0 if no reactions were added, 1 for Troe and
+    //! 2 for SRI
+    int m_type;
+
+    std::vector<size_t> m_rxn; //!< Reaction indices
+
+    //! @name Parameters of the low- and high-pressure limits
+    //! @{
+    vector_fp m_A_low, m_b_low, m_Ea_R_low;
+    vector_fp m_A_high, m_b_high, m_Ea_R_high;
+    vector_fp m_chem_act; //!< 1.0 for chemically activated reactions
+    //! @}
+
+    //! Parameters of the falloff function. For Troe: (A, 1/T3, 1/T1, T2),
+    //! where T2 is infinite if the term is omitted. For SRI: (a, b, 1/c, d, e),
+    //! where 1/c is infinite if the term is omitted.
+    std::vector<vector_fp> m_params;
+
+    double m_temperature; //!< Temperature of the cached values
+    vector_fp m_k_low; //!< Rate constants in the low-pressure limit
+    vector_fp m_k_high; //!< Rate constants in the high-pressure limit
+
+    //! Natural logarithm of the temperature-dependent part of the falloff
+    //! function: ln(F_cent) for Troe and ln(a exp(-b/T) + exp(-T/c)) for SRI
+    vector_fp m_logF;
+    vector_fp m_dTe; //!< d T^e (SRI only)
+    vector_fp m_pr; //!< Reduced pressures
+    vector_fp m_work; //!< Work array
+};
+
+}
+
+#endif
@@ -111,6 +111,29 @@ public:
         }
     }
 
+    /**
+     * Evaluate logarithmic temperature derivatives of the rate constants of
+     * all falloff reactions at constant third-body concentrations.
+     * @param T Temperature [K].
+     * @param pr Reduced pressures.
+     * @param dlnk_low Temperature derivatives of the logarithms of the rate
+     *     constants in the low-pressure limit.
+     * @param dlnk_high Temperature derivatives of the logarithms of the rate
+     *     constants in the high-pressure limit.
+     * @param work Work array updated by updateTemp().
+     * @param[out] ddT Temperature derivatives of the logarithms of the rate
+     *     constants.
+     */
+    void pr_to_falloff_ddT(double T, const double* pr, const double* dlnk_low,
+                           const double* dlnk_high, const double* work,
+                           double* ddT) {
+        for (size_t i = 0; i < m_rxn.size(); i++) {
+            size_t j = m_rxn[i];
+            ddT[j] = m_falloff[i]->ddTScaled(T, pr[j], work + m_offset[i],
+                dlnk_low[j], dlnk_high[j], !m_isfalloff[i]);
+        }
+    }
+
 protected:
     std::vector<size_t> m_rxn;
     std::vector<shared_ptr<Falloff> > m_falloff;
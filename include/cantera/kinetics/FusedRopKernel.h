@@ -0,0 +1,142 @@
+/**
+ * @file FusedRopKernel.h
+ * Single-pass evaluation of rates of progress and net production rates
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_FUSEDROPKERNEL_H
+#define CT_FUSEDROPKERNEL_H
+
+#include "cantera/base/ct_defs.h"
+#include <cstdint>
+
+namespace Cantera
+{
+
+class StoichManagerN;
+
+//! Evaluates rates of progress and net production rates in a single pass over
+//! the reactions of a mechanism
+/*!
+ * The multi-pass evaluation using StoichManagerN traverses the reactions four
+ * times: the reactant and reversible product concentration products are
+ * formed by separate calls to StoichManagerN::multiply(), and the net rates of
+ * progress are scattered to the species by separate calls to
+ * StoichManagerN::incrementSpecies() and StoichManagerN::decrementSpecies(),
+ * each of which reads the index data of the reactions again and visits the
+ * reaction vectors in a different order.
+ *
+ * This class stores the concentration products and the stoichiometry of all
+ * reactions in a single compressed sparse row (CSR) layout with one row per
+ * reaction. The layout is streamed once per evaluation, where the forward and
+ * reverse rates of progress of each reaction are computed and immediately
+ * accumulated into the net production rates.
+ *
+ * Most reactions have at most three reactant and product molecules and
+ * reaction orders equal to their stoichiometric coefficients. For these
+ * reactions, a row consists of the reaction index followed by the species
+ * indices of the reactant and product molecules, where species with a
+ * stoichiometric coefficient of two are repeated. The same indices are used
+ * to form the concentration products and to accumulate the rates of progress,
+ * such that the net stoichiometric coefficients are implied. Rows are grouped
+ * into blocks of reactions with the same numbers of reactant and product
+ * molecules, which are evaluated by loops specialized for these numbers,
+ * similar to the classes C1, C2 and C3 used by StoichManagerN.
+ *
+ * The remaining reactions form a generic block. Rows of this block hold the
+ * reaction orders of the reactants and of the products of reversible
+ * reactions, followed by the explicit net stoichiometric coefficients. Each
+ * term is a 32-bit word holding the species index in its lower 24 bits and a
+ * signed integer coefficient in its upper 8 bits, where integer reaction
+ * orders are represented by repeated terms of unit order. Non-integer orders
+ * and coefficients are marked by a reserved code and are read in sequence
+ * from a separate array of values, such that `std::pow` is only evaluated
+ * for non-integer reaction orders.
+ * @ingroup kinetics
+ */
+class FusedRopKernel
+{
+public:
+    FusedRopKernel() : m_nSpecies(0), m_nReactions(0), m_multiPassSize(0) {}
+
+    //! Build the layout from the stoichiometry managers of a kinetics manager
+    /*!
+     * The stoichiometric coefficient matrices of the managers must be
+     * available, see StoichManagerN::resizeCoeffs().
+     *
+     * @param nSpecies  Number of species
+     * @param nReactions  Number of reactions
+     * @param reactants  Reactants of all reactions
+     * @param revProducts  Products of reversible reactions
+     * @param products  Products of all reactions
+     */
+    void build(size_t nSpecies, size_t nReactions,
+               const StoichManagerN& reactants,
+               const StoichManagerN& revProducts,
+               const StoichManagerN& products);
+
+    //! Discard the layout
+    void clear();
+
+    //! Number of species
+    size_t nSpecies() const {
+        return m_nSpecies;
+    }
+
+    //! Number of reactions, which is zero until build() is called
+    size_t nReactions() const {
+        return m_nReactions;
+    }
+
+    //! Evaluate rates of progress and net production rates
+    /*!
+     * @param conc  Species concentrations. Length: number of species.
+     * @param mult  Factors multiplying the rate coefficients. Length: number
+     *     of reactions.
+     * @param rkc  Reciprocal equilibrium constants, which must be zero for
+     *     irreversible reactions. Length: number of reactions.
+     * @param ropf  On input, forward rate coefficients; on output, forward
+     *     rates of progress. Length: number of reactions.
+     * @param ropr  Reverse rates of progress. Length: number of reactions.
+     * @param ropnet  Net rates of progress. Length: number of reactions.
+     * @param wdot  Net production rates. Length: number of species.
+     */
+    void evaluate(const double* conc, const double* mult, const double* rkc,
+                  double* ropf, double* ropr, double* ropnet,
+                  double* wdot) const;
+
+    //! Bytes of index and coefficient data streamed by evaluate()
+    size_t dataSize() const;
+
+    //! Estimated bytes of index and coefficient data streamed by the
+    //! multi-pass evaluation using the stoichiometry managers passed to build()
+    size_t multiPassDataSize() const {
+        return m_multiPassSize;
+    }
+
+protected:
+    //! Rows of reactions with the same numbers of reactant and product
+    //! molecules
+    struct Block
+    {
+        int nReactants; //!< Reactant molecules, or -1 for the generic block
+        int nProducts; //!< Product molecules, or -1 for the generic block
+        size_t nRows; //!< Number of reactions
+        size_t start; //!< Offset of the first row in #m_data
+    };
+
+    size_t m_nSpecies; //!< Number of species
+    size_t m_nReactions; //!< Number of reactions
+    std::vector<Block> m_blocks; //!< Blocks of rows
+    std::vector<uint32_t> m_data; //!< Row headers and terms of all reactions
+    vector_fp m_values; //!< Non-integer orders and coefficients
+
+    //! Estimated data size of the multi-pass evaluation
+    size_t m_multiPassSize;
+};
+
+}
+
+#endif
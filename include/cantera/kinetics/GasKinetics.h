@@ -12,6 +12,10 @@
 #include "BulkKinetics.h"
 #include "FalloffMgr.h"
 #include "Reaction.h"
+#include "RateTable.h"
+#include "FusedRopKernel.h"
+#include "DirectedRelationGraph.h"
+#include "cantera/numerics/DenseMatrix.h"
 
 namespace Cantera
 {
@@ -47,12 +51,272 @@ public:
     virtual void getEquilibriumConstants(doublereal* kc);
     virtual void getFwdRateConstants(double* kfwd);
 
+    //! Set the multiplier for the forward rate constant of reaction `i`.
+    /*!
+     * Reactions with a multiplier of zero are skipped when evaluating rate
+     * constants of non-legacy reaction types, effective third-body
+     * concentrations, equilibrium constants and concentration products. The
+     * set of skipped reactions is updated when rates are next evaluated after
+     * a multiplier is changed from or to zero.
+     */
+    virtual void setMultiplier(size_t i, double f);
+
+    //! @}
+    //! @name Routines to Calculate Derivatives (Jacobians)
+    //! @{
+
+    //! Retrieve derivative settings.
+    //! @see setDerivativeSettings
+    virtual void getDerivativeSettings(AnyMap& settings) const;
+
+    //! Set/modify derivative settings.
+    /*!
+     * Derivatives of the law of mass action and of third-body concentrations are
+     * evaluated analytically from the reaction structure held by the
+     * stoichiometry managers and the third-body calculator. Temperature
+     * derivatives of rate constants are evaluated analytically for all rate
+     * parameterizations, including legacy reaction types (for Blowers-Masel
+     * rates, at constant enthalpy of reaction). Dependencies of rate constants
+     * on pressure and third-body concentrations (for example falloff, P-log
+     * and Chebyshev rates) are obtained from a single perturbation of the data
+     * shared by each rate evaluator. Pressure derivatives assume ideal gas
+     * behavior, i.e. \f$ P = C_{tot} R T \f$. Derivatives with respect to
+     * concentrations are not available for legacy reaction types.
+     *
+     * Supported settings are:
+     * - `skip-third-bodies` (boolean): if `true`, the dependence of rates on
+     *   effective third-body concentrations is neglected; default is `false`
+     * - `skip-pressure-dependence` (boolean): if `true`, the dependence of rate
+     *   constants on pressure is neglected; as pressure depends on all species
+     *   concentrations, this avoids fully populated rows for pressure-dependent
+     *   reactions; default is `false`
+     * - `rtol-delta` (double): relative perturbation used for numerical
+     *   derivatives of rate constants; default is `1e-8`
+     *
+     * @param settings  AnyMap containing settings determining derivative evaluation.
+     */
+    virtual void setDerivativeSettings(const AnyMap& settings);
+
+    virtual void getFwdRatesOfProgress_ddT(double* drop);
+    virtual void getRevRatesOfProgress_ddT(double* drop);
+    virtual void getNetRatesOfProgress_ddT(double* drop);
+    virtual void getNetProductionRates_ddT(double* dwdot);
+
+    virtual Eigen::SparseMatrix<double> fwdRatesOfProgress_ddC();
+    virtual Eigen::SparseMatrix<double> revRatesOfProgress_ddC();
+    virtual Eigen::SparseMatrix<double> netRatesOfProgress_ddC();
+
+    //! @}
+    //! @name Tabulation of Temperature-Dependent Rate Data
+    //! @{
+
+    //! Enable tabulation of temperature-dependent rate data.
+    /*!
+     * Forward rate constants of reactions with Arrhenius rates (including
+     * three-body reactions) and, for ideal gas phases, reciprocal equilibrium
+     * constants of reversible reactions are tabulated on a uniform grid in 1/T.
+     * Within the tabulated temperature range, the logarithms of these
+     * quantities are interpolated, which replaces the evaluation of the rate
+     * expressions and the species thermodynamic properties by a single call
+     * to vectorExp(). Outside of the range, they are evaluated exactly. The
+     * table is built when rates are first evaluated, and is rebuilt after
+     * reactions are added or modified. Reciprocal equilibrium constants are
+     * limited to #BigNumber after interpolation, as for their exact values.
+     *
+     * Interpolation errors of equilibrium constants are limited by
+     * discontinuities of the species thermodynamic data, for example at the
+     * midpoint temperature of NASA polynomials, which typically correspond to
+     * relative errors of a few times 1e-6.
+     *
+     * @param Tmin  Lower bound of the tabulated temperature range [K]
+     * @param Tmax  Upper bound of the tabulated temperature range [K]
+     * @param rtol  Maximum relative interpolation error, which is estimated
+     *     at the midpoints of the grid
+     * @param maxPoints  Maximum number of grid points; an exception is thrown
+     *     if the tolerance is not met with this number of points
+     */
+    void setRateTabulation(double Tmin, double Tmax, double rtol=1e-5,
+                           size_t maxPoints=5000);
+
+    //! Disable tabulation of temperature-dependent rate data
+    void disableRateTabulation();
+
+    //! Return `true` if tabulation of rate data is enabled
+    bool rateTabulationEnabled() const {
+        return m_tab_Tmax > 0.0;
+    }
+
+    //! Table of rate data, which is empty until rates are first evaluated
+    //! after tabulation has been enabled
+    const RateTable& rateTable() const {
+        return m_rate_table;
+    }
+
+    //! @}
+    //! @name Fused Evaluation of Net Production Rates
+    //! @{
+
+    //! Enable or disable the fused evaluation of net production rates.
+    /*!
+     * If enabled, concentration products, rates of progress and net production
+     * rates are evaluated in a single pass over the reactions by a
+     * FusedRopKernel, instead of separate passes of the stoichiometry
+     * managers. The kernel is built when rates are next evaluated, and is
+     * rebuilt after reactions or species are added. The multi-pass evaluation
+     * is still used while rates are restricted to the active set of dynamic
+     * adaptive chemistry and while any reaction multipliers are zero.
+     */
+    void setFusedEvaluation(bool enabled);
+
+    //! Return `true` if the fused evaluation of net production rates is
+    //! enabled
+    bool fusedEvaluationEnabled() const {
+        return m_fused_enabled;
+    }
+
+    //! Kernel used for the fused evaluation, which is empty until rates are
+    //! first evaluated after the fused evaluation has been enabled
+    const FusedRopKernel& fusedKernel() const {
+        return m_fused;
+    }
+
+    virtual void getNetProductionRates(double* wdot);
+
+    //! Species net production rates [kmol/m^3/s] for a batch of states.
+    /*!
+     * States are processed in blocks, where quantities that depend on the
+     * thermodynamic state are evaluated for each state in turn, while rate
+     * constants of reactions with Arrhenius rates, equilibrium constants,
+     * concentration products and net production rates are evaluated for all
+     * states of a block at once. Rate constants of other rate types are
+     * evaluated for each state. The results agree with those of
+     * getNetProductionRates(double*) up to round-off errors.
+     *
+     * Legacy reaction types, rate tabulation, dynamic adaptive chemistry,
+     * quasi-steady-state species and reactions with multipliers of zero are
+     * not supported by the simultaneous evaluation; in these cases, the states
+     * are evaluated one at a time.
+     *
+     * See Kinetics::getNetProductionRates(size_t, const double*, const double*,
+     * const double*, double*) for a description of the arguments.
+     */
+    virtual void getNetProductionRates(size_t nStates, const double* T,
+                                       const double* P, const double* Y,
+                                       double* wdot);
+
+    //! @}
+    //! @name Dynamic Adaptive Chemistry
+    //! @{
+
+    //! Enable dynamic adaptive chemistry.
+    /*!
+     * Rates of progress are only evaluated for a subset of active reactions,
+     * which is determined for the current state by a DRGEP sweep (see
+     * RelationGraph) starting at the target species. A species is activated
+     * if its path coefficient reaches `threshold`, and an active species is
+     * deactivated once its path coefficient falls below `hysteresis *
+     * threshold`. Reactions are active if all participating species are
+     * active. Rates of progress of inactive reactions are zero, such that
+     * inactive species are frozen when integrating reactor networks. Reactions
+     * with a multiplier of zero are never active.
+     *
+     * The active set is refreshed from rates of progress of the full mechanism
+     * if the temperature or pressure changes by more than `rtol` relative to
+     * the state of the last refresh, if any mole fraction changes by more than
+     * `rtol`, or if the refresh interval has elapsed. The refresh interval is
+     * the number of rate evaluations between refreshes. It is reset to one
+     * whenever the active set changes and doubled otherwise, up to
+     * `maxInterval`.
+     *
+     * Rate constants, equilibrium constants and derivatives of rates of
+     * progress are evaluated for all reactions.
+     *
+     * @param targets  Names of the target species
+     * @param threshold  Threshold for the path coefficients of active species
+     * @param rtol  Relative tolerance for changes of the state
+     * @param maxInterval  Maximum number of rate evaluations between refreshes
+     * @param hysteresis  Factor applied to the threshold for deactivation
+     */
+    void enableAdaptiveChemistry(const std::vector<std::string>& targets,
+                                 double threshold=1e-4, double rtol=0.01,
+                                 size_t maxInterval=64, double hysteresis=0.5);
+
+    //! Disable dynamic adaptive chemistry
+    void disableAdaptiveChemistry();
+
+    //! Return `true` if dynamic adaptive chemistry is enabled
+    bool adaptiveChemistryEnabled() const {
+        return m_dac_enabled;
+    }
+
+    //! Flags indicating active species, which are empty until rates are first
+    //! evaluated after dynamic adaptive chemistry has been enabled
+    const std::vector<bool>& activeSpecies() const {
+        return m_dac_species;
+    }
+
+    //! Flags indicating active reactions, which are empty until rates are
+    //! first evaluated after dynamic adaptive chemistry has been enabled
+    const std::vector<bool>& activeReactions() const {
+        return m_dac_rxn;
+    }
+
+    //! Number of refreshes of the active set
+    size_t nAdaptiveRefreshes() const {
+        return m_dac_nRefresh;
+    }
+
+    //! @}
+    //! @name Quasi-Steady-State Species
+    //! @{
+
+    //! Declare quasi-steady-state (QSS) species.
+    /*!
+     * Concentrations of QSS species are not taken from the phase, but are
+     * determined whenever rates of progress are evaluated such that the net
+     * production rates of all QSS species vanish. QSS species that participate
+     * in the same reaction are coupled and form a group. The concentrations of
+     * each group are found from a linear system if all reactions are of first
+     * order in the QSS species of the group, and by Newton iteration starting
+     * from the previous solution otherwise, or from a small positive
+     * concentration on the first evaluation.
+     *
+     * The QSS concentrations only enter the concentration products of the
+     * rates of progress. Effective third-body concentrations, including those
+     * used for falloff reactions, and derivatives of rates of progress are
+     * evaluated using the concentrations of QSS species provided by the phase,
+     * which avoids coupling the QSS solution to the third-body sums.
+     *
+     * QSS species can also be declared using the `qss-species` field of the
+     * phase definition in YAML input files.
+     *
+     * @param names  Names of the QSS species; an empty list disables the
+     *     quasi-steady-state approximation
+     */
+    void setQssSpecies(const std::vector<std::string>& names);
+
+    //! Indices of QSS species
+    const std::vector<size_t>& qssSpecies() const {
+        return m_qss;
+    }
+
+    //! Return `true` if species `k` is a QSS species
+    bool isQssSpecies(size_t k) const;
+
+    //! Number of groups of coupled QSS species, which is zero until rates are
+    //! first evaluated after QSS species have been declared
+    size_t nQssGroups() const {
+        return m_qss_groups.size();
+    }
+
     //! @}
     //! @name Reaction Mechanism Setup Routines
     //! @{
     virtual bool addReaction(shared_ptr<Reaction> r, bool resize=true);
     virtual void modifyReaction(size_t i, shared_ptr<Reaction> rNew);
     virtual void invalidateCache();
+    virtual void resizeReactions();
+    virtual AnyMap parameters();
     //! @}
 
     void updateROP();
@@ -128,6 +392,230 @@ protected:
 
     //! Update the equilibrium constants in molar units.
     void updateKc();
+
+    //! Store the logarithms of the reciprocal equilibrium constants in molar
+    //! units of the reactions `revindex` in #m_rkcn
+    void updateLogKc(const std::vector<size_t>& revindex);
+
+    //! @name Instrumented sections
+    //! Indices of the sections recorded by #m_instrumentation
+    //!@{
+    size_t m_sec_rop; //!< updateROP
+    size_t m_sec_rates_T; //!< update_rates_T
+    size_t m_sec_rates_C; //!< update_rates_C
+    size_t m_sec_Kc; //!< updateKc
+    size_t m_sec_table; //!< Interpolation of tabulated rate data
+    size_t m_sec_legacy; //!< Legacy rate evaluators
+    size_t m_sec_thirdbody; //!< Third-body concentrations in updateROP
+    size_t m_sec_falloff; //!< processFalloffReactions
+    size_t m_sec_qss; //!< solveQss
+    size_t m_sec_stoich; //!< Concentration products in updateROP
+    //!@}
+
+    //! Build the table of rate data for the current reaction mechanism
+    void buildRateTable();
+
+    //! Check whether the active set of dynamic adaptive chemistry needs to be
+    //! refreshed for the current state
+    bool adaptiveRefreshDue();
+
+    //! Update the active set of dynamic adaptive chemistry from the current
+    //! rates of progress of the full mechanism
+    void updateActiveSet();
+
+    //! Update the set of reactions that are skipped because their multipliers
+    //! are zero
+    void updateReactionMask();
+
+    //! Evaluate rates of progress of a subset of reactions from the forward
+    //! rate coefficients in #m_ropf, setting those of other reactions to zero
+    /*!
+     * @param active  Indices of reactions to be evaluated
+     * @param inactive  Indices of the remaining reactions
+     * @param reactants  Reactant stoichiometry of the active reactions
+     * @param revProducts  Product stoichiometry of active reversible reactions
+     */
+    void updateActiveROP(const std::vector<size_t>& active,
+                         const std::vector<size_t>& inactive,
+                         StoichManagerN& reactants, StoichManagerN& revProducts);
+
+    //! Reaction involving QSS species
+    struct QssReaction
+    {
+        //! Species of a concentration product, where `loc` is the index within
+        //! the QSS group or `npos` for species that are not QSS species
+        struct Term
+        {
+            size_t k; //!< Species index
+            size_t loc; //!< Index within the QSS group
+            double order; //!< Reaction order
+        };
+
+        size_t rxn; //!< Reaction index
+        std::vector<Term> fwd; //!< Reactants
+        std::vector<Term> rev; //!< Products, which are empty if irreversible
+        //! Indices within the QSS group and net stoichiometric coefficients
+        std::vector<std::pair<size_t, double>> nu;
+    };
+
+    //! Coupled QSS species
+    struct QssGroup
+    {
+        std::vector<size_t> species; //!< Species indices
+        std::vector<QssReaction> rxn; //!< Reactions involving the species
+        bool linear; //!< True if all reactions are of first order in the group
+        DenseMatrix jac; //!< Jacobian of the net production rates
+        vector_fp conc; //!< Concentrations of the last solution
+        vector_fp resid; //!< Net production rates and Newton steps
+    };
+
+    //! Find groups of coupled QSS species and the reactions involving them
+    void buildQssGroups();
+
+    //! Determine concentrations of QSS species from the forward rate
+    //! coefficients in #m_ropf and store them in #m_act_conc
+    /*!
+     * @param restricted  If `true`, only reactions that are active for dynamic
+     *     adaptive chemistry are considered
+     */
+    void solveQss(bool restricted);
+
+    //! Evaluate net production rates of the species of `group` and their
+    //! Jacobian for the current concentrations in #m_act_conc
+    void evalQssResidual(QssGroup& group, bool restricted);
+
+    //! Multiply rates of progress `in` by the logarithmic temperature derivative
+    //! of the rate constants at constant concentrations and store in `drop`
+    void process_ddT(const vector_fp& in, double* drop);
+
+    //! Multiply entries of `drop` for legacy reactions by the logarithmic
+    //! temperature derivatives of their rate constants at constant pressure
+    void processLegacy_ddT(double* drop);
+
+    //! Multiply entries of `drop` for legacy reactions by the logarithmic
+    //! pressure derivatives of their rate constants
+    void processLegacy_ddP(double* drop);
+
+    //! Increment `drop` by `factor` times the reverse rates of progress scaled
+    //! by the logarithmic temperature derivatives of the reciprocal equilibrium
+    //! constants
+    void incrementRevRates_ddKc(double factor, double* drop);
+
+    //! Calculate derivatives of rates of progress `in` with respect to species
+    //! concentrations
+    /*!
+     * @param stoich  stoichiometry manager for the concentration products
+     * @param in  rates of progress (forward or reverse)
+     * @param reverse  if `true`, rate coefficients are scaled by the reciprocal
+     *     equilibrium constants
+     */
+    Eigen::SparseMatrix<double> process_ddC(StoichManagerN& stoich,
+                                            const vector_fp& in, bool reverse);
+
+    //! Raise an exception if derivatives are not available for all reactions
+    /*!
+     * @param name  name of the calling method
+     * @param legacy_ok  if `true`, legacy reaction types are supported
+     */
+    void assertDerivativesValid(const std::string& name, bool legacy_ok=false);
+
+    //! @name Derivative settings
+    //! @{
+    bool m_jac_skip_third_bodies; //!< neglect third-body dependence
+    bool m_jac_skip_pressure; //!< neglect pressure dependence of rate constants
+    double m_jac_rtol_delta; //!< relative perturbation for rate constants
+    //! @}
+
+    //! Work arrays used for derivative evaluation
+    vector_fp m_rbuf0, m_rbuf1, m_rbuf2;
+
+    //! Work arrays used for temperature derivatives of legacy falloff
+    //! reactions, with one entry per falloff reaction
+    vector_fp m_fbuf0, m_fbuf1, m_fbuf2;
+
+    //! @name Tabulation of rate data
+    //! @{
+    double m_tab_Tmin; //!< Lower bound of the tabulated temperature range
+    double m_tab_Tmax; //!< Upper bound of the tabulated temperature range
+    double m_tab_rtol; //!< Relative interpolation tolerance
+    size_t m_tab_maxPoints; //!< Maximum number of grid points
+    RateTable m_rate_table; //!< Table of forward and reverse rate data
+    std::vector<size_t> m_tab_kf; //!< Reactions with tabulated rate constants
+    bool m_tab_kc; //!< True if equilibrium constants are tabulated
+    bool m_tab_active; //!< True if tabulated data are used at the current T
+    vector_fp m_tab_values; //!< Interpolated values
+    vector_fp m_tab_sign; //!< Signs of the tabulated rate constants
+    //! @}
+
+    //! @name Dynamic adaptive chemistry
+    //! @{
+    bool m_dac_enabled; //!< True if dynamic adaptive chemistry is enabled
+    std::vector<size_t> m_dac_targets; //!< Indices of target species
+    double m_dac_threshold; //!< Threshold for path coefficients
+    double m_dac_rtol; //!< Relative tolerance for changes of the state
+    double m_dac_hysteresis; //!< Factor applied to threshold for deactivation
+    size_t m_dac_maxInterval; //!< Maximum refresh interval
+    size_t m_dac_interval; //!< Current refresh interval
+    size_t m_dac_count; //!< Rate evaluations since the last refresh
+    size_t m_dac_nRefresh; //!< Number of refreshes
+    RelationGraph m_dac_graph; //!< Species relation graph
+    std::vector<bool> m_dac_species; //!< Active species
+    std::vector<bool> m_dac_rxn; //!< Active reactions
+    std::vector<size_t> m_dac_active; //!< Indices of active reactions
+    std::vector<size_t> m_dac_inactive; //!< Indices of inactive reactions
+    StoichManagerN m_dac_reactantStoich; //!< Reactants of active reactions
+    StoichManagerN m_dac_revProductStoich; //!< Products of active reactions
+    double m_dac_T; //!< Temperature at the last refresh
+    double m_dac_P; //!< Pressure at the last refresh
+    vector_fp m_dac_X; //!< Mole fractions at the last refresh
+    vector_fp m_dac_work; //!< Work array
+    //! @}
+
+    //! @name Reactions with zero multipliers
+    //! @{
+    bool m_mask_ok; //!< True if the mask reflects the current multipliers
+    bool m_mask_enabled; //!< True if any reactions are skipped
+    std::vector<bool> m_mask_rxn; //!< Reactions with non-zero multipliers
+    std::vector<size_t> m_mask_active; //!< Indices of evaluated reactions
+    std::vector<size_t> m_mask_inactive; //!< Indices of skipped reactions
+    std::vector<size_t> m_mask_revindex; //!< Evaluated reversible reactions
+    StoichManagerN m_mask_reactantStoich; //!< Reactants of evaluated reactions
+    StoichManagerN m_mask_revProductStoich; //!< Products of evaluated reactions
+    //! @}
+
+    //! @name Fused evaluation of net production rates
+    //! @{
+    bool m_fused_enabled; //!< True if the fused evaluation is enabled
+    bool m_fused_wdot_ok; //!< True if #m_fused_wdot matches #m_ropnet
+    FusedRopKernel m_fused; //!< Kernel for the fused evaluation
+    vector_fp m_fused_wdot; //!< Net production rates of the last evaluation
+    //! @}
+
+    //! @name Evaluation of net production rates for a batch of states
+    //! Work arrays of getNetProductionRates(size_t, const double*, const
+    //! double*, const double*, double*), where the entry `k` for state `j` of
+    //! a block of `n` states is stored at index `k*n + j`.
+    //! @{
+    vector_fp m_batch_rrt; //!< Reciprocals of RT
+    vector_fp m_batch_logc0; //!< Logarithms of the standard concentrations
+    vector_fp m_batch_conc; //!< Activity concentrations
+    vector_fp m_batch_mu; //!< Standard chemical potentials
+    vector_fp m_batch_concm; //!< Rows of the third-body efficiency matrix
+    vector_fp m_batch_ropf; //!< Forward and net rates of progress
+    vector_fp m_batch_ropr; //!< Reverse rates of progress
+    vector_fp m_batch_wdot; //!< Net production rates
+    //! Reactions with rate constants that are evaluated for each state
+    std::vector<size_t> m_batch_single;
+    //! @}
+
+    //! @name Quasi-steady-state species
+    //! @{
+    std::vector<size_t> m_qss; //!< Indices of QSS species
+    std::vector<QssGroup> m_qss_groups; //!< Groups of coupled QSS species
+    double m_qss_rtol; //!< Relative tolerance of Newton iterations
+    double m_qss_atol; //!< Absolute tolerance relative to the molar density
+    size_t m_qss_maxIter; //!< Maximum number of Newton iterations
+    //! @}
 };
 
 }
@@ -0,0 +1,128 @@
+/**
+ * @file GeneratedKinetics.h
+ * Base class for gas-phase kinetics managers using source code generated for
+ * a specific reaction mechanism, and the corresponding code generator.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_GENERATEDKINETICS_H
+#define CT_GENERATEDKINETICS_H
+
+#include "GasKinetics.h"
+
+namespace Cantera
+{
+
+/**
+ * Base class for kinetics managers with mechanism-specific generated kernels.
+ *
+ * Derived classes are written by writeGeneratedKinetics() for a fixed reaction
+ * mechanism. Their kernels evaluate Arrhenius rate constants, effective
+ * third-body concentrations, equilibrium constants, rates of progress and
+ * species production rates with all species indices, stoichiometric
+ * coefficients, efficiencies and rate parameters as compile-time constants.
+ * Other rate types (for example falloff, P-log or Chebyshev rates) are
+ * evaluated by the usual MultiRate evaluators.
+ *
+ * The reaction mechanism is still imported from the input file, so all
+ * information on species and reactions remains available. Before the
+ * generated kernels are used for the first time, the mechanism is compared to
+ * the one used to generate the code. If the mechanisms differ, or if reactions
+ * are modified after setup, the generic GasKinetics implementation is used
+ * instead.
+ *
+ * The generated source registers the derived class with the KineticsFactory
+ * when it is loaded; the class is then selected by setting the `kinetics`
+ * field of the phase definition to the registered model name.
+ * @ingroup kinetics
+ */
+class GeneratedKinetics : public GasKinetics
+{
+public:
+    GeneratedKinetics(ThermoPhase* thermo=0);
+
+    using GasKinetics::getNetProductionRates;
+    virtual void getNetProductionRates(double* wdot);
+
+    virtual bool addReaction(shared_ptr<Reaction> r, bool resize=true);
+    virtual void modifyReaction(size_t i, shared_ptr<Reaction> rNew);
+
+    virtual void updateROP();
+    virtual void update_rates_T();
+    virtual void update_rates_C();
+
+    //! Return `true` if the generated kernels match the current mechanism and
+    //! are used for evaluating rates. The generic GasKinetics implementation is
+    //! used while QSS species, dynamic adaptive chemistry or rate tabulation
+    //! are enabled, since the generated kernels do not support them.
+    bool usesGeneratedCode();
+
+    //! Hash of the properties of a mechanism that are built into generated
+    //! kernels, that is, the species names and reaction equations, rate
+    //! parameters of Arrhenius reactions, third-body efficiencies and
+    //! reaction orders.
+    static uint64_t mechanismHash(Kinetics& kin);
+
+protected:
+    //! Hash of the mechanism used to generate the kernels.
+    //! @see mechanismHash
+    virtual uint64_t generatedHash() const = 0;
+
+    //! Evaluate rate constants of reactions with Arrhenius rates
+    virtual void evalArrheniusRates(double logT, double recipT,
+                                    double* kf) const = 0;
+
+    //! Evaluate effective third-body concentrations
+    virtual void evalThirdBodyConcentrations(const double* conc, double ctot,
+                                             double* concm) const = 0;
+
+    //! Evaluate reciprocal equilibrium constants in concentration units from
+    //! the non-dimensional standard chemical potentials `g0_RT`
+    virtual void evalEquilibriumConstants(const double* g0_RT,
+                                          double logStandConc,
+                                          double* rkc) const = 0;
+
+    //! Multiply forward and reverse rate coefficients by effective third-body
+    //! concentrations and by the products of species concentrations
+    virtual void evalRatesOfProgress(const double* conc, const double* concm,
+                                     double* ropf, double* ropr) const = 0;
+
+    //! Evaluate species net production rates from net rates of progress
+    virtual void evalNetProductionRates(const double* ropnet,
+                                        double* wdot) const = 0;
+
+    //! Update the equilibrium constants using the generated kernel
+    void updateKcGenerated();
+
+    //! Status of the generated kernels: -1 if not checked against the current
+    //! mechanism, 0 if not usable, 1 if usable.
+    int m_generated_ok;
+
+    //! Index of the Arrhenius evaluator within #m_bulk_rates
+    size_t m_arrhenius_index;
+};
+
+//! Write C++ source code for a kinetics manager specialized for a specific
+//! reaction mechanism.
+/*!
+ * The generated source defines a class derived from GeneratedKinetics and
+ * registers it with the KineticsFactory under the name `model` when the
+ * compiled code is loaded, for example by linking it into an application or
+ * by loading it as a shared library. Only gas-phase mechanisms without
+ * reactions using legacy rate types are supported.
+ *
+ * @param kin  Kinetics manager holding the reaction mechanism
+ * @param className  Name of the generated class
+ * @param model  Name used to register the generated class with the
+ *     KineticsFactory. Converted to lower case.
+ * @param s  Stream receiving the generated source code
+ * @ingroup kinetics
+ */
+void writeGeneratedKinetics(Kinetics& kin, const std::string& className,
+                            const std::string& model, std::ostream& s);
+
+}
+
+#endif
@@ -45,7 +45,12 @@ namespace Cantera
  * This last equation serves to ensure that sum of the \f$ \theta_k \f$ values
  * stays constant.
  *
- * The object uses the CVODE software to advance the surface equations.
+ * The object uses the CVODE software to advance the surface equations. By
+ * default, the linear systems arising in the Newton iterations are solved
+ * using a dense matrix formed by finite differences. For large surface
+ * mechanisms, the GMRES iterative solver can be used instead, preconditioned
+ * by an incomplete LU factorization of the sparse analytic Jacobian; see
+ * setLinearSolverType().
  *
  * The solution vector used by this object is as follows: For each surface
  * phase with \f$ N_s \f$ surface sites, it consists of the surface coverages
@@ -145,6 +150,30 @@ public:
     void solvePseudoSteadyStateProblem(int ifuncOverride = -1,
                                        doublereal timeScaleOverride = 1.0);
 
+    //! Set the type of linear solver used for time integration and for the
+    //! pseudo steady-state problem
+    /*!
+     * @param type  One of `dense`, using dense matrices; `sparse`, using the
+     *     sparse analytic Jacobian; or `auto` (the default), which uses the
+     *     sparse solver for problems with at least solveSP::s_sparseMinSize
+     *     equations where the fraction of nonzero Jacobian elements does not
+     *     exceed solveSP::s_sparseMaxDensity. For time integration, the sparse
+     *     solver is GMRES with an AdaptivePreconditioner. The selection
+     *     takes effect the next time the integrator is initialized.
+     */
+    void setLinearSolverType(const std::string& type);
+
+    //! Type of linear solver, as set by setLinearSolverType()
+    const std::string& linearSolverType() const {
+        return m_linearSolverType;
+    }
+
+    //! `true` if the integrator was initialized to use the sparse
+    //! preconditioned iterative solver
+    bool usingSparseSolver() const {
+        return m_precon != nullptr;
+    }
+
     // overloaded methods of class FuncEval
 
     //! Return the number of equations
@@ -171,6 +200,10 @@ public:
      */
     virtual void getState(doublereal* y);
 
+    virtual void preconditionerSetup(double t, double* y, double gamma);
+    virtual void preconditionerSolve(double* rhs, double* output);
+    virtual void updatePreconditioner(double gamma);
+
     /*!
      * Get the specifications for the problem from the values
      * in the ThermoPhase objects for all phases.
@@ -231,6 +264,17 @@ protected:
      */
     void updateState(doublereal* y);
 
+    //! Get the nonzero elements of the Jacobian of the time derivatives of the
+    //! coverages with respect to the coverages at the current state
+    /*!
+     * The derivatives are evaluated from InterfaceKinetics::netProductionRates_ddC
+     * and neglect the normalization of the coverages.
+     *
+     * @param trips  Triplets holding the row, column and value of each
+     *     element, which are appended; repeated elements are to be summed
+     */
+    void getJacobianElements(SparseTriplets& trips);
+
     //! vector of pointers to surface phases.
     std::vector<SurfPhase*> m_surf;
 
@@ -248,6 +292,11 @@ protected:
 
     std::vector<size_t> m_specStartIndex;
 
+    //! For each InterfaceKinetics object, the index in the solution vector of
+    //! each kinetic species, or `npos` if the species is not a surface species
+    //! of one of the phases in #m_surf
+    std::vector<std::vector<size_t>> m_kinSpecState;
+
     //! Total number of surface species in all surface phases
     /*!
      * This is the total number of unknowns in m_mode 0 problem
@@ -294,6 +343,16 @@ protected:
      */
     std::unique_ptr<solveSP> m_surfSolver;
 
+    //! Type of linear solver; see setLinearSolverType()
+    std::string m_linearSolverType;
+
+    //! Preconditioner used with the GMRES linear solver, if the sparse solver
+    //! is used for time integration
+    shared_ptr<PreconditionerBase> m_precon;
+
+    //! Work array holding the nonzero elements of the Jacobian
+    SparseTriplets m_jacTrips;
+
     //! If true, a common temperature and pressure for all surface and bulk
     //! phases associated with the surface problem is imposed
     bool m_commonTempPressForPhases;
@@ -11,6 +11,7 @@
 
 #include "Kinetics.h"
 #include "RateCoeffMgr.h"
+#include "SurfaceArrheniusBatch.h"
 
 namespace Cantera
 {
@@ -179,6 +180,22 @@ public:
        return m_rates.effectiveTemperatureExponent(irxn);
     }
 
+    //! @}
+    //! @name Routines to Calculate Derivatives (Jacobians)
+    /*!
+     * Derivatives with respect to species concentrations account for the law
+     * of mass action, where activity concentrations are assumed to be equal
+     * to concentrations, and for the dependence of the rate constants on the
+     * coverages of the surface species, including the Motz-Wise correction of
+     * sticking coefficients. The effect of the checks for phase existence
+     * performed by updateROP() is neglected.
+     * @{
+     */
+
+    virtual Eigen::SparseMatrix<double> fwdRatesOfProgress_ddC();
+    virtual Eigen::SparseMatrix<double> revRatesOfProgress_ddC();
+    virtual Eigen::SparseMatrix<double> netRatesOfProgress_ddC();
+
     //! @}
     //! @name Reaction Mechanism Construction
     //! @{
@@ -396,6 +413,22 @@ protected:
     BMSurfaceArrhenius buildBMSurfaceArrhenius(size_t i, BlowersMaselInterfaceReaction& r,
                                                bool replace);
 
+    //! Store the coverage dependencies of reaction `i` for the evaluation of
+    //! derivatives, replacing any existing entries for this reaction
+    void setCoverageDerivatives(size_t i, const std::map<std::string,
+                                CoverageDependency>& deps);
+
+    //! Calculate derivatives of rates of progress `in` with respect to species
+    //! concentrations
+    /*!
+     * @param stoich  stoichiometry manager for the concentration products
+     * @param in  rates of progress (forward or reverse)
+     * @param reverse  if `true`, rate coefficients are scaled by the reciprocal
+     *     equilibrium constants
+     */
+    Eigen::SparseMatrix<double> process_ddC(StoichManagerN& stoich,
+                                            const vector_fp& in, bool reverse);
+
     //! Temporary work vector of length m_kk
     vector_fp m_grt;
 
@@ -406,12 +439,13 @@ protected:
      */
     std::vector<size_t> m_revindex;
 
-    //! Templated class containing the vector of reactions for this interface
+    //! Batched evaluator of the rate constants of all reactions with
+    //! SurfaceArrhenius rate parameterizations
     /*!
-     *  The templated class is described in RateCoeffMgr.h
+     *  The class SurfaceArrheniusBatch is described in SurfaceArrheniusBatch.h
      *  The class SurfaceArrhenius is described in RxnRates.h
      */
-    Rate1<SurfaceArrhenius> m_rates;
+    SurfaceArrheniusBatch m_rates;
 
     //! Templated class containing the vector of surface Blowers Masel reactions for this interface
     /*!
@@ -668,11 +702,30 @@ protected:
         double order; //!< exponent applied to site density term
         double multiplier; //!< multiplicative factor in rate expression
         bool use_motz_wise; //!< 'true' if Motz & Wise correction is being used
+
+        //! Derivative of the logarithm of the rate constant with respect to
+        //! the logarithm of the sticking coefficient, which differs from one
+        //! if the Motz & Wise correction is used
+        double dlnk_dlngamma;
     };
 
     //! Data for sticking reactions
     std::vector<StickData> m_stickingData;
 
+    //! Coverage dependency of the rate constant of reaction `rxn` on the
+    //! coverage of surface species `k`, with parameters as described for
+    //! SurfaceArrhenius
+    struct CoverageDerivative {
+        size_t rxn; //!< Reaction index
+        size_t k; //!< Index of the species within the surface phase
+        double a; //!< Exponential dependence of the pre-exponential factor
+        double m; //!< Power-law exponent
+        double E; //!< Activation energy dependence divided by the gas constant
+    };
+
+    //! Coverage dependencies of all reactions, used to evaluate derivatives
+    std::vector<CoverageDerivative> m_coverageDerivatives;
+
     void applyStickingCorrection(double T, double* kf);
 
     int m_ioFlag;
@@ -680,6 +733,18 @@ protected:
     //! Number of dimensions of reacting phase (2 for InterfaceKinetics, 1 for
     //! EdgeKinetics)
     size_t m_nDim;
+
+    //! @name Instrumented sections
+    //! Indices of the sections recorded by #m_instrumentation
+    //!@{
+    size_t m_sec_rop; //!< updateROP
+    size_t m_sec_rates_T; //!< _update_rates_T, which has no cache hits
+    size_t m_sec_rates_C; //!< _update_rates_C
+    size_t m_sec_Kc; //!< updateKc
+    size_t m_sec_arrhenius; //!< Surface Arrhenius rate constants
+    size_t m_sec_blowers_masel; //!< Blowers-Masel rate constants
+    size_t m_sec_stoich; //!< Concentration products in updateROP
+    //!@}
 };
 
 }
@@ -13,6 +13,7 @@
 
 #include "StoichManager.h"
 #include "cantera/base/ValueCache.h"
+#include "cantera/kinetics/KineticsInstrumentation.h"
 #include "cantera/kinetics/ReactionFactory.h"
 
 namespace Cantera
@@ -558,6 +559,144 @@ public:
      */
     virtual void getNetProductionRates(doublereal* wdot);
 
+    /**
+     * Species net production rates [kmol/m^3/s] for a batch of states. The
+     * default implementation is equivalent to setting the state of the phase
+     * using temperature, pressure and mass fractions and calling
+     * getNetProductionRates(double*) for each state in turn, which reuses
+     * intermediate results that only depend on temperature if consecutive
+     * states have the same temperature. Derived classes may evaluate the
+     * states simultaneously (see GasKinetics). After the call, the phase is
+     * left in the last state of the batch. Only available for kinetics
+     * managers associated with a single phase.
+     *
+     * @param nStates  Number of states
+     * @param T  Temperatures [K]. Length: nStates.
+     * @param P  Pressures [Pa]. Length: nStates.
+     * @param Y  Mass fractions, stored contiguously for each state.
+     *     Length: nStates * m_kk.
+     * @param wdot  Output array of net production rates, stored contiguously
+     *     for each state. Length: nStates * m_kk.
+     */
+    virtual void getNetProductionRates(size_t nStates, const double* T,
+                                       const double* P, const double* Y,
+                                       double* wdot);
+
+    //! @}
+    //! @name Routines to Calculate Derivatives (Jacobians)
+    /*!
+     * Derivatives are evaluated at the current state, using temperature and
+     * species concentrations as independent variables. Derivatives with respect
+     * to temperature hold all concentrations constant, and derivatives with
+     * respect to the concentration of species *k* hold temperature and the
+     * concentrations of all other species constant. Optional approximations
+     * are controlled via setDerivativeSettings().
+     * @{
+     */
+
+    //! Retrieve derivative settings.
+    /*!
+     * @param settings  AnyMap containing settings determining derivative evaluation.
+     */
+    virtual void getDerivativeSettings(AnyMap& settings) const {
+        throw NotImplementedError("Kinetics::getDerivativeSettings",
+            "Not implemented for kinetics type '{}'.", kineticsType());
+    }
+
+    //! Set/modify derivative settings.
+    /*!
+     * Supported keys depend on the kinetics manager; see
+     * GasKinetics::setDerivativeSettings.
+     *
+     * @param settings  AnyMap containing settings determining derivative evaluation.
+     */
+    virtual void setDerivativeSettings(const AnyMap& settings) {
+        throw NotImplementedError("Kinetics::setDerivativeSettings",
+            "Not implemented for kinetics type '{}'.", kineticsType());
+    }
+
+    /**
+     * Calculate derivatives of forward rates of progress with respect to
+     * temperature at constant concentrations.
+     *
+     * @param drop  Output vector of derivatives. Length: nReactions().
+     */
+    virtual void getFwdRatesOfProgress_ddT(double* drop) {
+        throw NotImplementedError("Kinetics::getFwdRatesOfProgress_ddT",
+            "Not implemented for kinetics type '{}'.", kineticsType());
+    }
+
+    /**
+     * Calculate derivatives of reverse rates of progress with respect to
+     * temperature at constant concentrations.
+     *
+     * @param drop  Output vector of derivatives. Length: nReactions().
+     */
+    virtual void getRevRatesOfProgress_ddT(double* drop) {
+        throw NotImplementedError("Kinetics::getRevRatesOfProgress_ddT",
+            "Not implemented for kinetics type '{}'.", kineticsType());
+    }
+
+    /**
+     * Calculate derivatives of net rates of progress with respect to
+     * temperature at constant concentrations.
+     *
+     * @param drop  Output vector of derivatives. Length: nReactions().
+     */
+    virtual void getNetRatesOfProgress_ddT(double* drop) {
+        throw NotImplementedError("Kinetics::getNetRatesOfProgress_ddT",
+            "Not implemented for kinetics type '{}'.", kineticsType());
+    }
+
+    /**
+     * Calculate derivatives of species net production rates with respect to
+     * temperature at constant concentrations.
+     *
+     * @param dwdot  Output vector of derivatives. Length: m_kk.
+     */
+    virtual void getNetProductionRates_ddT(double* dwdot);
+
+    /**
+     * Calculate derivatives of forward rates of progress with respect to
+     * species concentrations.
+     *
+     * @return  Sparse matrix with nReactions() rows and nTotalSpecies() columns.
+     */
+    virtual Eigen::SparseMatrix<double> fwdRatesOfProgress_ddC() {
+        throw NotImplementedError("Kinetics::fwdRatesOfProgress_ddC",
+            "Not implemented for kinetics type '{}'.", kineticsType());
+    }
+
+    /**
+     * Calculate derivatives of reverse rates of progress with respect to
+     * species concentrations.
+     *
+     * @return  Sparse matrix with nReactions() rows and nTotalSpecies() columns.
+     */
+    virtual Eigen::SparseMatrix<double> revRatesOfProgress_ddC() {
+        throw NotImplementedError("Kinetics::revRatesOfProgress_ddC",
+            "Not implemented for kinetics type '{}'.", kineticsType());
+    }
+
+    /**
+     * Calculate derivatives of net rates of progress with respect to species
+     * concentrations.
+     *
+     * @return  Sparse matrix with nReactions() rows and nTotalSpecies() columns.
+     */
+    virtual Eigen::SparseMatrix<double> netRatesOfProgress_ddC() {
+        throw NotImplementedError("Kinetics::netRatesOfProgress_ddC",
+            "Not implemented for kinetics type '{}'.", kineticsType());
+    }
+
+    /**
+     * Calculate derivatives of species net production rates with respect to
+     * species concentrations.
+     *
+     * @return  Sparse matrix with nTotalSpecies() rows and columns.
+     */
+    virtual Eigen::SparseMatrix<double> netProductionRates_ddC();
+
     //! @}
     //! @name Reaction Mechanism Informational Query Routines
     //! @{
@@ -761,7 +900,7 @@ public:
     //! Return the parameters for a phase definition which are needed to
     //! reconstruct an identical object using the newKinetics function. This
     //! excludes the reaction definitions, which are handled separately.
-    AnyMap parameters();
+    virtual AnyMap parameters();
 
     /**
      * Resize arrays with sizes that depend on the total number of species.
@@ -852,6 +991,37 @@ public:
 
     virtual void invalidateCache() {};
 
+    //! @}
+    //! @name Instrumentation
+    /*!
+     * Kinetics managers may count the calls and cache hits and measure the
+     * cumulative wall time of the sections of the rate evaluation, for example
+     * of each reaction rate evaluator or of the evaluation of equilibrium
+     * constants. Instrumentation is disabled by default.
+     * @{
+     */
+
+    //! Enable or disable instrumentation
+    void setInstrumentation(bool enabled) {
+        m_instrumentation.setEnabled(enabled);
+    }
+
+    //! `true` if instrumentation is enabled
+    bool instrumentationEnabled() const {
+        return m_instrumentation.enabled();
+    }
+
+    //! Reset all instrumentation counters to zero
+    void clearInstrumentation() {
+        m_instrumentation.clear();
+    }
+
+    //! Counters for all instrumented sections that have been called
+    //! @see KineticsInstrumentation::report
+    AnyMap instrumentationReport() const {
+        return m_instrumentation.report();
+    }
+
     //! @}
     //! Check for unmarked duplicate reactions and unmatched marked duplicates
     /**
@@ -887,6 +1057,9 @@ protected:
     //! Cache for saved calculations within each Kinetics object.
     ValueCache m_cache;
 
+    //! Counters and timers of instrumented sections
+    KineticsInstrumentation m_instrumentation;
+
     // Update internal rate-of-progress variables #m_ropf and #m_ropr.
     virtual void updateROP() {
         throw NotImplementedError("Kinetics::updateROP");
@@ -145,6 +145,11 @@ unique_ptr<Kinetics> newKinetics(const std::vector<ThermoPhase*>& phases,
 /*!
  * Add reactions to a Kinetics object
  *
+ * Reaction objects are created from their definitions using multiple threads
+ * for large mechanisms (see setReactionThreads()), and are added to the
+ * Kinetics object in the order of their definitions. Arrays depending on the
+ * number of reactions are resized once after all reactions have been added.
+ *
  * @param kin        The Kinetics object to be initialized
  * @param phaseNode  Phase entry for the phase where the reactions occur. This
  *     phase definition is used to determine the source of the reactions added
@@ -155,6 +160,13 @@ unique_ptr<Kinetics> newKinetics(const std::vector<ThermoPhase*>& phases,
 void addReactions(Kinetics& kin, const AnyMap& phaseNode,
                   const AnyMap& rootNode=AnyMap());
 
+//! Set the maximum number of threads used by addReactions() to create reaction
+//! objects. Each thread creates at least 100 reactions.
+//! @param n  Maximum number of threads, where zero (the default) uses the
+//!     number of concurrent threads supported by the hardware and one disables
+//!     parallel creation of reactions
+void setReactionThreads(size_t n);
+
 }
 
 #endif
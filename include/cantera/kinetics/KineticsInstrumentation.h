@@ -0,0 +1,125 @@
+/**
+ * @file KineticsInstrumentation.h
+ * Timing and cache-hit counters for kinetics managers
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_KINETICSINSTRUMENTATION_H
+#define CT_KINETICSINSTRUMENTATION_H
+
+#include "cantera/base/ct_defs.h"
+#include <chrono>
+
+namespace Cantera
+{
+
+class AnyMap;
+
+//! Counters for the number of calls, the number of cache hits and the
+//! cumulative wall time of sections of a kinetics manager's evaluation.
+/*!
+ * Instrumentation is disabled by default, in which case each instrumented
+ * section costs a single branch. Sections are registered by name once, and
+ * are subsequently referred to by their index. Sections may be nested, in
+ * which case the time of the inner section is included in that of the outer
+ * section.
+ *
+ * @code
+ *     size_t sec = instr.section("updateROP");
+ *     // ...
+ *     {
+ *         KineticsInstrumentation::Timer timer(instr, sec);
+ *         if (cached) {
+ *             instr.hit(sec);
+ *             return;
+ *         }
+ *         // ...
+ *     }
+ * @endcode
+ * @ingroup kineticsmgr
+ */
+class KineticsInstrumentation
+{
+public:
+    KineticsInstrumentation() : m_enabled(false) {}
+
+    //! Enable or disable recording
+    void setEnabled(bool enabled) {
+        m_enabled = enabled;
+    }
+
+    //! `true` if calls are recorded
+    bool enabled() const {
+        return m_enabled;
+    }
+
+    //! Index of the section named `name`, which is added if necessary
+    size_t section(const std::string& name);
+
+    //! Number of registered sections
+    size_t nSections() const {
+        return m_names.size();
+    }
+
+    //! Record that a call to section `i` returned cached results
+    void hit(size_t i) {
+        if (m_enabled) {
+            m_hits[i]++;
+        }
+    }
+
+    //! Record a call to section `i` that took `seconds`
+    void record(size_t i, double seconds) {
+        m_calls[i]++;
+        m_time[i] += seconds;
+    }
+
+    //! Reset all counters to zero. Registered sections are retained.
+    void clear();
+
+    //! Counters for all sections that have been called. Each entry is a map
+    //! with the fields `calls`, `cache-hits` and `time` (wall time in
+    //! seconds), and is keyed by the name of the section.
+    AnyMap report() const;
+
+    //! Records a call to a section and the wall time spent until the timer
+    //! goes out of scope
+    class Timer
+    {
+    public:
+        Timer(KineticsInstrumentation& instr, size_t section)
+            : m_instr(instr.enabled() ? &instr : nullptr)
+            , m_section(section)
+        {
+            if (m_instr) {
+                m_start = std::chrono::steady_clock::now();
+            }
+        }
+
+        ~Timer() {
+            if (m_instr) {
+                std::chrono::duration<double> dt =
+                    std::chrono::steady_clock::now() - m_start;
+                m_instr->record(m_section, dt.count());
+            }
+        }
+
+    private:
+        KineticsInstrumentation* m_instr;
+        size_t m_section;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+protected:
+    bool m_enabled;
+    std::vector<std::string> m_names; //!< Section names
+    std::vector<unsigned long> m_calls; //!< Number of calls of each section
+    std::vector<unsigned long> m_hits; //!< Number of cache hits of each section
+    vector_fp m_time; //!< Cumulative wall time [s] of each section
+};
+
+}
+
+#endif
@@ -10,11 +10,66 @@
 
 #include "ReactionRate.h"
 #include "MultiRateBase.h"
+#include "FalloffBatch.h"
+#include "PlogBatch.h"
+#include "ChebyshevBatch.h"
 #include "cantera/base/utilities.h"
+#include "cantera/numerics/funcs.h"
 
 namespace Cantera
 {
 
+class ArrheniusRate;
+class TroeRate;
+class SriRate;
+class PlogRate;
+class ChebyshevRate3;
+
+//! Placeholder for rate types without a batched evaluator
+struct NoRateBatch {};
+
+//! Evaluator used by MultiBulkRate to evaluate rate constants of all reactions
+//! of a given rate type at once. Batched evaluators implement the methods
+//! `clear()`, `add(size_t rxn, const RateType& rate)` and
+//! `bool getRateConstants(const DataType& shared_data, double* kf)`.
+template <class RateType>
+struct RateBatch
+{
+    typedef NoRateBatch type;
+};
+
+template <>
+struct RateBatch<TroeRate>
+{
+    typedef FalloffBatch type;
+};
+
+template <>
+struct RateBatch<SriRate>
+{
+    typedef FalloffBatch type;
+};
+
+template <>
+struct RateBatch<PlogRate>
+{
+    typedef PlogBatch type;
+};
+
+template <>
+struct RateBatch<ChebyshevRate3>
+{
+    typedef ChebyshevBatch type;
+};
+
+//! Flags rate types with a batched evaluator
+template <class RateType>
+struct UsesRateBatch
+{
+    static const bool value =
+        !std::is_same<typename RateBatch<RateType>::type, NoRateBatch>::value;
+};
+
 
 //! A class template handling all reaction rates specific to `BulkKinetics`.
 template <class RateType, class DataType>
@@ -22,6 +77,8 @@ class MultiBulkRate final : public MultiRateBase
 {
     CT_DEFINE_HAS_MEMBER(has_update, updateFromStruct)
     CT_DEFINE_HAS_MEMBER(has_ddT, ddTFromStruct)
+    CT_DEFINE_HAS_MEMBER(has_ddP, perturbPressure)
+    CT_DEFINE_HAS_MEMBER(has_ddM, perturbThirdBodies)
 
 public:
     virtual std::string type() override {
@@ -34,8 +91,10 @@ public:
 
     virtual void add(const size_t rxn_index, ReactionRate& rate) override {
         m_indices[rxn_index] = m_rxn_rates.size();
+        m_active.push_back(m_rxn_rates.size());
         m_rxn_rates.emplace_back(rxn_index, dynamic_cast<RateType&>(rate));
         m_shared.invalidateCache();
+        m_params_current = false;
     }
 
     virtual bool replace(const size_t rxn_index, ReactionRate& rate) override {
@@ -50,6 +109,7 @@ public:
                  "with a new rate of type '{}'.", type(), rate.type());
         }
         m_shared.invalidateCache();
+        m_params_current = false;
         if (m_indices.find(rxn_index) != m_indices.end()) {
             size_t j = m_indices[rxn_index];
             m_rxn_rates.at(j).second = dynamic_cast<RateType&>(rate);
@@ -63,29 +123,43 @@ public:
         m_shared.invalidateCache();
     }
 
-    virtual void getRateConstants(double* kf) override {
-        for (auto& rxn : m_rxn_rates) {
-            kf[rxn.first] = rxn.second.evalFromStruct(m_shared);
+    virtual void setActiveReactions(const std::vector<bool>& active) override {
+        m_active.clear();
+        for (size_t j = 0; j < m_rxn_rates.size(); j++) {
+            if (active.empty() || active[m_rxn_rates[j].first]) {
+                m_active.push_back(j);
+            }
         }
+        m_shared.invalidateCache();
+        m_params_current = false;
+    }
+
+    virtual void getRateConstants(double* kf) override {
+        _getRateConstants(kf);
+    }
+
+    virtual void getRateConstants(size_t nStates, const double* T,
+                                  double* kf) override {
+        _getRateConstants(nStates, T, kf);
     }
 
     virtual void update(double T) override {
         // update common data once for each reaction type
         m_shared.update(T);
-        _updateRates();
+        _update();
     }
 
     virtual void update(double T, double P) override {
         // update common data once for each reaction type
         m_shared.update(T, P);
-        _updateRates();
+        _update();
     }
 
     virtual bool update(const ThermoPhase& bulk, const Kinetics& kin) override {
         // update common data once for each reaction type
         std::pair<bool, bool> changed = m_shared.update(bulk, kin);
         if (changed.first) {
-            _updateRates();
+            _update();
         }
         return changed.second;
     }
@@ -104,14 +178,255 @@ public:
         return _get_ddT(R);
     }
 
+    virtual void processRateConstants_ddT(double* rop, const double* kf,
+                                          double deltaT) override
+    {
+        _process_ddT(rop, kf, deltaT);
+    }
+
+    virtual void processRateConstants_ddP(double* rop, const double* kf,
+                                          double deltaP) override
+    {
+        _process_ddP(rop, kf, deltaP);
+    }
+
+    virtual void processRateConstants_ddM(double* rop, const double* kf,
+                                          double deltaM) override
+    {
+        _process_ddM(rop, kf, deltaM);
+    }
+
 protected:
+    //! Helper function to evaluate rate constants of generic rate types
+    template <typename T=RateType, typename std::enable_if<!std::is_same<T, ArrheniusRate>::value && !UsesRateBatch<T>::value, bool>::type = true>
+    void _getRateConstants(double* kf) {
+        for (size_t j : m_active) {
+            auto& rxn = m_rxn_rates[j];
+            kf[rxn.first] = rxn.second.evalFromStruct(m_shared);
+        }
+    }
+
+    //! Helper function to evaluate rate constants of all reactions at once
+    //! using the batched evaluator of the rate type. As reaction-specific data
+    //! are not updated by update(), they are updated here if the batched
+    //! evaluator is unable to handle the current shared data.
+    template <typename T=RateType, typename std::enable_if<UsesRateBatch<T>::value, bool>::type = true>
+    void _getRateConstants(double* kf) {
+        if (!m_params_current) {
+            m_batch.clear();
+            for (size_t j : m_active) {
+                m_batch.add(m_rxn_rates[j].first, m_rxn_rates[j].second);
+            }
+            m_params_current = true;
+        }
+        if (!m_batch.getRateConstants(m_shared, kf)) {
+            _updateRates();
+            for (size_t j : m_active) {
+                auto& rxn = m_rxn_rates[j];
+                kf[rxn.first] = rxn.second.evalFromStruct(m_shared);
+            }
+        }
+    }
+
+    //! Helper function to evaluate rate constants of `ArrheniusRate` objects.
+    //! Rate parameters are stored in contiguous arrays, which allows for the
+    //! exponentials to be evaluated using vectorized instructions. Reactions
+    //! with identical temperature exponents and activation energies share the
+    //! same exponential, which is evaluated once and scaled by the
+    //! pre-exponential factor of each reaction.
+    template <typename T=RateType, typename std::enable_if<std::is_same<T, ArrheniusRate>::value, bool>::type = true>
+    void _getRateConstants(double* kf) {
+        size_t nRates = m_active.size();
+        _updateArrheniusParams();
+        double logT = m_shared.logT;
+        double recipT = m_shared.recipT;
+        size_t nTerms = m_b.size();
+        for (size_t n = 0; n < nTerms; n++) {
+            m_work[n] = m_b[n] * logT - m_Ea_R[n] * recipT;
+        }
+        vectorExp(m_work.data(), m_work.data(), nTerms);
+        for (size_t i = 0; i < nRates; i++) {
+            kf[m_rxn_rates[m_active[i]].first] = m_A[i] * m_work[m_term[i]];
+        }
+    }
+
+    //! Helper function to evaluate rate constants of rate types without a
+    //! batched evaluation for several temperatures
+    template <typename T=RateType, typename std::enable_if<!std::is_same<T, ArrheniusRate>::value, bool>::type = true>
+    void _getRateConstants(size_t nStates, const double* temp, double* kf) {
+        MultiRateBase::getRateConstants(nStates, temp, kf);
+    }
+
+    //! Helper function to evaluate rate constants of `ArrheniusRate` objects
+    //! for several temperatures. The exponentials of all distinct terms are
+    //! evaluated for all states in a single call to vectorExp().
+    template <typename T=RateType, typename std::enable_if<std::is_same<T, ArrheniusRate>::value, bool>::type = true>
+    void _getRateConstants(size_t nStates, const double* temp, double* kf) {
+        size_t nRates = m_active.size();
+        _updateArrheniusParams();
+        size_t nTerms = m_b.size();
+        m_batch_logT.resize(2 * nStates);
+        double* logT = m_batch_logT.data();
+        double* recipT = logT + nStates;
+        for (size_t j = 0; j < nStates; j++) {
+            logT[j] = std::log(temp[j]);
+            recipT[j] = 1.0 / temp[j];
+        }
+        m_batch_work.resize(nTerms * nStates);
+        for (size_t n = 0; n < nTerms; n++) {
+            double* work = m_batch_work.data() + n * nStates;
+            double b = m_b[n];
+            double Ea_R = m_Ea_R[n];
+            for (size_t j = 0; j < nStates; j++) {
+                work[j] = b * logT[j] - Ea_R * recipT[j];
+            }
+        }
+        vectorExp(m_batch_work.data(), m_batch_work.data(), nTerms * nStates);
+        for (size_t i = 0; i < nRates; i++) {
+            double* k = kf + m_rxn_rates[m_active[i]].first * nStates;
+            const double* work = m_batch_work.data() + m_term[i] * nStates;
+            double A = m_A[i];
+            for (size_t j = 0; j < nStates; j++) {
+                k[j] = A * work[j];
+            }
+        }
+    }
+
+    //! Update the contiguous parameter arrays of `ArrheniusRate` objects
+    template <typename T=RateType, typename std::enable_if<std::is_same<T, ArrheniusRate>::value, bool>::type = true>
+    void _updateArrheniusParams() {
+        if (!m_params_current) {
+            size_t nRates = m_active.size();
+            m_A.resize(nRates);
+            m_term.resize(nRates);
+            m_b.clear();
+            m_Ea_R.clear();
+            std::map<std::pair<double, double>, size_t> terms;
+            for (size_t i = 0; i < nRates; i++) {
+                const RateType& rate = m_rxn_rates[m_active[i]].second;
+                m_A[i] = rate.preExponentialFactor();
+                auto key = std::make_pair(rate.temperatureExponent(),
+                                          rate.activationEnergy_R());
+                auto iter = terms.find(key);
+                if (iter == terms.end()) {
+                    iter = terms.emplace(key, m_b.size()).first;
+                    m_b.push_back(key.first);
+                    m_Ea_R.push_back(key.second);
+                }
+                m_term[i] = iter->second;
+            }
+            m_work.resize(m_b.size());
+            m_params_current = true;
+        }
+    }
+
+    //! Helper function to process temperature derivatives for rate types that
+    //! implement the `ddTFromStruct` method, which are evaluated analytically
+    template <typename T=RateType, typename std::enable_if<has_ddT<T>::value, bool>::type = true>
+    void _process_ddT(double* rop, const double* kf, double deltaT) {
+        if (UsesRateBatch<RateType>::value) {
+            // reaction-specific data are not updated for batched rate types
+            _updateRates();
+        }
+        for (size_t j : m_active) {
+            auto& rxn = m_rxn_rates[j];
+            if (kf[rxn.first] != 0.) {
+                rop[rxn.first] *= rxn.second.ddTFromStruct(m_shared) / kf[rxn.first];
+            } else {
+                rop[rxn.first] = 0.;
+            }
+        }
+    }
+
+    //! Helper function to process temperature derivatives for rate types that
+    //! do not implement the `ddTFromStruct` method, which are evaluated from a
+    //! perturbation of the shared data
+    template <typename T=RateType, typename std::enable_if<!has_ddT<T>::value, bool>::type = true>
+    void _process_ddT(double* rop, const double* kf, double deltaT) {
+        double dTinv = 1. / (m_shared.temperature * deltaT);
+        m_shared.perturbTemperature(deltaT);
+        _updateRates();
+        _scaleDerivatives(rop, kf, dTinv);
+        m_shared.restore();
+        _updateRates();
+    }
+
+    //! Scale `rop` by the relative change of rate constants with respect to the
+    //! unperturbed values `kf`, divided by the perturbation
+    void _scaleDerivatives(double* rop, const double* kf, double dInv) {
+        for (size_t j : m_active) {
+            auto& rxn = m_rxn_rates[j];
+            if (kf[rxn.first] != 0.) {
+                double k1 = rxn.second.evalFromStruct(m_shared);
+                rop[rxn.first] *= dInv * (k1 / kf[rxn.first] - 1.);
+            } else {
+                rop[rxn.first] = 0.;
+            }
+        }
+    }
+
+    //! Zero out entries for rate types without a dependence on a perturbed
+    //! quantity
+    void _zeroDerivatives(double* rop) {
+        for (auto& rxn : m_rxn_rates) {
+            rop[rxn.first] = 0.;
+        }
+    }
+
+    //! Helper function to process pressure derivatives for data types that
+    //! implement the `perturbPressure` method.
+    template <typename T=DataType, typename std::enable_if<has_ddP<T>::value, bool>::type = true>
+    void _process_ddP(double* rop, const double* kf, double deltaP) {
+        m_shared.perturbPressure(deltaP);
+        _updateRates();
+        _scaleDerivatives(rop, kf, 1. / deltaP);
+        m_shared.restore();
+        _updateRates();
+    }
+
+    //! Helper function for data types that do not implement `perturbPressure`
+    template <typename T=DataType, typename std::enable_if<!has_ddP<T>::value, bool>::type = true>
+    void _process_ddP(double* rop, const double* kf, double deltaP) {
+        _zeroDerivatives(rop);
+    }
+
+    //! Helper function to process third-body derivatives for data types that
+    //! implement the `perturbThirdBodies` method.
+    template <typename T=DataType, typename std::enable_if<has_ddM<T>::value, bool>::type = true>
+    void _process_ddM(double* rop, const double* kf, double deltaM) {
+        m_shared.perturbThirdBodies(deltaM);
+        _updateRates();
+        _scaleDerivatives(rop, kf, 1. / deltaM);
+        m_shared.restore();
+        _updateRates();
+    }
+
+    //! Helper function for data types that do not implement `perturbThirdBodies`
+    template <typename T=DataType, typename std::enable_if<!has_ddM<T>::value, bool>::type = true>
+    void _process_ddM(double* rop, const double* kf, double deltaM) {
+        _zeroDerivatives(rop);
+    }
+
+    //! Helper function to update reaction-specific data after the shared data
+    //! have changed
+    template <typename T=RateType, typename std::enable_if<!UsesRateBatch<T>::value, bool>::type = true>
+    void _update() {
+        _updateRates();
+    }
+
+    //! Helper function for rate types with a batched evaluator, where all
+    //! quantities are evaluated by getRateConstants()
+    template <typename T=RateType, typename std::enable_if<UsesRateBatch<T>::value, bool>::type = true>
+    void _update() {
+    }
+
     //! Helper function to update rates that have an `updateFromStruct` method
     template <typename T=RateType, typename std::enable_if<has_update<T>::value, bool>::type = true>
     void _updateRates() {
         // Update reaction-specific data for each reaction. This loop is efficient as
         // all calls are de-virtualized and all rate objects are contiguous in memory
-        for (auto& rxn : m_rxn_rates) {
-            rxn.second.updateFromStruct(m_shared);
+        for (size_t j : m_active) {
+            m_rxn_rates[j].second.updateFromStruct(m_shared);
         }
     }
 
@@ -149,7 +464,30 @@ protected:
     //! Vector of pairs of reaction rates indices and reaction rates
     std::vector<std::pair<size_t, RateType>> m_rxn_rates;
     std::map<size_t, size_t> m_indices; //! Mapping of indices
+
+    //! Positions of active reactions within #m_rxn_rates. Rate constants and
+    //! derivatives are only evaluated for these reactions.
+    std::vector<size_t> m_active;
     DataType m_shared;
+
+    //! @name Contiguous copies of rate parameters
+    //! Only used by rate types with a vectorized implementation of
+    //! getRateConstants()
+    //! @{
+    vector_fp m_A; //!< Pre-exponential factors
+    vector_fp m_b; //!< Distinct temperature exponents
+    vector_fp m_Ea_R; //!< Distinct activation energies (in temperature units)
+    //! Index of the distinct pair of temperature exponent and activation
+    //! energy in #m_b and #m_Ea_R used by each reaction
+    std::vector<size_t> m_term;
+    vector_fp m_work; //!< Work array
+    vector_fp m_batch_logT; //!< Logarithms and reciprocals of batch temperatures
+    vector_fp m_batch_work; //!< Work array for batches of temperatures
+    bool m_params_current = false; //!< True if the parameter arrays are up to date
+    //! @}
+
+    //! Batched evaluator, if available for the rate type
+    typename RateBatch<RateType>::type m_batch;
 };
 
 }
@@ -9,6 +9,7 @@
 #define CT_MULTIRATEBASE_H
 
 #include "cantera/base/ct_defs.h"
+#include "cantera/base/ctexceptions.h"
 
 namespace Cantera
 {
@@ -51,10 +52,31 @@ public:
     //! @param n_reactions  number of reactions
     virtual void resize(size_t n_species, size_t n_reactions) = 0;
 
+    //! Restrict the evaluation of rate constants to a subset of reactions
+    //! @param active  flags indicating active reactions, indexed by the
+    //!     reaction index; an empty vector activates all reactions
+    virtual void setActiveReactions(const std::vector<bool>& active) = 0;
+
     //! Evaluate all rate constants handled by the evaluator
     //! @param kf  array of rate constants
     virtual void getRateConstants(double* kf) = 0;
 
+    //! Evaluate all rate constants handled by the evaluator for a batch of
+    //! temperatures
+    /*!
+     * Only available for rate types that depend on temperature alone. Shared
+     * data used by getRateConstants(double*) are not modified.
+     *
+     * @param nStates  number of states
+     * @param T  temperatures [K]; length `nStates`
+     * @param kf  array of rate constants, where the rate constant of reaction
+     *     `i` for state `j` is stored at index `i*nStates + j`
+     */
+    virtual void getRateConstants(size_t nStates, const double* T, double* kf) {
+        throw NotImplementedError("MultiRateBase::getRateConstants",
+            "Batch evaluation is not implemented for rate type '{}'.", type());
+    }
+
     //! Update common reaction rate data based on temperature
     //! @param T  temperature [K]
     virtual void update(double T) = 0;
@@ -76,6 +98,51 @@ public:
     //! Get the derivative of the rate with respect to temperature for a single
     //! reaction. Used to implement ReactionRate::ddT.
     virtual double ddTSingle(ReactionRate& rate) = 0;
+
+    //! Scale rates of progress by the temperature derivatives of the rate
+    //! constants
+    /*!
+     * For all reactions handled by the evaluator, `rop[i]` is multiplied by
+     * \f$ (\partial k_i / \partial T) / k_i \f$ at constant pressure and
+     * third-body concentrations. The derivative is evaluated analytically for
+     * rate types that implement `ddTFromStruct`, and numerically from a
+     * perturbation of the shared data otherwise.
+     *
+     * @param rop  array of rates of progress (or other quantities to be scaled)
+     * @param kf  array of current rate constants
+     * @param deltaT  relative temperature perturbation
+     */
+    virtual void processRateConstants_ddT(double* rop, const double* kf,
+                                          double deltaT) = 0;
+
+    //! Scale rates of progress by the pressure derivatives of the rate constants
+    /*!
+     * For all reactions handled by the evaluator, `rop[i]` is multiplied by
+     * \f$ \partial \ln k_i / \partial \ln P \f$ at constant temperature;
+     * entries are set to zero for rate types that do not depend on pressure.
+     *
+     * @param rop  array of rates of progress (or other quantities to be scaled)
+     * @param kf  array of current rate constants
+     * @param deltaP  relative pressure perturbation
+     */
+    virtual void processRateConstants_ddP(double* rop, const double* kf,
+                                          double deltaP) = 0;
+
+    //! Scale rates of progress by the third-body derivatives of the rate constants
+    /*!
+     * For all reactions handled by the evaluator, `rop[i]` is multiplied by
+     * \f$ \partial \ln k_i / \partial \ln [M]_i \f$ at constant temperature,
+     * where \f$ [M]_i \f$ is the effective third-body concentration entering
+     * the rate expression (for example, the reduced pressure of falloff
+     * reactions); entries are set to zero for rate types that do not depend on
+     * third-body concentrations.
+     *
+     * @param rop  array of rates of progress (or other quantities to be scaled)
+     * @param kf  array of current rate constants
+     * @param deltaM  relative third-body perturbation
+     */
+    virtual void processRateConstants_ddM(double* rop, const double* kf,
+                                          double deltaM) = 0;
 };
 
 } // end namespace Cantera
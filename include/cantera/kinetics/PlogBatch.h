@@ -0,0 +1,91 @@
+/**
+ * @file PlogBatch.h
+ * Batched evaluation of pressure-dependent Arrhenius (P-log) rate constants
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_PLOGBATCH_H
+#define CT_PLOGBATCH_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+struct PlogData;
+class PlogRate;
+
+//! Batched evaluation of rate constants of P-log reactions.
+/*!
+ * Reactions are grouped by their pressure grids, which are often shared by
+ * many reactions of a mechanism. The bracketing pressures and the
+ * interpolation weight are determined once per group whenever the pressure
+ * changes. Parameters of all Arrhenius expressions are stored in flat arrays,
+ * and the expressions at the bracketing pressures of all reactions are
+ * evaluated at once using vectorExp() and vectorLog().
+ * @ingroup chemkinetics
+ */
+class PlogBatch
+{
+public:
+    PlogBatch();
+
+    //! Discard all reactions
+    void clear();
+
+    //! Add a P-log reaction
+    void add(size_t rxn, const PlogRate& rate);
+
+    //! Evaluate rate constants of all reactions.
+    /*!
+     * @param data  Shared data of the P-log reactions
+     * @param kf  Rate constants, where values are written at the positions of
+     *     the reaction indices
+     * @returns `true`, as batched evaluation is always possible
+     */
+    bool getRateConstants(const PlogData& data, double* kf);
+
+    //! Number of distinct pressure grids
+    size_t nGroups() const {
+        return m_grids.size();
+    }
+
+protected:
+    //! Determine the bracketing pressures of each pressure grid
+    void updatePressure(double logP);
+
+    //! Natural logarithms of the pressures of each grid, including the
+    //! entries at the lower and upper bound used for extrapolation
+    std::vector<vector_fp> m_grids;
+
+    //! Index of the lower bracketing pressure within each grid
+    std::vector<size_t> m_bracket;
+
+    //! Interpolation weight of the upper bracketing pressure for each grid
+    vector_fp m_weight;
+
+    std::vector<size_t> m_rxn; //!< Reaction indices
+    std::vector<size_t> m_group; //!< Pressure grid of each reaction
+
+    //! Index ranges of the Arrhenius expressions of each reaction for each
+    //! entry of the reaction's pressure grid, where the expressions of entry
+    //! `j` of reaction `i` are located at `m_ranges[i][j].first` to
+    //! `m_ranges[i][j].second - 1`.
+    std::vector<std::vector<std::pair<size_t, size_t>>> m_ranges;
+
+    //! @name Parameters of all Arrhenius expressions
+    //! @{
+    vector_fp m_A, m_b, m_Ea_R;
+    //! @}
+
+    double m_logP; //!< Pressure at which brackets were determined
+
+    vector_fp m_work; //!< Work array for Arrhenius expressions
+    vector_fp m_logk; //!< Work array for log(k) at the bracketing pressures
+};
+
+}
+
+#endif
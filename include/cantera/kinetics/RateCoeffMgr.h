@@ -33,12 +33,14 @@ public:
         m_rxn.push_back(rxnNumber);
         m_rates.push_back(rate);
         m_indices[rxnNumber] = m_rxn.size() - 1;
+        m_terms_current = false;
     }
 
     //! Replace an existing rate coefficient calculator
     void replace(size_t rxnNumber, const R& rate) {
         size_t i = m_indices[rxnNumber];
         m_rates[i] = rate;
+        m_terms_current = false;
     }
 
     /**
@@ -69,6 +71,32 @@ public:
         }
     }
 
+    /**
+     * Write the derivatives of the natural logarithms of the rate coefficients
+     * with respect to temperature into array values, at the locations specified
+     * by the reaction numbers. Requires the rate type to implement method
+     * `ddTScaled`.
+     */
+    void update_ddT(double T, double logT, double* values) {
+        double recipT = 1.0/T;
+        for (size_t i = 0; i != m_rates.size(); i++) {
+            values[m_rxn[i]] = m_rates[i].ddTScaled(logT, recipT);
+        }
+    }
+
+    /**
+     * Write the derivatives of the natural logarithms of the rate coefficients
+     * with respect to the natural logarithm of pressure into array values, at
+     * the locations specified by the reaction numbers. Requires the rate type
+     * to implement method `ddPScaled`.
+     */
+    void update_ddP(double T, double logT, double* values) {
+        double recipT = 1.0/T;
+        for (size_t i = 0; i != m_rates.size(); i++) {
+            values[m_rxn[i]] = m_rates[i].ddPScaled(logT, recipT);
+        }
+    }
+
     void updateBlowersMasel(double T, double logT, double* values, double* deltaH) {
         double recipT = 1.0/T;
         for (size_t i=0; i != m_rates.size(); i++) {
@@ -80,6 +108,11 @@ public:
         return m_rates.size();
     }
 
+    //! Indices of the reactions handled by this rate coefficient manager
+    const std::vector<size_t>& reactionIndices() const {
+        return m_rxn;
+    }
+
     //! Return effective preexponent for the specified reaction.
     /*!
      *  Returns effective preexponent, accounting for surface coverage
@@ -119,13 +152,63 @@ public:
     }
 
 protected:
+    //! Find the distinct pairs of temperature exponent and activation energy
+    //! of all rates. Only used for rate types specializing update().
+    void findDistinctTerms() {
+        std::map<std::pair<double, double>, size_t> terms;
+        m_term.resize(m_rates.size());
+        m_term_b.clear();
+        m_term_Ea_R.clear();
+        for (size_t i = 0; i != m_rates.size(); i++) {
+            auto key = std::make_pair(m_rates[i].temperatureExponent(),
+                                      m_rates[i].activationEnergy_R());
+            auto iter = terms.find(key);
+            if (iter == terms.end()) {
+                iter = terms.emplace(key, m_term_b.size()).first;
+                m_term_b.push_back(key.first);
+                m_term_Ea_R.push_back(key.second);
+            }
+            m_term[i] = iter->second;
+        }
+        m_term_exp.resize(m_term_b.size());
+        m_terms_current = true;
+    }
+
     std::vector<R> m_rates;
     std::vector<size_t> m_rxn;
 
     //! map reaction number to index in m_rxn / m_rates
     std::map<size_t, size_t> m_indices;
+
+    //! @name Distinct temperature-dependent terms
+    //! @{
+    bool m_terms_current = false; //!< True if the terms are up to date
+    std::vector<size_t> m_term; //!< Index of the term used by each rate
+    vector_fp m_term_b; //!< Temperature exponents
+    vector_fp m_term_Ea_R; //!< Activation energies (in temperature units)
+    vector_fp m_term_exp; //!< Values of the terms
+    //! @}
 };
 
+//! Evaluate rate constants of Arrhenius rates, where the term
+//! \f$ T^b \exp(-E_a/RT) \f$ is evaluated once for each distinct pair of
+//! temperature exponent and activation energy and scaled by the
+//! pre-exponential factor of each reaction.
+template<>
+inline void Rate1<Arrhenius2>::update(double T, double logT, double* values)
+{
+    if (!m_terms_current) {
+        findDistinctTerms();
+    }
+    double recipT = 1.0/T;
+    for (size_t n = 0; n != m_term_b.size(); n++) {
+        m_term_exp[n] = std::exp(m_term_b[n]*logT - m_term_Ea_R[n]*recipT);
+    }
+    for (size_t i = 0; i != m_rates.size(); i++) {
+        values[m_rxn[i]] = m_rates[i].preExponentialFactor() * m_term_exp[m_term[i]];
+    }
+}
+
 }
 
 #endif
@@ -0,0 +1,119 @@
+/**
+ * @file RateTable.h
+ * Tabulation of temperature-dependent rate data
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_RATETABLE_H
+#define CT_RATETABLE_H
+
+#include "cantera/base/ct_defs.h"
+#include <functional>
+
+namespace Cantera
+{
+
+//! Table of positive temperature-dependent quantities on a uniform grid in 1/T
+/*!
+ * The natural logarithms of the quantities are tabulated, which vary smoothly
+ * with 1/T for rate constants and equilibrium constants, and are
+ * interpolated using cubic Hermite polynomials, where slopes are obtained from
+ * fourth-order central differences of values at neighboring grid points. As
+ * all quantities share the same grid, interpolation amounts to a weighted sum
+ * of four contiguous rows of the table (values and slopes at the two
+ * enclosing grid points), after which the interpolated logarithms are
+ * exponentiated using vectorExp().
+ *
+ * The number of grid points is doubled until the absolute interpolation error
+ * of the logarithms, which approximates the relative error of the quantities,
+ * is below the requested tolerance at the midpoints between grid points for
+ * all quantities.
+ * @ingroup kinetics
+ */
+class RateTable
+{
+public:
+    //! Function evaluating the natural logarithms of all tabulated quantities
+    //! at temperature `T`
+    typedef std::function<void(double T, double* values)> Evaluator;
+
+    RateTable();
+
+    //! Build the table.
+    /*!
+     * @param Tmin  Lower bound of the temperature range [K]
+     * @param Tmax  Upper bound of the temperature range [K]
+     * @param nValues  Number of tabulated quantities
+     * @param eval  Function evaluating the logarithms of all quantities at a
+     *     given temperature
+     * @param rtol  Maximum relative interpolation error
+     * @param maxPoints  Maximum number of grid points
+     */
+    void build(double Tmin, double Tmax, size_t nValues, const Evaluator& eval,
+               double rtol, size_t maxPoints);
+
+    //! Discard the table
+    void clear();
+
+    //! Return `true` if a table has been built
+    bool ready() const {
+        return m_nPoints != 0;
+    }
+
+    //! Return `true` if `T` is within the tabulated range
+    bool inRange(double T) const {
+        return m_nPoints && T >= m_Tmin && T <= m_Tmax;
+    }
+
+    //! Interpolate all quantities at temperature `T`, which needs to be within
+    //! the tabulated range.
+    void interpolate(double T, double* values) const;
+
+    //! Interpolate the logarithms of all quantities at temperature `T`, which
+    //! needs to be within the tabulated range.
+    void interpolateLog(double T, double* logValues) const;
+
+    //! Number of grid points within the tabulated range
+    size_t nPoints() const {
+        return m_nPoints;
+    }
+
+    //! Maximum relative interpolation error estimated while building the table
+    double maxError() const {
+        return m_maxError;
+    }
+
+    double minTemp() const {
+        return m_Tmin;
+    }
+
+    double maxTemp() const {
+        return m_Tmax;
+    }
+
+protected:
+    //! Fill the table for the current grid
+    void fill(const Evaluator& eval);
+
+    //! Estimate the maximum relative error at the midpoints of the grid
+    double midpointError(const Evaluator& eval);
+
+    double m_Tmin; //!< Lower bound of the temperature range
+    double m_Tmax; //!< Upper bound of the temperature range
+    double m_xmin; //!< 1/Tmax
+    double m_dx; //!< Spacing of the grid in 1/T
+    size_t m_nValues; //!< Number of tabulated quantities
+    size_t m_nPoints; //!< Number of grid points (excluding ghost points)
+    double m_maxError; //!< Estimated maximum relative error
+
+    //! Tabulated data. For each grid point, the logarithms of the `m_nValues`
+    //! quantities are followed by the corresponding slopes with respect to the normalized coordinate
+    //! `(1/T - 1/Tmax) / m_dx`.
+    vector_fp m_data;
+};
+
+}
+
+#endif
@@ -24,7 +24,7 @@ class Kinetics;
  */
 struct ArrheniusData
 {
-    ArrheniusData() : temperature(1.), logT(0.), recipT(1.) {}
+    ArrheniusData() : temperature(1.), logT(0.), recipT(1.), m_temperature_buf(-1.) {}
 
     //! Update data container based on temperature *T*
     void update(double T) {
@@ -54,9 +54,22 @@ struct ArrheniusData
         temperature = NAN;
     }
 
+    //! Perturb temperature of data container
+    /*!
+     * The original state is restored by calling restore().
+     * @param deltaT  relative temperature perturbation
+     */
+    void perturbTemperature(double deltaT);
+
+    //! Restore data container after a perturbation
+    void restore();
+
     double temperature; //!< temperature
     double logT; //!< logarithm of temperature
     double recipT;  //!< inverse of temperature
+
+protected:
+    double m_temperature_buf; //!< buffered temperature
 };
 
 
@@ -91,6 +104,17 @@ struct BlowersMaselData
         temperature = NAN;
     }
 
+    //! Perturb temperature of data container
+    /*!
+     * Enthalpies of reaction are held constant. The original state is restored
+     * by calling restore().
+     * @param deltaT  relative temperature perturbation
+     */
+    void perturbTemperature(double deltaT);
+
+    //! Restore data container after a perturbation
+    void restore();
+
     double temperature; //!< temperature
     double logT; //!< logarithm of temperature
     double recipT; //!< inverse of temperature
@@ -103,6 +127,7 @@ struct BlowersMaselData
 
 protected:
     vector_fp m_grt; //!< work vector holding partial molar enthalpies
+    double m_temperature_buf; //!< buffered temperature
 };
 
 
@@ -113,7 +138,8 @@ protected:
  */
 struct FalloffData : public ArrheniusData
 {
-    FalloffData() : finalized(false), molar_density(NAN), state_mf_number(-1) {}
+    FalloffData() : finalized(false), molar_density(NAN), state_mf_number(-1),
+        m_perturbed(false) {}
 
     //! Update data container based on *bulk* phase state and *kin* kinetics
     std::pair<bool, bool> update(const ThermoPhase& bulk, const Kinetics& kin);
@@ -130,10 +156,24 @@ struct FalloffData : public ArrheniusData
         molar_density = NAN;
     }
 
+    //! Perturb third-body concentrations of data container
+    /*!
+     * The original state is restored by calling restore().
+     * @param deltaM  relative third-body perturbation
+     */
+    void perturbThirdBodies(double deltaM);
+
+    //! Restore data container after a perturbation
+    void restore();
+
     bool finalized; //!< boolean indicating whether vectors are accessible
     vector_fp conc_3b; //!< vector of effective third-body concentrations
     double molar_density; //!< used to determine if updates are needed
     int state_mf_number; //!< integer that is incremented when composition changes
+
+protected:
+    bool m_perturbed; //!< boolean indicating whether third-bodies are perturbed
+    vector_fp m_conc_3b_buf; //!< buffered third-body concentrations
 };
 
 
@@ -144,7 +184,8 @@ struct FalloffData : public ArrheniusData
  */
 struct PlogData
 {
-    PlogData() : temperature(1.), logT(0.), recipT(1.), pressure(NAN), logP(0.) {}
+    PlogData() : temperature(1.), logT(0.), recipT(1.), pressure(NAN), logP(0.),
+        m_temperature_buf(-1.), m_pressure_buf(-1.) {}
 
     //! Update data container based on temperature *T* (raises exception)
     void update(double T);
@@ -169,11 +210,32 @@ struct PlogData
         pressure = NAN;
     }
 
+    //! Perturb temperature of data container
+    /*!
+     * The original state is restored by calling restore().
+     * @param deltaT  relative temperature perturbation
+     */
+    void perturbTemperature(double deltaT);
+
+    //! Perturb pressure of data container
+    /*!
+     * The original state is restored by calling restore().
+     * @param deltaP  relative pressure perturbation
+     */
+    void perturbPressure(double deltaP);
+
+    //! Restore data container after a perturbation
+    void restore();
+
     double temperature; //!< temperature
     double logT; //!< logarithm of temperature
     double recipT; //!< inverse of temperature
     double pressure; //!< Pressure [Pa]
     double logP; //!< logarithm of pressure
+
+protected:
+    double m_temperature_buf; //!< buffered temperature
+    double m_pressure_buf; //!< buffered pressure
 };
 
 
@@ -184,7 +246,8 @@ struct PlogData
  */
 struct ChebyshevData
 {
-    ChebyshevData() : temperature(1.), recipT(1.), pressure(NAN), log10P(0.) {}
+    ChebyshevData() : temperature(1.), recipT(1.), pressure(NAN), log10P(0.),
+        m_temperature_buf(-1.), m_pressure_buf(-1.) {}
 
     //! Update data container based on temperature *T* (raises exception)
     void update(double T);
@@ -209,17 +272,38 @@ struct ChebyshevData
         pressure = NAN;
     }
 
+    //! Perturb temperature of data container
+    /*!
+     * The original state is restored by calling restore().
+     * @param deltaT  relative temperature perturbation
+     */
+    void perturbTemperature(double deltaT);
+
+    //! Perturb pressure of data container
+    /*!
+     * The original state is restored by calling restore().
+     * @param deltaP  relative pressure perturbation
+     */
+    void perturbPressure(double deltaP);
+
+    //! Restore data container after a perturbation
+    void restore();
+
     double temperature; //!< temperature
     double recipT; //!< inverse of temperature
     double pressure; //!< Pressure [Pa]
     double log10P; //!< base 10 logarithm of pressure
+
+protected:
+    double m_temperature_buf; //!< buffered temperature
+    double m_pressure_buf; //!< buffered pressure
 };
 
 
 //! Data container holding shared data specific to CustomFunc1Rate
 struct CustomFunc1Data
 {
-    CustomFunc1Data() : temperature(1.) {}
+    CustomFunc1Data() : temperature(1.), m_temperature_buf(-1.) {}
 
     //! Update data container based on temperature *T*
     void update(double T) { temperature = T; }
@@ -237,7 +321,20 @@ struct CustomFunc1Data
         temperature = NAN;
     }
 
+    //! Perturb temperature of data container
+    /*!
+     * The original state is restored by calling restore().
+     * @param deltaT  relative temperature perturbation
+     */
+    void perturbTemperature(double deltaT);
+
+    //! Restore data container after a perturbation
+    void restore();
+
     double temperature; //!< temperature
+
+protected:
+    double m_temperature_buf; //!< buffered temperature
 };
 
 }
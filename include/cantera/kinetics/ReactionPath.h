@@ -10,6 +10,7 @@
 #define CT_RXNPATH_H
 
 #include "cantera/numerics/DenseMatrix.h"
+#include "cantera/numerics/eigen_sparse.h"
 #include "Group.h"
 #include "Kinetics.h"
 
@@ -300,6 +301,14 @@ public:
     int build(Kinetics& s, const std::string& element, std::ostream& output,
               ReactionPathDiagram& r, bool quiet=false);
 
+    //! Build a diagram for given forward and reverse rates of progress instead
+    //! of those of the current state of `s`. Element fluxes are proportional
+    //! to the rates of progress, so time- or space-integrated rates yield a
+    //! diagram of integrated fluxes.
+    int build(Kinetics& s, const std::string& element, std::ostream& output,
+              ReactionPathDiagram& r, const double* fwdRates,
+              const double* revRates, bool quiet=false);
+
     //! Analyze a reaction to determine which reactants lead to which products.
     int findGroups(std::ostream& logfile, Kinetics& s);
 
@@ -329,6 +338,103 @@ protected:
     std::map<std::string, size_t> m_enamemap;
 };
 
+
+//! Reaction path analysis based on element fluxes integrated over time or
+//! space.
+/*!
+ * As the element fluxes between species are proportional to the rates of
+ * progress of the reactions, with coefficients that depend only on the
+ * mechanism, integrated fluxes are obtained from the integrated forward and
+ * reverse rates of progress of each reaction. These are accumulated during a
+ * reactor network integration or over the grid points of a flame, which
+ * requires a single pass over the reactions for each sample. The diagram or
+ * the matrix of integrated fluxes for any element is built once at the end,
+ * instead of building and merging diagrams for many snapshots.
+ *
+ * Rates are added either as weighted samples using addSample(), or as the
+ * intervals of a trapezoidal integration using startIntegration() and
+ * addInterval(). Integration over the time steps of a reactor network and
+ * over the grid of a flame is provided by integrateReactor() and
+ * integrateFlame().
+ *
+ * Example:
+ *
+ * @code
+ *     ReactionPathAccumulator acc(*gas->kinetics());
+ *     integrateReactor(acc, net, reactor, 0.1);
+ *     ReactionPathDiagram diagram;
+ *     acc.build("C", log, diagram);
+ *     diagram.exportToDot(out);
+ * @endcode
+ */
+class ReactionPathAccumulator
+{
+public:
+    //! Constructor
+    /*!
+     * @param kin  Kinetics manager used to evaluate the rates of progress.
+     *     For syncState(), it needs to be associated with a single phase.
+     */
+    explicit ReactionPathAccumulator(Kinetics& kin);
+
+    //! Discard all integrated rates
+    void clear();
+
+    //! Add the rates of progress for the current state of the kinetics
+    //! manager, multiplied by `weight`
+    void addSample(double weight);
+
+    //! Start a trapezoidal integration at the current state of the kinetics
+    //! manager
+    void startIntegration();
+
+    //! Add the interval of length `dx` from the previous state to the current
+    //! state of the kinetics manager using the trapezoidal rule. The previous
+    //! state is the state at the last call to startIntegration() or
+    //! addInterval().
+    void addInterval(double dx);
+
+    //! Set the state of the kinetics manager's phase to that of `phase`, which
+    //! needs to have the same species
+    void syncState(const ThermoPhase& phase);
+
+    //! Total weight of all samples, which is the duration or the length of the
+    //! integration interval
+    double totalWeight() const {
+        return m_weight;
+    }
+
+    //! Integrated forward rates of progress
+    const vector_fp& fwdRates() const {
+        return m_fwd;
+    }
+
+    //! Integrated reverse rates of progress
+    const vector_fp& revRates() const {
+        return m_rev;
+    }
+
+    //! Build a reaction path diagram for the integrated fluxes of `element`
+    //! @see ReactionPathBuilder::build
+    int build(const std::string& element, std::ostream& output,
+              ReactionPathDiagram& r, bool quiet=false);
+
+    //! Sparse matrix of the integrated one-way fluxes of `element`, where the
+    //! element (k1, k2) is the flux from species k1 to species k2. Species
+    //! indices are those of the kinetics manager.
+    Eigen::SparseMatrix<double> fluxMatrix(const std::string& element);
+
+protected:
+    Kinetics* m_kin;
+    ReactionPathBuilder m_builder;
+    vector_fp m_fwd; //!< Integrated forward rates of progress
+    vector_fp m_rev; //!< Integrated reverse rates of progress
+    double m_weight; //!< Total weight of all samples
+
+    //! Work arrays
+    vector_fp m_ropf, m_ropr, m_ropf0, m_ropr0;
+};
+
 }
 
 #endif
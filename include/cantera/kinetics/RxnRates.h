@@ -83,6 +83,12 @@ public:
         return m_A * std::exp(m_b*logT - m_Ea_R*recipT);
     }
 
+    //! Derivative of the natural logarithm of the rate constant with respect
+    //! to temperature.
+    double ddTScaled(double logT, double recipT) const {
+        return (m_b + m_Ea_R * recipT) * recipT;
+    }
+
     //! Return the activation energy divided by the gas constant (i.e. the
     //! activation temperature) [K]
     doublereal activationEnergy_R() const {
@@ -301,6 +307,8 @@ public:
     }
 
 protected:
+    friend class SurfaceArrheniusBatch;
+
     doublereal m_b, m_E, m_A;
     doublereal m_acov, m_ecov, m_mcov;
     std::vector<size_t> m_sp, m_msp;
@@ -392,6 +400,16 @@ public:
         return updateRC(shared_data.logT, shared_data.recipT);
     }
 
+    //! Evaluate derivative of reaction rate with respect to temperature
+    //! at constant pressure
+    /*!
+     *  @param shared_data  data shared by all reactions of a given type
+     */
+    double ddTFromStruct(const PlogData& shared_data) const {
+        return updateRC(shared_data.logT, shared_data.recipT)
+            * ddTScaled(shared_data.logT, shared_data.recipT);
+    }
+
     //! Set up Plog object
     /*!
      * @deprecated   Deprecated in Cantera 2.6. Renamed to setRates.
@@ -458,6 +476,20 @@ public:
         return std::exp(log_k1 + (log_k2-log_k1) * (logP_-logP1_) * rDeltaP_);
     }
 
+    //! Derivative of the natural logarithm of the rate constant with respect
+    //! to temperature at constant pressure. Requires a prior call to update_C.
+    double ddTScaled(double logT, double recipT) const {
+        double dlnk1 = ddTScaled(ilow1_, ilow2_, logT, recipT);
+        double dlnk2 = ddTScaled(ihigh1_, ihigh2_, logT, recipT);
+        double w = (logP_-logP1_) * rDeltaP_;
+        return dlnk1 + (dlnk2 - dlnk1) * w;
+    }
+
+    //! Derivative of the natural logarithm of the rate constant with respect
+    //! to the natural logarithm of pressure at constant temperature. Requires
+    //! a prior call to update_C.
+    double ddPScaled(double logT, double recipT) const;
+
     //! Check to make sure that the rate expression is finite over a range of
     //! temperatures at each interpolation pressure. This is potentially an
     //! issue when one of the Arrhenius expressions at a particular pressure
@@ -481,6 +513,24 @@ public:
     std::multimap<double, Arrhenius> getRates() const;
 
 protected:
+    friend class PlogBatch;
+
+    //! Derivative of the natural logarithm of the sum of the rate expressions
+    //! with indices `i1` to `i2` with respect to temperature
+    double ddTScaled(size_t i1, size_t i2, double logT, double recipT) const {
+        if (i1 == i2) {
+            return rates_[i1].ddTScaled(logT, recipT);
+        }
+        double k = 1e-300; // non-zero to match updateRC
+        double dkdT = 0.0;
+        for (size_t i = i1; i < i2; i++) {
+            double ki = rates_[i].updateRC(logT, recipT);
+            k += ki;
+            dkdT += ki * rates_[i].ddTScaled(logT, recipT);
+        }
+        return dkdT / k;
+    }
+
     //! log(p) to (index range) in the rates_ vector
     std::map<double, std::pair<size_t, size_t> > pressures_;
 
@@ -534,7 +584,7 @@ class ChebyshevRate3 final : public ReactionRate
 {
 public:
     //! Default constructor.
-    ChebyshevRate3() : m_rate_units(Units(0.)) {}
+    ChebyshevRate3() : Pr_(0.0), m_rate_units(Units(0.)) {}
 
     //! Constructor directly from coefficient array
     /*!
@@ -590,6 +640,16 @@ public:
         return updateRC(0., shared_data.recipT);
     }
 
+    //! Evaluate derivative of reaction rate with respect to temperature
+    //! at constant pressure
+    /*!
+     *  @param shared_data  data shared by all reactions of a given type
+     */
+    double ddTFromStruct(const ChebyshevData& shared_data) const {
+        return updateRC(0., shared_data.recipT)
+            * ddTScaled(0., shared_data.recipT);
+    }
+
     //! Set up ChebyshevRate3 object
     /*!
      * @deprecated   Deprecated in Cantera 2.6. Replaceable with
@@ -611,6 +671,7 @@ public:
     //! @param c base-10 logarithm of the pressure in Pa
     void update_C(const double* c) {
         double Pr = (2 * c[0] + PrNum_) * PrDen_;
+        Pr_ = Pr;
         double Cnm1 = Pr;
         double Cn = 1;
         double Cnp1;
@@ -647,6 +708,30 @@ public:
         return std::pow(10, logk);
     }
 
+    //! Derivative of the natural logarithm of the rate constant with respect
+    //! to temperature at constant pressure. Requires a prior call to update_C.
+    double ddTScaled(double logT, double recipT) const {
+        // derivatives of the Chebyshev polynomials are obtained from the
+        // polynomials of the second kind, d T_n(x) / dx = n U_{n-1}(x)
+        double Tr = (2 * recipT + TrNum_) * TrDen_;
+        double Unm1 = 0;
+        double Un = 1;
+        double dlogk_dTr = 0;
+        for (size_t i = 1; i < m_coeffs.nRows(); i++) {
+            dlogk_dTr += i * Un * dotProd_[i];
+            double Unp1 = 2 * Tr * Un - Unm1;
+            Unm1 = Un;
+            Un = Unp1;
+        }
+        // dTr/dT = -2 TrDen / T^2
+        return -2 * std::log(10.0) * dlogk_dTr * TrDen_ * recipT * recipT;
+    }
+
+    //! Derivative of the natural logarithm of the rate constant with respect
+    //! to the natural logarithm of pressure at constant temperature. Requires
+    //! a prior call to update_C.
+    double ddPScaled(double logT, double recipT) const;
+
     //! Minimum valid temperature [K]
     double Tmin() const {
         return Tmin_;
@@ -704,6 +789,7 @@ protected:
     double Pmin_, Pmax_; //!< valid pressure range
     double TrNum_, TrDen_; //!< terms appearing in the reduced temperature
     double PrNum_, PrDen_; //!< terms appearing in the reduced pressure
+    double Pr_; //!< reduced pressure at the current state
 
     Array2D m_coeffs; //!<< coefficient array
     vector_fp chebCoeffs_; //!< Chebyshev coefficients, length nP * nT
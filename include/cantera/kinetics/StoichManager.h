@@ -91,6 +91,10 @@ namespace Cantera
  *  - decrementSpecies(in, out)  : out[k0], out[k1], and out[k2]
  *    are all decremented by in[irxn]
  *
+ *  - derivatives(in, rates, jac) : appends the derivatives of
+ *    rates[irxn] * in[k0] * in[k1] * in[k2] with respect to in[k0], in[k1],
+ *    and in[k2] to the list of sparse matrix triplets jac
+ *
  * The function multiply() is usually used when evaluating the forward and
  * reverse rates of progress of reactions. The rate constants are usually
  * loaded into out[]. Then multiply() is called to add in the dependence of
@@ -112,6 +116,13 @@ namespace Cantera
  * by always assuming it is equal to one and then treating reactants and
  * products for a reaction separately. Bimolecular reactions involving the
  * identical species are treated as involving separate species.
+ *
+ * The functions multiply(), incrementSpecies(), decrementSpecies(),
+ * incrementReaction() and decrementReaction() are also provided for a batch of
+ * `n` independent states, taking an additional argument `n`. In this case,
+ * entry `k` of a species vector and entry `i` of a reaction vector are stored
+ * in the contiguous blocks starting at `in[k*n]` and `out[i*n]`, so the inner
+ * loop over states can be vectorized by the compiler.
  */
 
 /**
@@ -148,6 +159,55 @@ public:
         R[m_rxn] -= S[m_ic0];
     }
 
+    void incrementSpecies(const double* R, double* S, size_t n) const {
+        const double* r = R + m_rxn * n;
+        double* s0 = S + m_ic0 * n;
+        for (size_t j = 0; j < n; j++) {
+            s0[j] += r[j];
+        }
+    }
+
+    void decrementSpecies(const double* R, double* S, size_t n) const {
+        const double* r = R + m_rxn * n;
+        double* s0 = S + m_ic0 * n;
+        for (size_t j = 0; j < n; j++) {
+            s0[j] -= r[j];
+        }
+    }
+
+    void multiply(const double* S, double* R, size_t n) const {
+        const double* s0 = S + m_ic0 * n;
+        double* r = R + m_rxn * n;
+        for (size_t j = 0; j < n; j++) {
+            r[j] *= s0[j];
+        }
+    }
+
+    void incrementReaction(const double* S, double* R, size_t n) const {
+        const double* s0 = S + m_ic0 * n;
+        double* r = R + m_rxn * n;
+        for (size_t j = 0; j < n; j++) {
+            r[j] += s0[j];
+        }
+    }
+
+    void decrementReaction(const double* S, double* R, size_t n) const {
+        const double* s0 = S + m_ic0 * n;
+        double* r = R + m_rxn * n;
+        for (size_t j = 0; j < n; j++) {
+            r[j] -= s0[j];
+        }
+    }
+
+    void derivatives(const double* S, const double* R, SparseTriplets& jac) const {
+        jac.emplace_back(m_rxn, m_ic0, R[m_rxn]);
+    }
+
+    //! Index of the reaction
+    size_t rxnNumber() const {
+        return m_rxn;
+    }
+
 private:
     //! Reaction number
     size_t m_rxn;
@@ -192,6 +252,70 @@ public:
         R[m_rxn] -= (S[m_ic0] + S[m_ic1]);
     }
 
+    void incrementSpecies(const double* R, double* S, size_t n) const {
+        const double* r = R + m_rxn * n;
+        double* s0 = S + m_ic0 * n;
+        double* s1 = S + m_ic1 * n;
+        for (size_t j = 0; j < n; j++) {
+            s0[j] += r[j];
+        }
+        for (size_t j = 0; j < n; j++) {
+            s1[j] += r[j];
+        }
+    }
+
+    void decrementSpecies(const double* R, double* S, size_t n) const {
+        const double* r = R + m_rxn * n;
+        double* s0 = S + m_ic0 * n;
+        double* s1 = S + m_ic1 * n;
+        for (size_t j = 0; j < n; j++) {
+            s0[j] -= r[j];
+        }
+        for (size_t j = 0; j < n; j++) {
+            s1[j] -= r[j];
+        }
+    }
+
+    void multiply(const double* S, double* R, size_t n) const {
+        const double* s0 = S + m_ic0 * n;
+        const double* s1 = S + m_ic1 * n;
+        double* r = R + m_rxn * n;
+        for (size_t j = 0; j < n; j++) {
+            r[j] = (s0[j] < 0 && s1[j] < 0) ? 0.0 : r[j] * s0[j] * s1[j];
+        }
+    }
+
+    void incrementReaction(const double* S, double* R, size_t n) const {
+        const double* s0 = S + m_ic0 * n;
+        const double* s1 = S + m_ic1 * n;
+        double* r = R + m_rxn * n;
+        for (size_t j = 0; j < n; j++) {
+            r[j] += s0[j] + s1[j];
+        }
+    }
+
+    void decrementReaction(const double* S, double* R, size_t n) const {
+        const double* s0 = S + m_ic0 * n;
+        const double* s1 = S + m_ic1 * n;
+        double* r = R + m_rxn * n;
+        for (size_t j = 0; j < n; j++) {
+            r[j] -= (s0[j] + s1[j]);
+        }
+    }
+
+    void derivatives(const double* S, const double* R, SparseTriplets& jac) const {
+        if (S[m_ic0] < 0 && S[m_ic1] < 0) {
+            return;
+        }
+        jac.emplace_back(m_rxn, m_ic0, R[m_rxn] * S[m_ic1]);
+        jac.emplace_back(m_rxn, m_ic1, R[m_rxn] * S[m_ic0]);
+    }
+
+    //! Index of the reaction
+    size_t rxnNumber() const {
+        return m_rxn;
+    }
+
 private:
     //! Reaction index -> index into the ROP vector
     size_t m_rxn;
@@ -240,6 +364,85 @@ public:
         R[m_rxn] -= (S[m_ic0] + S[m_ic1] + S[m_ic2]);
     }
 
+    void incrementSpecies(const double* R, double* S, size_t n) const {
+        const double* r = R + m_rxn * n;
+        double* s0 = S + m_ic0 * n;
+        double* s1 = S + m_ic1 * n;
+        double* s2 = S + m_ic2 * n;
+        for (size_t j = 0; j < n; j++) {
+            s0[j] += r[j];
+        }
+        for (size_t j = 0; j < n; j++) {
+            s1[j] += r[j];
+        }
+        for (size_t j = 0; j < n; j++) {
+            s2[j] += r[j];
+        }
+    }
+
+    void decrementSpecies(const double* R, double* S, size_t n) const {
+        const double* r = R + m_rxn * n;
+        double* s0 = S + m_ic0 * n;
+        double* s1 = S + m_ic1 * n;
+        double* s2 = S + m_ic2 * n;
+        for (size_t j = 0; j < n; j++) {
+            s0[j] -= r[j];
+        }
+        for (size_t j = 0; j < n; j++) {
+            s1[j] -= r[j];
+        }
+        for (size_t j = 0; j < n; j++) {
+            s2[j] -= r[j];
+        }
+    }
+
+    void multiply(const double* S, double* R, size_t n) const {
+        const double* s0 = S + m_ic0 * n;
+        const double* s1 = S + m_ic1 * n;
+        const double* s2 = S + m_ic2 * n;
+        double* r = R + m_rxn * n;
+        for (size_t j = 0; j < n; j++) {
+            bool zero = (s0[j] < 0 && (s1[j] < 0 || s2[j] < 0)) ||
+                        (s1[j] < 0 && s2[j] < 0);
+            r[j] = zero ? 0.0 : r[j] * s0[j] * s1[j] * s2[j];
+        }
+    }
+
+    void incrementReaction(const double* S, double* R, size_t n) const {
+        const double* s0 = S + m_ic0 * n;
+        const double* s1 = S + m_ic1 * n;
+        const double* s2 = S + m_ic2 * n;
+        double* r = R + m_rxn * n;
+        for (size_t j = 0; j < n; j++) {
+            r[j] += s0[j] + s1[j] + s2[j];
+        }
+    }
+
+    void decrementReaction(const double* S, double* R, size_t n) const {
+        const double* s0 = S + m_ic0 * n;
+        const double* s1 = S + m_ic1 * n;
+        const double* s2 = S + m_ic2 * n;
+        double* r = R + m_rxn * n;
+        for (size_t j = 0; j < n; j++) {
+            r[j] -= (s0[j] + s1[j] + s2[j]);
+        }
+    }
+
+    void derivatives(const double* S, const double* R, SparseTriplets& jac) const {
+        if ((S[m_ic0] < 0 && (S[m_ic1] < 0 || S[m_ic2] < 0)) ||
+            (S[m_ic1] < 0 && S[m_ic2] < 0)) {
+            return;
+        }
+        jac.emplace_back(m_rxn, m_ic0, R[m_rxn] * S[m_ic1] * S[m_ic2]);
+        jac.emplace_back(m_rxn, m_ic1, R[m_rxn] * S[m_ic0] * S[m_ic2]);
+        jac.emplace_back(m_rxn, m_ic2, R[m_rxn] * S[m_ic0] * S[m_ic1]);
+    }
+
+    //! Index of the reaction
+    size_t rxnNumber() const {
+        return m_rxn;
+    }
+
 private:
     size_t m_rxn;
     size_t m_ic0;
@@ -319,6 +522,95 @@ public:
         }
     }
 
+    void multiply(const double* input, double* output, size_t n) const {
+        double* r = output + m_rxn * n;
+        for (size_t m = 0; m < m_n; m++) {
+            double order = m_order[m];
+            if (order != 0.0) {
+                const double* c = input + m_ic[m] * n;
+                for (size_t j = 0; j < n; j++) {
+                    r[j] = (c[j] > 0.0) ? r[j] * std::pow(c[j], order) : 0.0;
+                }
+            }
+        }
+    }
+
+    void incrementSpecies(const double* input, double* output, size_t n) const {
+        const double* x = input + m_rxn * n;
+        for (size_t m = 0; m < m_n; m++) {
+            double* s = output + m_ic[m] * n;
+            for (size_t j = 0; j < n; j++) {
+                s[j] += m_stoich[m] * x[j];
+            }
+        }
+    }
+
+    void decrementSpecies(const double* input, double* output, size_t n) const {
+        const double* x = input + m_rxn * n;
+        for (size_t m = 0; m < m_n; m++) {
+            double* s = output + m_ic[m] * n;
+            for (size_t j = 0; j < n; j++) {
+                s[j] -= m_stoich[m] * x[j];
+            }
+        }
+    }
+
+    void incrementReaction(const double* input, double* output, size_t n) const {
+        double* r = output + m_rxn * n;
+        for (size_t m = 0; m < m_n; m++) {
+            const double* s = input + m_ic[m] * n;
+            for (size_t j = 0; j < n; j++) {
+                r[j] += m_stoich[m] * s[j];
+            }
+        }
+    }
+
+    void decrementReaction(const double* input, double* output, size_t n) const {
+        double* r = output + m_rxn * n;
+        for (size_t m = 0; m < m_n; m++) {
+            const double* s = input + m_ic[m] * n;
+            for (size_t j = 0; j < n; j++) {
+                r[j] -= m_stoich[m] * s[j];
+            }
+        }
+    }
+
+    void derivatives(const double* input, const double* rates,
+                     SparseTriplets& jac) const {
+        for (size_t m = 0; m < m_n; m++) {
+            double order = m_order[m];
+            if (order == 0.0) {
+                continue;
+            }
+            // d/dc_m of prod_n c_n^order_n, consistent with multiply()
+            double prod = rates[m_rxn] * order;
+            for (size_t n = 0; n < m_n && prod != 0.0; n++) {
+                double c = input[m_ic[n]];
+                if (n == m) {
+                    if (order == 1.0) {
+                        continue;
+                    }
+                    prod = (c > 0.0) ? prod * std::pow(c, order - 1.0) : 0.0;
+                } else if (m_order[n] != 0.0) {
+                    prod = (c > 0.0) ? prod * std::pow(c, m_order[n]) : 0.0;
+                }
+            }
+            if (prod != 0.0) {
+                jac.emplace_back(m_rxn, m_ic[m], prod);
+            }
+        }
+    }
+
+    //! Index of the reaction
+    size_t rxnNumber() const {
+        return m_rxn;
+    }
+
+    //! Number of bytes of this object and its species data
+    size_t dataSize() const {
+        return sizeof(C_AnyN) + m_n * (sizeof(size_t) + 2 * sizeof(double));
+    }
+
 private:
     //! Length of the m_ic vector
     /*!
@@ -360,6 +652,18 @@ private:
     vector_fp m_stoich;
 };
 
+template<class Vec>
+inline static void _copyActive(const Vec& in, const std::vector<bool>& active,
+                               Vec& out)
+{
+    out.clear();
+    for (const auto& item : in) {
+        if (active[item.rxnNumber()]) {
+            out.push_back(item);
+        }
+    }
+}
+
 template<class InputIter, class Vec1, class Vec2>
 inline static void _multiply(InputIter begin, InputIter end,
                              const Vec1& input, Vec2& output)
@@ -369,6 +673,24 @@ inline static void _multiply(InputIter begin, InputIter end,
     }
 }
 
+template<class InputIter, class Vec1, class Vec2>
+inline static void _multiply(InputIter begin, InputIter end,
+                             const Vec1& input, Vec2& output, size_t n)
+{
+    for (; begin != end; ++begin) {
+        begin->multiply(input, output, n);
+    }
+}
+
+template<class InputIter, class Vec1, class Vec2, class Vec3>
+inline static void _derivatives(InputIter begin, InputIter end,
+                                const Vec1& input, const Vec2& rates, Vec3& jac)
+{
+    for (; begin != end; ++begin) {
+        begin->derivatives(input, rates, jac);
+    }
+}
+
 template<class InputIter, class Vec1, class Vec2>
 inline static void _incrementSpecies(InputIter begin,
                                      InputIter end, const Vec1& input, Vec2& output)
@@ -378,6 +700,15 @@ inline static void _incrementSpecies(InputIter begin,
     }
 }
 
+template<class InputIter, class Vec1, class Vec2>
+inline static void _incrementSpecies(InputIter begin, InputIter end,
+                                     const Vec1& input, Vec2& output, size_t n)
+{
+    for (; begin != end; ++begin) {
+        begin->incrementSpecies(input, output, n);
+    }
+}
+
 template<class InputIter, class Vec1, class Vec2>
 inline static void _decrementSpecies(InputIter begin,
                                      InputIter end, const Vec1& input, Vec2& output)
@@ -387,6 +718,15 @@ inline static void _decrementSpecies(InputIter begin,
     }
 }
 
+template<class InputIter, class Vec1, class Vec2>
+inline static void _decrementSpecies(InputIter begin, InputIter end,
+                                     const Vec1& input, Vec2& output, size_t n)
+{
+    for (; begin != end; ++begin) {
+        begin->decrementSpecies(input, output, n);
+    }
+}
+
 template<class InputIter, class Vec1, class Vec2>
 inline static void _incrementReactions(InputIter begin,
                                        InputIter end, const Vec1& input, Vec2& output)
@@ -396,6 +736,15 @@ inline static void _incrementReactions(InputIter begin,
     }
 }
 
+template<class InputIter, class Vec1, class Vec2>
+inline static void _incrementReactions(InputIter begin, InputIter end,
+                                       const Vec1& input, Vec2& output, size_t n)
+{
+    for (; begin != end; ++begin) {
+        begin->incrementReaction(input, output, n);
+    }
+}
+
 template<class InputIter, class Vec1, class Vec2>
 inline static void _decrementReactions(InputIter begin,
                                        InputIter end, const Vec1& input, Vec2& output)
@@ -405,6 +754,15 @@ inline static void _decrementReactions(InputIter begin,
     }
 }
 
+template<class InputIter, class Vec1, class Vec2>
+inline static void _decrementReactions(InputIter begin, InputIter end,
+                                       const Vec1& input, Vec2& output, size_t n)
+{
+    for (; begin != end; ++begin) {
+        begin->decrementReaction(input, output, n);
+    }
+}
+
 /*!
  * This class handles operations involving the stoichiometric coefficients on
  * one side of a reaction (reactant or product) for a set of reactions
@@ -522,6 +880,7 @@ public:
         bool frac = false;
         for (size_t n = 0; n < stoich.size(); n++) {
             m_coeffList.emplace_back(k[n], rxn, stoich[n]);
+            m_orderList.emplace_back(rxn, k[n], order[n]);
             if (fmod(stoich[n], 1.0) || stoich[n] != order[n]) {
                 frac = true;
             }
@@ -592,6 +951,93 @@ public:
         _decrementReactions(m_cn_list.begin(), m_cn_list.end(), input, output);
     }
 
+    //! @name Operations on a batch of states
+    //!
+    //! Versions of the operations above for `n` states, where entry `k` of the
+    //! species vector `input` or `output` for state `j` is stored at index
+    //! `k*n + j`, and likewise for the reaction vectors. See @ref Stoichiometry.
+    //! @{
+    void multiply(const double* input, double* output, size_t n) const {
+        _multiply(m_c1_list.begin(), m_c1_list.end(), input, output, n);
+        _multiply(m_c2_list.begin(), m_c2_list.end(), input, output, n);
+        _multiply(m_c3_list.begin(), m_c3_list.end(), input, output, n);
+        _multiply(m_cn_list.begin(), m_cn_list.end(), input, output, n);
+    }
+
+    void incrementSpecies(const double* input, double* output, size_t n) const {
+        _incrementSpecies(m_c1_list.begin(), m_c1_list.end(), input, output, n);
+        _incrementSpecies(m_c2_list.begin(), m_c2_list.end(), input, output, n);
+        _incrementSpecies(m_c3_list.begin(), m_c3_list.end(), input, output, n);
+        _incrementSpecies(m_cn_list.begin(), m_cn_list.end(), input, output, n);
+    }
+
+    void decrementSpecies(const double* input, double* output, size_t n) const {
+        _decrementSpecies(m_c1_list.begin(), m_c1_list.end(), input, output, n);
+        _decrementSpecies(m_c2_list.begin(), m_c2_list.end(), input, output, n);
+        _decrementSpecies(m_c3_list.begin(), m_c3_list.end(), input, output, n);
+        _decrementSpecies(m_cn_list.begin(), m_cn_list.end(), input, output, n);
+    }
+
+    void incrementReactions(const double* input, double* output, size_t n) const {
+        _incrementReactions(m_c1_list.begin(), m_c1_list.end(), input, output, n);
+        _incrementReactions(m_c2_list.begin(), m_c2_list.end(), input, output, n);
+        _incrementReactions(m_c3_list.begin(), m_c3_list.end(), input, output, n);
+        _incrementReactions(m_cn_list.begin(), m_cn_list.end(), input, output, n);
+    }
+
+    void decrementReactions(const double* input, double* output, size_t n) const {
+        _decrementReactions(m_c1_list.begin(), m_c1_list.end(), input, output, n);
+        _decrementReactions(m_c2_list.begin(), m_c2_list.end(), input, output, n);
+        _decrementReactions(m_c3_list.begin(), m_c3_list.end(), input, output, n);
+        _decrementReactions(m_cn_list.begin(), m_cn_list.end(), input, output, n);
+    }
+    //! @}
+
+    //! Calculate derivatives with respect to species concentrations.
+    /*!
+     * Evaluates the derivatives of \f$ R_i \prod_k C_k^{o_{k,i}} \f$ with
+     * respect to the concentrations \f$ C_k \f$, i.e. the derivatives of the
+     * products formed by multiply().
+     *
+     * @param conc   Species concentrations. Length: number of species.
+     * @param rates  Factors multiplying the concentration products, for example
+     *     the forward rate coefficients. Length: number of reactions.
+     * @returns  Sparse matrix with one row per reaction and one column per
+     *     species.
+     */
+    Eigen::SparseMatrix<double> derivatives(const double* conc,
+                                            const double* rates) const
+    {
+        const Eigen::SparseMatrix<double>& coeffs = stoichCoeffs();
+        SparseTriplets jac;
+        jac.reserve(2 * m_coeffList.size());
+        _derivatives(m_c1_list.begin(), m_c1_list.end(), conc, rates, jac);
+        _derivatives(m_c2_list.begin(), m_c2_list.end(), conc, rates, jac);
+        _derivatives(m_c3_list.begin(), m_c3_list.end(), conc, rates, jac);
+        _derivatives(m_cn_list.begin(), m_cn_list.end(), conc, rates, jac);
+
+        // repeated species within a reaction are summed by setFromTriplets
+        Eigen::SparseMatrix<double> out(coeffs.cols(), coeffs.rows());
+        out.setFromTriplets(jac.begin(), jac.end());
+        return out;
+    }
+
+    //! Copy the data for the reactions `i` where `active[i]` is true to
+    //! `other`.
+    /*!
+     * The result can be used for multiply() and for the operations
+     * incrementing or decrementing species and reaction vectors, which are
+     * then restricted to the selected reactions. The stoichiometric
+     * coefficient matrix is not copied.
+     */
+    void copyActive(const std::vector<bool>& active, StoichManagerN& other) const
+    {
+        _copyActive(m_c1_list, active, other.m_c1_list);
+        _copyActive(m_c2_list, active, other.m_c2_list);
+        _copyActive(m_c3_list, active, other.m_c3_list);
+        _copyActive(m_cn_list, active, other.m_cn_list);
+    }
+
     //! Return matrix containing stoichiometric coefficients
     const Eigen::SparseMatrix<double>& stoichCoeffs() const
     {
@@ -605,6 +1051,24 @@ public:
         return m_stoichCoeffs;
     }
 
+    //! Reaction orders as triplets of reaction index, species index and
+    //! order, in the order in which reactions were added
+    const SparseTriplets& orders() const {
+        return m_orderList;
+    }
+
+    //! Approximate number of bytes of index and coefficient data read by a
+    //! single pass over all reactions, for example by multiply() or
+    //! incrementSpecies()
+    size_t dataSize() const {
+        size_t bytes = m_c1_list.size() * sizeof(C1)
+            + m_c2_list.size() * sizeof(C2) + m_c3_list.size() * sizeof(C3);
+        for (const auto& c : m_cn_list) {
+            bytes += c.dataSize();
+        }
+        return bytes;
+    }
+
 private:
     bool m_ready; //!< Boolean flag indicating whether object is fully configured
 
@@ -615,6 +1079,7 @@ private:
 
     //! Sparse matrices for stoichiometric coefficients
     SparseTriplets m_coeffList;
+    SparseTriplets m_orderList; //!< Reaction orders (see orders())
     Eigen::SparseMatrix<double> m_stoichCoeffs;
 };
 
@@ -0,0 +1,123 @@
+/**
+ * @file SurfaceArrheniusBatch.h
+ * Batched evaluation of coverage-dependent surface rate constants
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_SURFACEARRHENIUSBATCH_H
+#define CT_SURFACEARRHENIUSBATCH_H
+
+#include "RxnRates.h"
+
+namespace Cantera
+{
+
+//! Batched evaluation of rate constants of SurfaceArrhenius reactions.
+/*!
+ * The coverage dependencies of all reactions are stored as sparse matrices in
+ * compressed row format, with one row per reaction and one column per surface
+ * species. For given coverages \f$ \theta \f$, the corrections to the
+ * pre-exponential factor and the activation energy of all reactions,
+ * \f[
+ *     a_i = \sum_k a_{ik} \theta_k, \quad
+ *     e_i = \sum_k E_{ik} \theta_k, \quad
+ *     m_i = \sum_k m_{ik} \ln \theta_k,
+ * \f]
+ * are obtained as sparse matrix-vector products, where the logarithms of the
+ * coverages are evaluated once per species rather than once per dependency.
+ * The rate constants
+ * \f[
+ *     k_i = A_i T^{b_i} \exp \left( a_i \ln 10 + m_i - (E_i + e_i) / T \right)
+ * \f]
+ * are then evaluated by computing the exponents of all reactions in a
+ * contiguous array, which are passed to vectorExp(). The results agree with
+ * those of SurfaceArrhenius to within rounding errors.
+ *
+ * This class provides the same interface as Rate1<SurfaceArrhenius>.
+ * @ingroup chemkinetics
+ */
+class SurfaceArrheniusBatch
+{
+public:
+    SurfaceArrheniusBatch();
+
+    //! Install a rate coefficient calculator for reaction `rxnNumber`
+    void install(size_t rxnNumber, const SurfaceArrhenius& rate);
+
+    //! Replace an existing rate coefficient calculator
+    void replace(size_t rxnNumber, const SurfaceArrhenius& rate);
+
+    //! Update the coverage-dependent parts of the rate coefficients.
+    //! @param theta  Coverages of the species of the surface phase
+    void update_C(const double* theta);
+
+    //! Write the rate coefficients into `values`, at the locations specified
+    //! by the reaction numbers
+    void update(double T, double logT, double* values);
+
+    size_t nReactions() const {
+        return m_rxn.size();
+    }
+
+    //! Indices of the reactions handled by this rate coefficient manager
+    const std::vector<size_t>& reactionIndices() const {
+        return m_rxn;
+    }
+
+    //! Return the effective pre-exponential factor of reaction `irxn`,
+    //! accounting for coverage dependencies
+    double effectivePreExponentialFactor(size_t irxn);
+
+    //! Return the effective activation energy divided by the gas constant of
+    //! reaction `irxn`, accounting for coverage dependencies
+    double effectiveActivationEnergy_R(size_t irxn);
+
+    //! Return the temperature exponent of reaction `irxn`, which does not
+    //! depend on coverages
+    double effectiveTemperatureExponent(size_t irxn);
+
+protected:
+    //! Pack coverage dependencies of all reactions into the sparse matrices
+    void pack();
+
+    std::vector<SurfaceArrhenius> m_rates; //!< Rate parameterizations
+    std::vector<size_t> m_rxn; //!< Reaction indices
+
+    //! Map of reaction number to index in #m_rxn and #m_rates
+    std::map<size_t, size_t> m_indices;
+
+    bool m_packed; //!< `true` if the packed arrays are current
+
+    //! Arrhenius parameters of all reactions
+    vector_fp m_A, m_b, m_E;
+
+    //! Dependencies of log10(A) and E/R on coverages: reaction `i` depends on
+    //! species `m_covSpecies[j]` with coefficients `m_covA[j]` and `m_covE[j]`
+    //! for `m_covStart[i] <= j < m_covStart[i+1]`
+    std::vector<size_t> m_covStart, m_covSpecies;
+    vector_fp m_covA, m_covE;
+
+    //! Power-law dependencies on coverages: reaction `i` depends on
+    //! species `m_mSpecies[j]` with exponent `m_mCoeff[j]` for
+    //! `m_mStart[i] <= j < m_mStart[i+1]`
+    std::vector<size_t> m_mStart, m_mSpecies;
+    vector_fp m_mCoeff;
+
+    //! Species for which logarithms of coverages are needed
+    std::vector<size_t> m_logSpecies;
+
+    //! Logarithms of coverages, indexed by species
+    vector_fp m_logTheta;
+
+    //! Coverage corrections for each reaction
+    vector_fp m_acov, m_ecov, m_mcov;
+
+    //! Work arrays for the exponents and their exponentials
+    vector_fp m_logk, m_k;
+};
+
+}
+
+#endif
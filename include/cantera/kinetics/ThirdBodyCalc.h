@@ -9,28 +9,115 @@
 #define CT_THIRDBODYCALC_H
 
 #include "cantera/base/ct_defs.h"
+#include "cantera/numerics/eigen_sparse.h"
 
 namespace Cantera
 {
 
+//! Third-body efficiencies of all reactions of a kinetics manager, stored as
+//! a sparse matrix in compressed sparse row (CSR) format.
+/*!
+ * Each row corresponds to one reaction. Only the differences between the
+ * efficiencies of specific species and the default efficiency of the reaction
+ * are stored, so effective third-body concentrations of all rows are obtained
+ * from a single sparse matrix-vector product with contiguous storage of
+ * species indices and efficiencies. BulkKinetics keeps a single matrix that
+ * holds the rows of reactions using the MultiRate framework and of legacy
+ * three-body and falloff reactions. ThirdBodyCalc and ThirdBodyCalc3 refer to
+ * rows of this matrix and distribute the evaluated rows to the work arrays of
+ * each path.
+ */
+class ThirdBodyEfficiencies
+{
+public:
+    ThirdBodyEfficiencies() : m_row_start(1, 0) {}
+
+    //! Append a row with the efficiencies of a reaction and return its index
+    size_t addRow(const std::map<size_t, double>& efficiencies, double dflt) {
+        m_default.push_back(dflt);
+        for (const auto& eff : efficiencies) {
+            AssertTrace(eff.first != npos);
+            m_species.push_back(eff.first);
+            m_eff.push_back(eff.second - dflt);
+        }
+        m_row_start.push_back(m_species.size());
+        return m_default.size() - 1;
+    }
+
+    //! Evaluate effective third-body concentrations of all rows
+    /*!
+     * @param conc  Species concentrations
+     * @param ctot  Total molar concentration
+     * @param work  Array of length nRows() receiving the effective third-body
+     *     concentration of each row
+     */
+    void evaluate(const double* conc, double ctot, double* work) const {
+        size_t nRows = m_default.size();
+        for (size_t i = 0; i < nRows; i++) {
+            double sum = m_default[i] * ctot;
+            for (size_t n = m_row_start[i]; n < m_row_start[i + 1]; n++) {
+                sum += m_eff[n] * conc[m_species[n]];
+            }
+            work[i] = sum;
+        }
+    }
+
+    //! Calculate derivatives with respect to species concentrations.
+    /*!
+     * Appends triplets for `factor * d[M]_i/dC_k` to `jac`, where `[M]_i` is
+     * the effective third-body concentration of `row`. Rows with a non-zero
+     * default efficiency yield fully populated rows of `jac`.
+     *
+     * @param row  Row of the efficiency matrix
+     * @param factor  Factor multiplying the effective third-body concentration
+     * @param jacRow  Row of `jac` receiving the entries
+     * @param nSpecies  Number of species
+     * @param jac  Vector of triplets receiving the derivative entries
+     */
+    void derivatives(size_t row, double factor, size_t jacRow, size_t nSpecies,
+                     SparseTriplets& jac) const {
+        if (m_default[row] != 0.0) {
+            for (size_t k = 0; k < nSpecies; k++) {
+                jac.emplace_back(jacRow, k, m_default[row] * factor);
+            }
+        }
+        for (size_t n = m_row_start[row]; n < m_row_start[row + 1]; n++) {
+            jac.emplace_back(jacRow, m_species[n], m_eff[n] * factor);
+        }
+    }
+
+    //! Number of rows, i.e. the number of reactions
+    size_t nRows() const {
+        return m_default.size();
+    }
+
+protected:
+    //! Offsets of each row within #m_species and #m_eff; the entries of row `i`
+    //! are located at `m_row_start[i]` to `m_row_start[i+1] - 1`.
+    std::vector<size_t> m_row_start;
+
+    //! Species index of each non-zero entry
+    std::vector<size_t> m_species;
+
+    //! Efficiency relative to the default efficiency of each non-zero entry
+    vector_fp m_eff;
+
+    //! The default efficiency for each reaction
+    vector_fp m_default;
+};
+
+
 //! Calculate and apply third-body effects on reaction rates, including non-
 //! unity third-body efficiencies.
 //! Used by legacy reactions
 class ThirdBodyCalc
 {
 public:
-    void install(size_t rxnNumber, const std::map<size_t, double>& enhanced,
-                 double dflt=1.0, size_t rxnIndex=npos) {
+    //! Install a reaction whose efficiencies are stored in row `row` of the
+    //! shared ThirdBodyEfficiencies matrix
+    void install(size_t rxnNumber, size_t row, size_t rxnIndex=npos) {
         m_reaction_index.push_back(rxnNumber);
-        m_default.push_back(dflt);
-
-        m_species.emplace_back();
-        m_eff.emplace_back();
-        for (const auto& eff : enhanced) {
-            AssertTrace(eff.first != npos);
-            m_species.back().push_back(eff.first);
-            m_eff.back().push_back(eff.second - dflt);
-        }
+        m_row.push_back(row);
         if (rxnIndex == npos) {
             m_true_index.push_back(rxnNumber);
         } else {
@@ -38,13 +125,11 @@ public:
         }
     }
 
-    void update(const vector_fp& conc, double ctot, double* work) {
-        for (size_t i = 0; i < m_species.size(); i++) {
-            double sum = 0.0;
-            for (size_t j = 0; j < m_species[i].size(); j++) {
-                sum += m_eff[i][j] * conc[m_species[i][j]];
-            }
-            work[i] = m_default[i] * ctot + sum;
+    //! Gather the effective third-body concentrations of the installed
+    //! reactions from the evaluated rows of the efficiency matrix
+    void update(const vector_fp& rows, double* work) const {
+        for (size_t i = 0; i < m_row.size(); i++) {
+            work[i] = rows[m_row[i]];
         }
     }
 
@@ -72,14 +157,8 @@ protected:
     //! Actual index of reaction within the full reaction array
     std::vector<size_t> m_true_index;
 
-    //! m_species[i][j] is the index of the j-th species in reaction i.
-    std::vector<std::vector<size_t> > m_species;
-
-    //! m_eff[i][j] is the efficiency of the j-th species in reaction i.
-    std::vector<vector_fp> m_eff;
-
-    //! The default efficiency for each reaction
-    vector_fp m_default;
+    //! Row of each reaction in the efficiency matrix
+    std::vector<size_t> m_row;
 };
 
 
@@ -89,40 +168,108 @@ class ThirdBodyCalc3
 {
 public:
     //! Install reaction that uses third-body effects in ThirdBodyCalc3 manager
-    void install(size_t rxnNumber, const std::map<size_t, double>& efficiencies,
-                  double default_efficiency, bool mass_action) {
+    /*!
+     * @param rxnNumber  Index of the reaction
+     * @param row  Row of the shared ThirdBodyEfficiencies matrix holding the
+     *     efficiencies of the reaction
+     * @param mass_action  `true` if the effective third-body concentration is
+     *     a factor in the law of mass action
+     */
+    void install(size_t rxnNumber, size_t row, bool mass_action) {
         m_reaction_index.push_back(rxnNumber);
-        m_default.push_back(default_efficiency);
+        m_row.push_back(row);
+        m_active.push_back(m_reaction_index.size() - 1);
 
         if (mass_action) {
             m_mass_action_index.push_back(m_reaction_index.size() - 1);
-        }
-
-        m_species.emplace_back();
-        m_eff.emplace_back();
-        for (const auto& eff : efficiencies) {
-            AssertTrace(eff.first != npos);
-            m_species.back().push_back(eff.first);
-            m_eff.back().push_back(eff.second - default_efficiency);
+            m_active_mass_action.push_back(m_reaction_index.size() - 1);
         }
     }
 
-    //! Update third-body concentrations in full vector
-    void update(const vector_fp& conc, double ctot, double* concm) const {
+    //! Restrict update() and multiply() to a subset of reactions
+    /*!
+     * @param active  flags indicating active reactions, indexed by the
+     *     reaction index; an empty vector activates all reactions
+     */
+    void setActiveReactions(const std::vector<bool>& active) {
+        m_active.clear();
         for (size_t i = 0; i < m_reaction_index.size(); i++) {
-            double sum = 0.0;
-            for (size_t j = 0; j < m_species[i].size(); j++) {
-                sum += m_eff[i][j] * conc[m_species[i][j]];
+            if (active.empty() || active[m_reaction_index[i]]) {
+                m_active.push_back(i);
+            }
+        }
+        m_active_mass_action.clear();
+        for (size_t i : m_mass_action_index) {
+            if (active.empty() || active[m_reaction_index[i]]) {
+                m_active_mass_action.push_back(i);
             }
-            concm[m_reaction_index[i]] = m_default[i] * ctot + sum;
+        }
+    }
+
+    //! Update third-body concentrations in full vector from the evaluated
+    //! rows of the efficiency matrix
+    void update(const vector_fp& rows, double* concm) const {
+        for (size_t i : m_active) {
+            concm[m_reaction_index[i]] = rows[m_row[i]];
         }
     }
 
     //! Multiply output with effective third-body concentration
     void multiply(double* output, const double* concm) {
+        for (size_t i : m_active_mass_action) {
+            size_t ix = m_reaction_index[i];
+            output[ix] *= concm[ix];
+        }
+    }
+
+    //! Multiply output with effective third-body concentrations for a batch of
+    //! `n` states
+    /*!
+     * @param output  Array where the entry of reaction `i` for state `j` is
+     *     stored at index `i*n + j`
+     * @param rows  Effective third-body concentrations, where the entry of row
+     *     `r` of the efficiency matrix for state `j` is stored at `r*n + j`
+     * @param n  Number of states
+     */
+    void multiply(double* output, const double* rows, size_t n) const {
+        for (size_t i : m_active_mass_action) {
+            double* out = output + m_reaction_index[i] * n;
+            const double* concm = rows + m_row[i] * n;
+            for (size_t j = 0; j < n; j++) {
+                out[j] *= concm[j];
+            }
+        }
+    }
+
+    //! Increment output by input for reactions where the effective third-body
+    //! concentration is a factor in the law of mass action
+    void incrementMassAction(const double* input, double* output) const {
         for (size_t i = 0; i < m_mass_action_index.size(); i++) {
             size_t ix = m_reaction_index[m_mass_action_index[i]];
-            output[ix] *= concm[ix];
+            output[ix] += input[ix];
+        }
+    }
+
+    //! Calculate derivatives with respect to species concentrations.
+    /*!
+     * Appends triplets for `factor[i] * d[M]_i/dC_k` to `jac`, where rows are
+     * reaction indices and columns are species indices. Reactions with a
+     * non-zero default efficiency yield a fully populated row.
+     *
+     * @param eff  The efficiency matrix holding the rows of the reactions
+     * @param factor  Factors multiplying the effective third-body
+     *     concentrations, for example the derivatives of the rates of progress
+     *     with respect to [M]. Length: number of reactions.
+     * @param nSpecies  Number of species
+     * @param jac  Vector of triplets receiving the derivative entries
+     */
+    void derivatives(const ThirdBodyEfficiencies& eff, const double* factor,
+                     size_t nSpecies, SparseTriplets& jac) const {
+        for (size_t i = 0; i < m_reaction_index.size(); i++) {
+            size_t ix = m_reaction_index[i];
+            if (factor[ix] != 0.0) {
+                eff.derivatives(m_row[i], factor[ix], ix, nSpecies, jac);
+            }
         }
     }
 
@@ -130,18 +277,19 @@ protected:
     //! Indices of reactions that use third-bodies within vector of concentrations
     std::vector<size_t> m_reaction_index;
 
+    //! Row of each reaction in the efficiency matrix
+    std::vector<size_t> m_row;
+
     //! Indices within m_reaction_index of reactions that consider third-body effects
     //! in the law of mass action
     std::vector<size_t> m_mass_action_index;
 
-    //! m_species[i][j] is the index of the j-th species in reaction i.
-    std::vector<std::vector<size_t> > m_species;
-
-    //! m_eff[i][j] is the efficiency of the j-th species in reaction i.
-    std::vector<vector_fp> m_eff;
+    //! Indices within m_reaction_index of active reactions
+    std::vector<size_t> m_active;
 
-    //! The default efficiency for each reaction
-    vector_fp m_default;
+    //! Indices within m_reaction_index of active reactions that consider
+    //! third-body effects in the law of mass action
+    std::vector<size_t> m_active_mass_action;
 };
 
 
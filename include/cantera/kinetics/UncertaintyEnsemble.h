@@ -0,0 +1,210 @@
+/**
+ * @file UncertaintyEnsemble.h
+ * Monte Carlo sampling of rate multipliers using multiple threads
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_UNCERTAINTYENSEMBLE_H
+#define CT_UNCERTAINTYENSEMBLE_H
+
+#include "cantera/base/Array.h"
+#include <functional>
+#include <memory>
+
+namespace Cantera
+{
+
+class Solution;
+
+//! A calculation which is run for each sample of an UncertaintyEnsemble
+/*!
+ * One object is created for each worker thread. Objects needed by the
+ * calculation, for example a ReactorNet or a Sim1D object, should be created
+ * in setup() and reused by run(), since setup() is only called once for each
+ * worker.
+ * @ingroup kinetics
+ */
+class EnsembleCase
+{
+public:
+    virtual ~EnsembleCase() {}
+
+    //! Names of the scalar outputs of the calculation
+    virtual std::vector<std::string> outputNames() const = 0;
+
+    //! Create the objects used by the calculation.
+    /*!
+     * This function is called once for each worker before any samples are run,
+     * and is called serially for all workers, such that it is not required to
+     * be thread-safe.
+     *
+     * @param sol  The copy of the Solution used by this worker, which is not
+     *     shared with any other worker
+     */
+    virtual void setup(shared_ptr<Solution> sol) = 0;
+
+    //! Run the calculation for one sample.
+    /*!
+     * Before this function is called, the rate multipliers of the worker's
+     * Solution are set to the sampled values and its thermodynamic state is
+     * reset to the state of the original Solution at the start of
+     * UncertaintyEnsemble::run().
+     *
+     * @param outputs  Array of length `outputNames().size()`, which is filled
+     *     with the outputs of the calculation
+     */
+    virtual void run(double* outputs) = 0;
+};
+
+//! Runs a calculation for an ensemble of randomly sampled rate multipliers
+/*!
+ * The multiplier of each reaction is sampled from a log-uniform or
+ * log-normal distribution defined by its uncertainty factor @f$ f_i \ge 1 @f$.
+ * For the log-uniform distribution, @f$ \ln m_i @f$ is uniformly distributed
+ * in @f$ [-\ln f_i, \ln f_i] @f$; for the log-normal distribution,
+ * @f$ \ln m_i @f$ has a mean of zero and a standard deviation of
+ * @f$ \ln(f_i) / n_\sigma @f$. The sampled values multiply the rate
+ * multipliers set for the original Solution. Each sample is generated from
+ * the seed and the sample index only, such that the results do not depend on
+ * the number of threads or the order in which samples are run.
+ *
+ * Each worker thread uses its own copy of the original Solution, which is
+ * created by serializing the Solution to YAML once, and its own EnsembleCase.
+ * Both are created when run() is first called and are reused by subsequent
+ * calls unless the number of threads is changed. Samples are initially
+ * distributed to the workers in contiguous blocks; workers which have run all
+ * of their samples take samples from the end of the blocks of other workers,
+ * which balances calculations that take different times.
+ *
+ * Outputs are stored in memory, see results(), and are optionally written to
+ * a CSV file with one row per sample as the samples complete. Samples where
+ * the calculation raises a CanteraError have outputs of NaN.
+ *
+ * @code
+ *     auto gas = newSolution("gri30.yaml", "gri30", "None");
+ *     UncertaintyEnsemble ens(gas, []() {
+ *         return std::unique_ptr<EnsembleCase>(new IgnitionCase());
+ *     });
+ *     ens.setUncertaintyFactors(vector_fp(gas->kinetics()->nReactions(), 2.0));
+ *     ens.setOutputFile("ignition.csv");
+ *     ens.run(1000);
+ * @endcode
+ *
+ * Only Solution objects without adjacent phases are supported.
+ * @ingroup kinetics
+ */
+class UncertaintyEnsemble
+{
+public:
+    //! Create an ensemble
+    /*!
+     * @param sol  Solution whose rate multipliers are sampled. Its state and
+     *     rate multipliers at the start of run() define the state and the
+     *     nominal multipliers of all samples. The Solution itself is not
+     *     modified.
+     * @param newCase  Function creating the calculation run by each worker
+     */
+    UncertaintyEnsemble(shared_ptr<Solution> sol,
+                        std::function<std::unique_ptr<EnsembleCase>()> newCase);
+
+    ~UncertaintyEnsemble();
+
+    //! Set the uncertainty factors of all reactions
+    void setUncertaintyFactors(const vector_fp& factors);
+
+    //! Set the uncertainty factor of reaction `i`. The default is 1, for which
+    //! the multiplier is not perturbed.
+    void setUncertaintyFactor(size_t i, double factor);
+
+    //! Uncertainty factors of all reactions
+    const vector_fp& uncertaintyFactors() const {
+        return m_factors;
+    }
+
+    //! Set the distribution of the logarithm of the multipliers
+    //! @param dist  Either `"log-uniform"` (default) or `"log-normal"`
+    //! @param nSigma  Number of standard deviations corresponding to the
+    //!     uncertainty factor for the log-normal distribution
+    void setDistribution(const std::string& dist, double nSigma=2.0);
+
+    //! Set the seed of the random number generator
+    void setSeed(unsigned long seed) {
+        m_seed = seed;
+    }
+
+    //! Set the number of worker threads, where zero (the default) uses the
+    //! number of concurrent threads supported by the hardware
+    void setThreads(size_t n);
+
+    //! Write the outputs of each sample to the CSV file `filename`. The
+    //! columns are the sample index, the outputs of the calculation and,
+    //! optionally, the sampled multipliers. An empty file name disables
+    //! writing the outputs.
+    void setOutputFile(const std::string& filename,
+                       bool includeMultipliers=false);
+
+    //! Compute the multipliers of sample `sample`
+    /*!
+     * @param sample  Index of the sample
+     * @param mult  Array of length `nReactions`, which is set to the factors
+     *     multiplying the nominal rate multipliers
+     */
+    void sampleMultipliers(size_t sample, double* mult) const;
+
+    //! Run the calculation for samples `0` to `nSamples - 1`.
+    void run(size_t nSamples);
+
+    //! Names of the outputs, which are available after the first call to run()
+    const std::vector<std::string>& outputNames() const {
+        return m_outputNames;
+    }
+
+    //! Outputs of the last call to run(), where the entry `(n, j)` is output
+    //! `j` of sample `n`
+    const Array2D& results() const {
+        return m_results;
+    }
+
+    //! Number of samples of the last call to run() where the calculation
+    //! failed
+    size_t nFailed() const {
+        return m_nFailed;
+    }
+
+    //! Number of worker threads, which is zero until run() is first called
+    size_t nWorkers() const {
+        return m_workers.size();
+    }
+
+protected:
+    //! Create the copies of the Solution and the calculations of all workers
+    void setupWorkers();
+
+    //! Take the next sample from the front of the queue of worker `w`, or
+    //! from the back of the queue of another worker. Returns `false` if no
+    //! samples are left.
+    bool nextSample(size_t w, size_t& sample);
+
+    struct Worker;
+
+    shared_ptr<Solution> m_sol; //!< The original Solution
+    std::function<std::unique_ptr<EnsembleCase>()> m_newCase;
+    vector_fp m_factors; //!< Uncertainty factors
+    bool m_logNormal; //!< `true` for the log-normal distribution
+    double m_nSigma; //!< Standard deviations of the log-normal distribution
+    unsigned long m_seed; //!< Seed of the random number generator
+    size_t m_nThreads; //!< Requested number of threads
+    std::string m_filename; //!< Name of the output file
+    bool m_writeMultipliers; //!< `true` if multipliers are written to the file
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::vector<std::string> m_outputNames; //!< Names of the outputs
+    Array2D m_results; //!< Outputs of all samples
+    size_t m_nFailed; //!< Number of failed samples
+};
+
+}
+
+#endif
@@ -11,6 +11,7 @@
 
 #include "cantera/kinetics/InterfaceKinetics.h"
 #include "cantera/numerics/DenseMatrix.h"
+#include "cantera/numerics/eigen_sparse.h"
 
 //! @defgroup solvesp_methods Surface Problem Solver Methods
 //! @{
@@ -134,6 +135,10 @@ namespace Cantera
  *  - `ct_dgetrf` -- First half of LAPACK direct solve of a full Matrix
  *  - `ct_dgetrs` -- Second half of LAPACK direct solve of a full matrix.
  *    Returns solution vector in the right-hand-side vector, resid.
+ *
+ *  For large surface mechanisms, where each species participates in only a
+ *  few reactions, the Jacobian is assembled as a sparse matrix and factorized
+ *  using a sparse direct solver instead; see setLinearSolverType().
  */
 class solveSP
 {
@@ -151,6 +156,36 @@ public:
     //! Destructor. Deletes the integrator.
     ~solveSP() {}
 
+    //! Set the type of linear solver used for the Newton iterations
+    /*!
+     *  @param type  One of `dense`, using a dense LU factorization; `sparse`,
+     *      using a sparse LU factorization; or `auto` (the default), which
+     *      uses the sparse solver if the problem has at least
+     *      #s_sparseMinSize equations and the fraction of nonzero elements of
+     *      the Jacobian does not exceed #s_sparseMaxDensity. The sparse solver
+     *      is only available for the analytic Jacobian, which is used unless
+     *      bulk phase equations are solved.
+     */
+    void setLinearSolverType(const std::string& type);
+
+    //! Type of linear solver, as set by setLinearSolverType()
+    const std::string& linearSolverType() const {
+        return m_linearSolverType;
+    }
+
+    //! `true` if the most recent Jacobian was factorized by the sparse solver
+    bool usingSparseSolver() const {
+        return m_sparse;
+    }
+
+    //! Minimum number of equations for automatic selection of the sparse
+    //! solver
+    static const size_t s_sparseMinSize = 100;
+
+    //! Maximum fraction of nonzero Jacobian elements for automatic selection
+    //! of the sparse solver
+    static constexpr double s_sparseMaxDensity = 0.1;
+
 private:
     //! Unimplemented private copy constructor
     solveSP(const solveSP& right);
@@ -185,6 +220,19 @@ public:
     int solveSurfProb(int ifunc, doublereal time_scale, doublereal TKelvin,
                       doublereal PGas, doublereal reltol, doublereal abstol);
 
+    //! Evaluate the Jacobian of the steady-state surface problem
+    /*!
+     * The Jacobian of the residual of the steady-state equations used by
+     * solveSurfProb() is evaluated for the current state of the surface
+     * phases. This function is mainly intended for checking the analytic
+     * Jacobian against finite differences.
+     *
+     * @param jac  Jacobian, which is resized to the number of equations
+     * @param finiteDifference  If `true`, the Jacobian is evaluated by
+     *     finite differences instead of analytically
+     */
+    void getJacobian(DenseMatrix& jac, bool finiteDifference=false);
+
 private:
     //! Printing routine that optionally gets called at the start of every
     //! invocation
@@ -230,18 +278,28 @@ private:
 
     //! Calculate the solution and residual weights
     /*!
+     *  Row sum scaling of the current dense or sparse Jacobian is used for the
+     *  residual weights.
+     *
      *  @param wtSpecies Weights to use for the soln unknowns. These are in
      *      concentration units
      *  @param wtResid    Weights to sue for the residual unknowns.
-     *  @param Jac        Jacobian. Row sum scaling is used for the Jacobian
      *  @param CSolnSP    Solution vector for the surface problem
      *  @param abstol     Absolute error tolerance
      *  @param reltol     Relative error tolerance
      */
     void calcWeights(doublereal wtSpecies[], doublereal wtResid[],
-                     const Array2D& Jac, const doublereal CSolnSP[],
+                     const doublereal CSolnSP[],
                      const doublereal abstol, const doublereal reltol);
 
+    //! Solve the linear system for the Newton update using either the dense
+    //! or the sparse Jacobian
+    /*!
+     *  @param b  Right-hand side, which is replaced by the solution.
+     *      Length = m_neq.
+     */
+    void solveLinearSystem(double* b);
+
     /**
      * Update the surface states of the surface phases.
      */
@@ -288,20 +346,29 @@ private:
 
     //! Main routine that calculates the current residual and Jacobian
     /*!
+     *  The Jacobian is evaluated analytically from the derivatives of the net
+     *  production rates provided by InterfaceKinetics::netProductionRates_ddC.
+     *  If bulk phase equations are solved, it is evaluated by finite
+     *  differences instead. Depending on the linear solver type, the analytic
+     *  Jacobian is stored either in `jac` or in #m_sparseJac.
+     *
      *  @param jac     Jacobian to be evaluated.
      *  @param resid   output Vector of residuals, length = m_neq
      *  @param CSolnSP  Vector of species concentrations, unknowns in the
      *                  problem, length = m_neq. These are tweaked in order
-     *                  to derive the columns of the Jacobian.
+     *                  to derive the columns of the Jacobian by finite
+     *                  differences.
      *  @param CSolnSPOld Old Vector of species concentrations, unknowns in the
      *                  problem, length = m_neq
      *  @param do_time Calculate a time dependent residual
      *  @param deltaT  Delta time for time dependent problem.
+     *  @param finiteDifference  If `true`, the Jacobian is evaluated by
+     *                  finite differences and stored in `jac`
      */
     void resjac_eval(DenseMatrix& jac, doublereal* resid,
                      doublereal* CSolnSP,
                      const doublereal* CSolnSPOld, const bool do_time,
-                     const doublereal deltaT);
+                     const doublereal deltaT, bool finiteDifference=false);
 
     //! Pointer to the manager of the implicit surface chemistry problem
     /*!
@@ -425,6 +492,14 @@ private:
      */
     std::vector<size_t> m_kinSpecIndex;
 
+    //! Index between the kinetic species index of each InterfaceKinetics
+    //! object and the equation index
+    /*!
+     *  ieq = m_kinSpecEqn[isp][ksp], where ieq is npos for kinetic species
+     *  that are not unknowns of the problem. Length = m_numSurfPhases.
+     */
+    std::vector<std::vector<size_t>> m_kinSpecEqn;
+
     //! Index between the equation index and the index of the
     //! InterfaceKinetics object
     /*!
@@ -503,6 +578,21 @@ private:
     //! Newton's method.
     DenseMatrix m_Jac;
 
+    //! Sparse Jacobian, used instead of #m_Jac if #m_sparse is `true`
+    Eigen::SparseMatrix<double> m_sparseJac;
+
+    //! Sparse LU factorization of #m_sparseJac
+    Eigen::SparseLU<Eigen::SparseMatrix<double>> m_sparseSolver;
+
+    //! Work array holding the nonzero elements of the analytic Jacobian
+    SparseTriplets m_jacTrips;
+
+    //! Type of linear solver; see setLinearSolverType()
+    std::string m_linearSolverType;
+
+    //! `true` if the current Jacobian is stored in #m_sparseJac
+    bool m_sparse;
+
 public:
     int m_ioflag;
 };
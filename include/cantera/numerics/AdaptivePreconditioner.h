@@ -0,0 +1,144 @@
+/**
+ *  @file AdaptivePreconditioner.h Declarations for the class
+ *   AdaptivePreconditioner which is a child class of PreconditionerBase
+ *   for preconditioners used by sundials
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_ADAPTIVEPRECONDITIONER_H
+#define CT_ADAPTIVEPRECONDITIONER_H
+
+#include "cantera/numerics/PreconditionerBase.h"
+#include "cantera/numerics/eigen_sparse.h"
+
+namespace Cantera
+{
+
+//! AdaptivePreconditioner is a preconditioner designed for use with large
+//! mechanisms that leverages sparse solvers. It does this by pruning the
+//! preconditioner by a threshold value and using an incomplete factorization.
+/*!
+ * The preconditioner matrix \f$ M = I - \gamma J \f$ is formed from the
+ * Jacobian elements supplied through setValue() and factorized using an
+ * incomplete LU factorization with dual thresholding (ILUT). Decreasing the
+ * drop tolerance and increasing the fill factor gives a more accurate
+ * factorization at a higher cost per setup. Independent of these settings, at
+ * most half of the elements of a row are kept in each of the factors, such
+ * that dense rows, for example those of the energy equation, are factorized
+ * only approximately.
+ *
+ * @ingroup odeGroup
+ */
+class AdaptivePreconditioner : public PreconditionerBase
+{
+public:
+    AdaptivePreconditioner();
+
+    void initialize(size_t networkSize) override;
+
+    void reset() override {
+        m_jac_trips.clear();
+    }
+
+    void setup() override;
+
+    void solve(const size_t stateSize, double* rhs_vector, double* output) override;
+
+    void setValue(size_t row, size_t col, double value) override;
+
+    void updatePreconditioner() override;
+
+    //! Prune preconditioner elements whose magnitude is below the threshold.
+    //! Diagonal elements are always retained.
+    void prunePreconditioner();
+
+    //! Return the underlying Jacobian matrix
+    Eigen::SparseMatrix<double> jacobian() {
+        Eigen::SparseMatrix<double> jacobian_mat(m_dim, m_dim);
+        jacobian_mat.setFromTriplets(m_jac_trips.begin(), m_jac_trips.end());
+        return jacobian_mat;
+    }
+
+    //! Return the internal preconditioner matrix
+    Eigen::SparseMatrix<double> matrix() {
+        return m_precon_matrix;
+    }
+
+    //! Get the threshold value for setting elements
+    double threshold() const {
+        return m_threshold;
+    }
+
+    //! Get ILUT fill factor
+    int ilutFillFactor() const {
+        return m_fill_factor;
+    }
+
+    //! Get ILUT drop tolerance
+    double ilutDropTol() const {
+        return m_drop_tol;
+    }
+
+    //! Set the threshold value to compare elements against
+    //! @param threshold  double value used in setting by threshold
+    void setThreshold(double threshold) {
+        m_threshold = threshold;
+        m_prune_precon = (threshold > 0.0);
+    }
+
+    //! Set drop tolerance for ILUT
+    //! @param droptol  the drop tolerance value used by ILUT
+    void setIlutDropTol(double droptol) {
+        m_drop_tol = droptol;
+        m_solver.setDroptol(droptol);
+    }
+
+    //! Set the fill factor for ILUT solver
+    //! @param fillFactor  fill in factor for ILUT solver
+    void setIlutFillFactor(int fillFactor) {
+        m_fill_factor = fillFactor;
+        m_solver.setFillfactor(fillFactor);
+    }
+
+    //! Print preconditioner contents
+    void printPreconditioner() override;
+
+    //! Print jacobian contents
+    void printJacobian();
+
+protected:
+    //! Vector of triplets representing the Jacobian used in preconditioning
+    SparseTriplets m_jac_trips;
+
+    //! Storage of appropriately sized identity matrix for making the
+    //! preconditioner
+    Eigen::SparseMatrix<double> m_identity;
+
+    //! Container that is the sparse preconditioner
+    Eigen::SparseMatrix<double> m_precon_matrix;
+
+    //! Solver used in solving the linear system
+    Eigen::IncompleteLUT<double> m_solver;
+
+    //! Minimum value a non-diagonal element must be to be included in the
+    //! preconditioner
+    double m_threshold;
+
+    //! Bool set whether to prune the matrix or not
+    bool m_prune_precon;
+
+    //! Drop tolerance used by ILUT
+    double m_drop_tol;
+
+    //! Fill factor used by ILUT
+    int m_fill_factor;
+
+    //! Dimension of the preconditioner
+    size_t m_dim;
+};
+
+}
+
+#endif
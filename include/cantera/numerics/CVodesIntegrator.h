@@ -35,6 +35,7 @@ public:
     virtual void setTolerances(double reltol, double abstol);
     virtual void setSensitivityTolerances(double reltol, double abstol);
     virtual void setProblemType(int probtype);
+    virtual void setPreconditioner(shared_ptr<PreconditionerBase> preconditioner);
     virtual void initialize(double t0, FuncEval& func);
     virtual void reinitialize(double t0, FuncEval& func);
     virtual void integrate(double tout);
@@ -106,6 +107,9 @@ private:
     size_t m_np;
     int m_mupper, m_mlower;
 
+    //! Preconditioner used with the GMRES linear solver, if any
+    shared_ptr<PreconditionerBase> m_preconditioner;
+
     //! Indicates whether the sensitivities stored in m_yS have been updated
     //! for at the current integrator time.
     bool m_sens_ok;
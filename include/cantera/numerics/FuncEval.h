@@ -49,6 +49,58 @@ public:
      */
     int eval_nothrow(double t, double* y, double* ydot);
 
+    //! Evaluate the setup processes for the Jacobian preconditioner.
+    /*!
+     * Called by the integrator when the preconditioner needs to be formed from
+     * a new approximation of the Jacobian.
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq()
+     * @param gamma the gamma in M=I-gamma*J
+     * @warning This function is an experimental part of the %Cantera API and
+     *     may be changed or removed without notice.
+     */
+    virtual void preconditionerSetup(double t, double* y, double gamma) {
+        throw NotImplementedError("FuncEval::preconditionerSetup");
+    }
+
+    //! Evaluate the linear system Ax=b where A is the preconditioner.
+    /*!
+     * @param[in] rhs right hand side vector used in linear system
+     * @param[out] output guess vector used by GMRES
+     * @warning This function is an experimental part of the %Cantera API and
+     *     may be changed or removed without notice.
+     */
+    virtual void preconditionerSolve(double* rhs, double* output) {
+        throw NotImplementedError("FuncEval::preconditionerSolve");
+    }
+
+    //! Update the preconditioner based on an already computed Jacobian and a
+    //! new value of gamma.
+    /*!
+     * @param gamma the gamma in M=I-gamma*J
+     * @warning This function is an experimental part of the %Cantera API and
+     *     may be changed or removed without notice.
+     */
+    virtual void updatePreconditioner(double gamma) {
+        throw NotImplementedError("FuncEval::updatePreconditioner");
+    }
+
+    //! Preconditioner setup that doesn't throw an error but returns a
+    //! CVODES flag. It also helps as a first level of polymorphism
+    //! which identifies the specific FuncEval, e.g., ReactorNet.
+    //! @see preconditionerSetup(), eval_nothrow()
+    int preconditioner_setup_nothrow(double t, double* y, double gamma);
+
+    //! Preconditioner solve that doesn't throw an error but returns a
+    //! CVODES flag.
+    //! @see preconditionerSolve(), eval_nothrow()
+    int preconditioner_solve_nothrow(double* rhs, double* output);
+
+    //! Preconditioner update that doesn't throw an error but returns a
+    //! CVODES flag.
+    //! @see updatePreconditioner(), eval_nothrow()
+    int update_preconditioner_nothrow(double gamma);
+
     //! Fill in the vector *y* with the current state of the system
     virtual void getState(double* y) {
         throw NotImplementedError("FuncEval::getState");
@@ -89,6 +141,11 @@ public:
     vector_fp m_paramScales;
 
 protected:
+    //! Call *func*, converting exceptions into CVODES-style return codes
+    //! @see eval_nothrow()
+    template <class F>
+    int callNoThrow(const std::string& method, F func);
+
     // If true, errors are accumulated in m_errors. Otherwise, they are printed
     bool m_suppress_errors;
 
@@ -12,6 +12,7 @@
 #ifndef CT_INTEGRATOR_H
 #define CT_INTEGRATOR_H
 #include "FuncEval.h"
+#include "PreconditionerBase.h"
 
 #include "cantera/base/global.h"
 
@@ -96,6 +97,19 @@ public:
         warn("setProblemType");
     }
 
+    //! Set the preconditioner used by iterative linear solvers.
+    /*!
+     * The preconditioner is formed and applied through the preconditioner
+     * methods of the FuncEval object passed to initialize().
+     * @param preconditioner  preconditioner object; the side on which it is
+     *     applied is given by PreconditionerBase::preconditionerSide()
+     * @warning This function is an experimental part of the %Cantera API and
+     *     may be changed or removed without notice.
+     */
+    virtual void setPreconditioner(shared_ptr<PreconditionerBase> preconditioner) {
+        throw NotImplementedError("Integrator::setPreconditioner");
+    }
+
     /**
      * Initialize the integrator for a new problem. Call after all options have
      * been set.
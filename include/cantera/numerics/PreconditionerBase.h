@@ -0,0 +1,127 @@
+/**
+ *  @file PreconditionerBase.h Declarations for the class PreconditionerBase
+ *      which is a virtual base class for preconditioning systems.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_PRECONDITIONERBASE_H
+#define CT_PRECONDITIONERBASE_H
+
+#include "cantera/base/ctexceptions.h"
+
+namespace Cantera
+{
+
+//! Specifies the side of the system on which the preconditioner is applied. Not
+//! all methods are supported by all integrators.
+enum class PreconditionerType {
+    NO_PRECONDITION, //!< No preconditioning
+    LEFT_PRECONDITION, //!< Left side preconditioning
+    RIGHT_PRECONDITION, //!< Right side preconditioning
+    BOTH_PRECONDITION //!< Left and right side preconditioning
+};
+
+//! PreconditionerBase serves as an abstract type to extend different
+//! preconditioners used with iterative linear solvers.
+/*!
+ * Preconditioners approximate the Newton matrix \f$ M = I - \gamma J \f$ of an
+ * implicit integrator, where \f$ J \f$ is the Jacobian of the ODE system. Jacobian
+ * elements are supplied via setValue() between calls to reset() and setup().
+ *
+ * @ingroup odeGroup
+ */
+class PreconditionerBase
+{
+public:
+    PreconditionerBase() : m_gamma(0.0), m_atol(0.0) {}
+
+    virtual ~PreconditionerBase() {}
+
+    //! Set a value at the specified row and column of the Jacobian held by the
+    //! preconditioner; repeated calls for the same element are summed.
+    //! @param row  row index
+    //! @param col  column index
+    //! @param value  value to add at the given location
+    virtual void setValue(size_t row, size_t col, double value) {
+        throw NotImplementedError("PreconditionerBase::setValue");
+    }
+
+    //! Solve a linear system Ax=b where A is the preconditioner
+    //! @param[in] stateSize  length of the rhs and output vectors
+    //! @param[in] rhs_vector  right hand side vector used in linear system
+    //! @param[out] output  guess vector used by GMRES
+    virtual void solve(const size_t stateSize, double* rhs_vector, double* output) {
+        throw NotImplementedError("PreconditionerBase::solve");
+    }
+
+    //! Perform preconditioner specific post-reactor setup operations such as
+    //! forming and factorizing the preconditioner matrix.
+    virtual void setup() {
+        throw NotImplementedError("PreconditionerBase::setup");
+    }
+
+    //! Reset preconditioner parameters as needed before new Jacobian elements
+    //! are supplied
+    virtual void reset() {
+        throw NotImplementedError("PreconditionerBase::reset");
+    }
+
+    //! Called during setup for any processes that need to be completed prior
+    //! to setup functions used in sundials.
+    //! @param networkSize  the number of variables in the associated reactor
+    //!     network
+    virtual void initialize(size_t networkSize) {
+        throw NotImplementedError("PreconditionerBase::initialize");
+    }
+
+    //! Print preconditioner contents
+    virtual void printPreconditioner() {
+        throw NotImplementedError("PreconditionerBase::printPreconditioner");
+    }
+
+    //! Get the side on which the preconditioner is applied
+    virtual PreconditionerType preconditionerSide() const {
+        return PreconditionerType::LEFT_PRECONDITION;
+    }
+
+    //! Transform Jacobian vector and write into preconditioner, P = (I - gamma * J)
+    virtual void updatePreconditioner() {
+        throw NotImplementedError("PreconditionerBase::updatePreconditioner");
+    }
+
+    //! Set gamma used in preconditioning
+    //! @param gamma  used in M = I - gamma*J
+    virtual void setGamma(double gamma) {
+        m_gamma = gamma;
+    }
+
+    //! Get gamma used in preconditioning
+    virtual double gamma() const {
+        return m_gamma;
+    }
+
+    //! Set the absolute tolerance in the solver outside of the network
+    //! initialization
+    //! @param atol  the specified tolerance
+    virtual void setAbsoluteTolerance(double atol) {
+        m_atol = atol;
+    }
+
+    //! Get absolute tolerance of the solver
+    virtual double absoluteTolerance() const {
+        return m_atol;
+    }
+
+protected:
+    //! gamma value used in M = I - gamma*J
+    double m_gamma;
+
+    //! absolute tolerance of the ODE solver
+    double m_atol;
+};
+
+}
+
+#endif
@@ -28,6 +28,35 @@ namespace Cantera
  */
 doublereal linearInterp(doublereal x, const vector_fp& xpts,
                         const vector_fp& fpts);
+
+//! Evaluate the exponential function for an array of arguments.
+/*!
+ * If %Cantera is compiled with support for AVX-512 or AVX2 instructions (for
+ * example, by adding `-march=native` to the compiler options), the
+ * exponentials are evaluated several at a time, using a rational approximation
+ * with a relative accuracy close to machine precision. Otherwise, `std::exp`
+ * is used. The instruction set is selected at compile time, so a library built
+ * with these options only runs on processors supporting them. Arguments for
+ * which the result is subnormal or zero are passed to `std::exp`.
+ *
+ * @param x  array of arguments; length *n*
+ * @param y  array of results; length *n*. May be the same array as *x*.
+ * @param n  number of elements
+ */
+void vectorExp(const double* x, double* y, size_t n);
+
+//! Evaluate the natural logarithm for an array of arguments.
+/*!
+ * As for vectorExp(), logarithms are evaluated several at a time if %Cantera
+ * is compiled with support for AVX-512 or AVX2 instructions. Arguments that
+ * are not positive, finite and normal floating point numbers are passed to
+ * `std::log`.
+ *
+ * @param x  array of arguments; length *n*
+ * @param y  array of results; length *n*. May be the same array as *x*.
+ * @param n  number of elements
+ */
+void vectorLog(const double* x, double* y, size_t n);
 }
 
 #endif
@@ -0,0 +1,37 @@
+/**
+ * @file FlameSampling.h
+ * Sampling of one-dimensional flame solutions for mechanism analysis and
+ * reduction, and integration of reaction paths
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_FLAMESAMPLING_H
+#define CT_FLAMESAMPLING_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+class Sim1D;
+class DirectedRelationGraph;
+class ReactionPathAccumulator;
+
+//! Add the states at all grid points of flow domain `domain` of a
+//! one-dimensional simulation as samples to `drg`. The flow domain needs to
+//! have the same species as the detailed mechanism.
+//! @ingroup onedim
+void sampleFlame(DirectedRelationGraph& drg, Sim1D& sim, size_t domain);
+
+//! Integrate rates of progress over the grid of flow domain `domain` of a
+//! one-dimensional simulation using the trapezoidal rule. The flow domain
+//! needs to have the same species as the phase of the kinetics manager of
+//! `acc`.
+//! @ingroup onedim
+void integrateFlame(ReactionPathAccumulator& acc, Sim1D& sim, size_t domain);
+
+}
+
+#endif
@@ -10,6 +10,7 @@
 
 #include "TransportBase.h"
 #include "cantera/numerics/DenseMatrix.h"
+#include "cantera/base/AnyMap.h"
 
 namespace Cantera
 {
@@ -154,7 +155,17 @@ public:
                                                 double* cstar_coeffs, bool actualT);
 
     virtual void init(ThermoPhase* thermo, int mode=0, int log_level=0);
-    
+
+    //! Polynomial fits to the transport properties and collision integrals.
+    /*!
+     * The fits are stored together with the transport model, fitting mode and
+     * species names, and can be included in the hidden `__transport-fits__`
+     * list of a phase definition, as done by compileMechanism(). Transport
+     * managers created for such a phase with the same model and species then
+     * use the stored fits instead of fitting the properties again.
+     */
+    AnyMap fittedProperties() const;
+
     //! Boolean indicating the form of the transport properties polynomial fits.
     //! Returns true if the Chemkin form is used.
     bool CKMode() const {
@@ -204,6 +215,11 @@ protected:
     //! Monchick & Mason
     void setupCollisionIntegral();
 
+    //! Use polynomial fits stored in the phase definition, if these exist for
+    //! the current transport model and species. Returns `true` if stored fits
+    //! were used. @see fittedProperties()
+    bool restoreFittedProperties();
+
     //! Read the transport database
     /*!
      * Read transport property data from a file for a list of species. Given the
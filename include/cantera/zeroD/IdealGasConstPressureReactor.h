@@ -17,6 +17,12 @@ namespace Cantera
  * be connected to a "flow device" such as a mass flow controller, a pressure
  * regulator, etc. Additional reactors may be connected to the other end of the
  * flow device, allowing construction of arbitrary reactor networks.
+ *
+ * If the kinetics manager is a GasKinetics object with quasi-steady-state
+ * species (see GasKinetics::setQssSpecies), the mass fractions of these species
+ * are not part of the state vector. Their mass fractions in the phase are set
+ * to zero, while their concentrations are determined algebraically by the
+ * kinetics manager.
  */
 class IdealGasConstPressureReactor : public ConstPressureReactor
 {
@@ -43,6 +49,21 @@ public:
 
     virtual void updateState(doublereal* y);
 
+    virtual bool preconditionerSupported() const {
+        return true;
+    }
+
+    //! Append the elements of an approximate Jacobian of the governing
+    //! equations to *trips*.
+    /*!
+     * Contributions from gas-phase chemistry are included using the sparse
+     * derivatives provided by Kinetics::netProductionRates_ddC() and
+     * Kinetics::getNetProductionRates_ddT(), neglecting the dependence of the
+     * mixture density on composition. Contributions from walls, surfaces,
+     * inlets and outlets are not included.
+     */
+    virtual void getJacobianElements(SparseTriplets& trips, size_t offset=0);
+
     //! Return the index in the solution vector for this reactor of the
     //! component named *nm*. Possible values for *nm* are "mass",
     //! "temperature", the name of a homogeneous phase species, or the name of a
@@ -52,6 +73,16 @@ public:
 
 protected:
     vector_fp m_hk; //!< Species molar enthalpies
+    vector_fp m_cpk; //!< Species molar heat capacities
+
+    //! Indices of species whose mass fractions are part of the state vector
+    std::vector<size_t> m_stateSpecies;
+
+    //! Index of each species within #m_stateSpecies, or `npos` for
+    //! quasi-steady-state species
+    std::vector<size_t> m_stateIndex;
+
+    vector_fp m_Y; //!< Mass fractions of all species
 };
 }
 
@@ -42,6 +42,20 @@ public:
 
     virtual void updateState(doublereal* y);
 
+    virtual bool preconditionerSupported() const {
+        return true;
+    }
+
+    //! Append the elements of an approximate Jacobian of the governing
+    //! equations to *trips*.
+    /*!
+     * Contributions from gas-phase chemistry are included using the sparse
+     * derivatives provided by Kinetics::netProductionRates_ddC() and
+     * Kinetics::getNetProductionRates_ddT(). Contributions from walls,
+     * surfaces, inlets and outlets are not included.
+     */
+    virtual void getJacobianElements(SparseTriplets& trips, size_t offset=0);
+
     //! Return the index in the solution vector for this reactor of the
     //! component named *nm*. Possible values for *nm* are "mass",
     //! "volume", "temperature", the name of a homogeneous phase species, or the
@@ -51,6 +65,7 @@ public:
 
 protected:
     vector_fp m_uk; //!< Species molar internal energies
+    vector_fp m_cpk; //!< Work array for species molar heat capacities
 };
 
 }
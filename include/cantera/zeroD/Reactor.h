@@ -7,6 +7,7 @@
 #define CT_REACTOR_H
 
 #include "ReactorBase.h"
+#include "cantera/numerics/eigen_sparse.h"
 
 namespace Cantera
 {
@@ -119,6 +120,27 @@ public:
     //! Set the state of the reactor to correspond to the state vector *y*.
     virtual void updateState(doublereal* y);
 
+    //! Return `true` if this reactor type provides the approximate Jacobian
+    //! required for preconditioning.
+    virtual bool preconditionerSupported() const {
+        return false;
+    }
+
+    //! Append the elements of an approximate Jacobian of the governing
+    //! equations of this reactor to the list of sparse matrix triplets
+    //! *trips*. Called by ReactorNet to form the preconditioner.
+    /*!
+     * The Jacobian is evaluated at the current state of the reactor.
+     * @param[out] trips  list of triplets to append Jacobian elements to
+     * @param offset  index of the first component of this reactor in the
+     *     global state vector of the reactor network
+     * @warning This function is an experimental part of the %Cantera API and
+     *     may be changed or removed without notice.
+     */
+    virtual void getJacobianElements(SparseTriplets& trips, size_t offset=0) {
+        throw NotImplementedError("Reactor::getJacobianElements");
+    }
+
     //! Number of sensitivity parameters associated with this reactor
     //! (including walls)
     virtual size_t nSensParams();
@@ -8,6 +8,7 @@
 
 #include "Reactor.h"
 #include "cantera/numerics/FuncEval.h"
+#include "cantera/numerics/PreconditionerBase.h"
 
 namespace Cantera
 {
@@ -57,6 +58,17 @@ public:
     //! sensitivity equations.
     void setSensitivityTolerances(double rtol, double atol);
 
+    //! Set the preconditioner used by the linear solver of the integrator.
+    /*!
+     * Setting a preconditioner selects the GMRES iterative linear solver. The
+     * preconditioner is formed from approximate Jacobians provided by each
+     * reactor, see Reactor::getJacobianElements(). Passing an empty pointer
+     * restores the default dense direct linear solver.
+     * @warning This function is an experimental part of the %Cantera API and
+     *     may be changed or removed without notice.
+     */
+    void setPreconditioner(shared_ptr<PreconditionerBase> preconditioner);
+
     //! @}
 
     //! Current value of the simulation time.
@@ -183,6 +195,10 @@ public:
 
     virtual void getState(doublereal* y);
 
+    virtual void preconditionerSetup(double t, double* y, double gamma);
+    virtual void preconditionerSolve(double* rhs, double* output);
+    virtual void updatePreconditioner(double gamma);
+
     //! Return k-th derivative at the current time
     virtual void getDerivative(int k, double* dky);
 
@@ -291,6 +307,12 @@ protected:
     vector_fp m_ydot;
     vector_fp m_yest;
     vector_fp m_advancelimits;
+
+    //! Preconditioner used with the GMRES linear solver, if any
+    shared_ptr<PreconditionerBase> m_precon;
+
+    //! Work array holding the elements of the approximate Jacobian
+    SparseTriplets m_jac_trips;
 };
 }
 
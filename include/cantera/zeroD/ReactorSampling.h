@@ -0,0 +1,65 @@
+/**
+ * @file ReactorSampling.h
+ * Sampling of reactor network integrations for mechanism analysis and
+ * reduction, and integration of reaction paths
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_REACTORSAMPLING_H
+#define CT_REACTORSAMPLING_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+class Solution;
+class ReactorNet;
+class ReactorBase;
+class DirectedRelationGraph;
+class ReactionPathAccumulator;
+
+//! Add samples along the integration of a reactor network.
+/*!
+ * The network is advanced by individual time steps until `tEnd` is reached,
+ * and the state of `reactor` after each step is added as a sample to `drg`.
+ * The contents of the reactor need to have the same species as the detailed
+ * mechanism.
+ * @ingroup ZeroD
+ */
+void sampleReactor(DirectedRelationGraph& drg, ReactorNet& net,
+                   ReactorBase& reactor, double tEnd);
+
+//! Ignition delay time of a constant pressure reactor, given by the time of
+//! the largest rate of temperature increase.
+/*!
+ * This function can be used to define error targets for
+ * DirectedRelationGraph::addErrorTarget().
+ *
+ * @param soln  Solution object
+ * @param T  Initial temperature [K]
+ * @param P  Pressure [Pa]
+ * @param X  Initial composition given as mole fractions
+ * @param tEnd  End time of the integration [s]
+ * @ingroup ZeroD
+ */
+double ignitionDelay(shared_ptr<Solution> soln, double T, double P,
+                     const std::string& X, double tEnd);
+
+//! Integrate rates of progress over the time steps of a reactor network.
+/*!
+ * The network is advanced by individual time steps until `tEnd` is reached,
+ * where the last step is truncated at `tEnd`, and the rates of progress for
+ * the state of `reactor` are integrated by `acc` using the trapezoidal rule.
+ * The contents of the reactor need to have the same species as the phase of
+ * the kinetics manager of `acc`.
+ * @ingroup ZeroD
+ */
+void integrateReactor(ReactionPathAccumulator& acc, ReactorNet& net,
+                      ReactorBase& reactor, double tEnd);
+
+}
+
+#endif
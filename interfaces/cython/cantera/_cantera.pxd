@@ -657,6 +657,11 @@ cdef extern from "cantera/kinetics/Kinetics.h" namespace "Cantera":
         double multiplier(int)
         void setMultiplier(int, double)
 
+        void setInstrumentation(cbool)
+        cbool instrumentationEnabled()
+        void clearInstrumentation()
+        CxxAnyMap instrumentationReport() except +translate_exception
+
 
 cdef extern from "cantera/kinetics/InterfaceKinetics.h":
     cdef cppclass CxxInterfaceKinetics "Cantera::InterfaceKinetics":
@@ -45,8 +45,9 @@ cdef class _SolutionBase:
         if isinstance(infile, PurePath):
             infile = str(infile)
 
-        # Parse YAML input
-        if infile.endswith(".yml") or infile.endswith(".yaml") or yaml:
+        # Parse YAML input or its binary representation
+        if (infile.endswith(".yml") or infile.endswith(".yaml")
+                or infile.endswith(".ctb") or yaml):
             # Transport model: "" is a sentinel value to use the default model
             transport_model = kwargs.get("transport_model", "")
             self._init_yaml(infile, name, adjacent, yaml, transport_model)
@@ -192,6 +192,31 @@ cdef class Kinetics(_SolutionBase):
             self._check_reaction_index(i_reaction)
             self.kinetics.setMultiplier(i_reaction, value)
 
+    property instrumentation_enabled:
+        """
+        Get/Set whether the number of calls and cache hits and the cumulative
+        wall time of the sections of the rate evaluation are recorded. See
+        `instrumentation_report`.
+        """
+        def __get__(self):
+            return self.kinetics.instrumentationEnabled()
+        def __set__(self, cbool enabled):
+            self.kinetics.setInstrumentation(enabled)
+
+    property instrumentation_report:
+        """
+        A dictionary with the number of ``calls``, the number of
+        ``cache-hits`` and the cumulative wall ``time`` in seconds of each
+        instrumented section that has been called, such as the evaluator for
+        each reaction rate type or the evaluation of equilibrium constants.
+        """
+        def __get__(self):
+            return anymap_to_dict(self.kinetics.instrumentationReport())
+
+    def clear_instrumentation(self):
+        """ Reset all counters of `instrumentation_report` to zero. """
+        self.kinetics.clearInstrumentation()
+
     def reaction_type(self, int i_reaction):
         """
         Type code of reaction *i_reaction*.
@@ -56,6 +56,26 @@ class TestKinetics(utilities.CanteraTest):
         self.assertArrayNear(0.5 * fwd_rates0, fwd_rates2)
         self.assertArrayNear(0.5 * rev_rates0, rev_rates2)
 
+    def test_instrumentation(self):
+        self.assertFalse(self.phase.instrumentation_enabled)
+        self.phase.net_rates_of_progress
+        self.assertEqual(self.phase.instrumentation_report, {})
+
+        self.phase.instrumentation_enabled = True
+        self.phase.TP = 900, ct.one_atm
+        self.phase.net_rates_of_progress
+        self.phase.net_rates_of_progress
+        report = self.phase.instrumentation_report
+        self.assertEqual(report['update_rates_T']['calls'], 2)
+        self.assertEqual(report['update_rates_T']['cache-hits'], 1)
+        self.assertEqual(report['updateKc']['calls'], 1)
+        self.assertGreaterEqual(report['updateROP']['time'], 0.0)
+
+        self.phase.clear_instrumentation()
+        self.phase.instrumentation_enabled = False
+        self.phase.net_rates_of_progress
+        self.assertEqual(self.phase.instrumentation_report, {})
+
     def test_legacy_reaction_rate(self):
         ct.use_legacy_rate_constants(True) # set to False for test suite
         with self.assertRaisesRegex(ct.CanteraError, "Deprecated: Behavior to change"):
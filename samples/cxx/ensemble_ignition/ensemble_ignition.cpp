@@ -0,0 +1,122 @@
+/*!
+ * @file ensemble_ignition.cpp
+ *
+ * Uncertainty of ignition delay times
+ *
+ * This example samples the rate multipliers of all reactions from their
+ * uncertainty factors and computes the ignition delay time for each sample,
+ * using an UncertaintyEnsemble to run the samples on multiple threads. Each
+ * thread sets up its reactor network once and reuses it for all of its
+ * samples. The ignition delay times are written to 'ensemble_ignition.csv'.
+ *
+ * Usage: ensemble_ignition [number of samples] [number of threads]
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/zerodim.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/kinetics/Reaction.h"
+#include "cantera/kinetics/UncertaintyEnsemble.h"
+
+using namespace Cantera;
+
+//! Computes the ignition delay time, defined as the time at which the
+//! temperature exceeds the initial temperature by 400 K
+class IgnitionCase : public EnsembleCase
+{
+public:
+    std::vector<std::string> outputNames() const {
+        return {"ignition-delay", "final-temperature"};
+    }
+
+    void setup(shared_ptr<Solution> sol) {
+        m_reactor.insert(sol);
+        m_net.addReactor(m_reactor);
+    }
+
+    void run(double* outputs) {
+        // The state of the gas has been reset, and is copied to the reactor
+        m_reactor.syncState();
+        m_net.setInitialTime(0.0);
+        double T0 = m_reactor.temperature();
+        while (m_reactor.temperature() < T0 + 400.0) {
+            if (m_net.step() > 1.0) {
+                throw CanteraError("IgnitionCase::run", "No ignition");
+            }
+        }
+        outputs[0] = m_net.time();
+        outputs[1] = m_reactor.temperature();
+    }
+
+protected:
+    IdealGasConstPressureReactor m_reactor;
+    ReactorNet m_net;
+};
+
+void run(size_t nSamples, size_t nThreads)
+{
+    auto gas = newSolution("gri30.yaml", "gri30", "None");
+    gas->thermo()->setState_TPX(1200.0, OneAtm, "CH4:0.5, O2:1.0, N2:3.76");
+
+    UncertaintyEnsemble ensemble(gas, []() {
+        return std::unique_ptr<EnsembleCase>(new IgnitionCase());
+    });
+
+    // Use an uncertainty factor of 2 for all reactions, and of 3 for the
+    // reactions of CH3
+    size_t nReactions = gas->kinetics()->nReactions();
+    vector_fp factors(nReactions, 2.0);
+    for (size_t i = 0; i < nReactions; i++) {
+        auto R = gas->kinetics()->reaction(i);
+        if (R->reactants.count("CH3") || R->products.count("CH3")) {
+            factors[i] = 3.0;
+        }
+    }
+    ensemble.setUncertaintyFactors(factors);
+    ensemble.setDistribution("log-normal", 2.0);
+    ensemble.setThreads(nThreads);
+    ensemble.setOutputFile("ensemble_ignition.csv");
+    ensemble.run(nSamples);
+
+    // Statistics of the logarithm of the ignition delay time
+    const Array2D& results = ensemble.results();
+    double sum = 0.0, sum2 = 0.0;
+    size_t n = 0;
+    for (size_t k = 0; k < nSamples; k++) {
+        if (std::isnan(results(k, 0))) {
+            continue;
+        }
+        double x = std::log(results(k, 0));
+        sum += x;
+        sum2 += x * x;
+        n++;
+    }
+    double mean = sum / n;
+    double sigma = std::sqrt(std::max(sum2 / n - mean * mean, 0.0));
+
+    writelog("Samples: {} ({} failed), threads: {}\n", nSamples,
+             ensemble.nFailed(), ensemble.nWorkers());
+    writelog("Ignition delay time: median {:.4e} s, "
+             "uncertainty factor (2 sigma) {:.3f}\n",
+             std::exp(mean), std::exp(2 * sigma));
+}
+
+int main(int argc, char** argv)
+{
+    size_t nSamples = (argc > 1) ? std::stoul(argv[1]) : 200;
+    size_t nThreads = (argc > 2) ? std::stoul(argv[2]) : 0;
+    try {
+        run(nSamples, nThreads);
+        appdelete();
+        return 0;
+    } catch (CanteraError& err) {
+        // handle exceptions thrown by Cantera
+        std::cout << err.what() << std::endl;
+        std::cout << " terminating... " << std::endl;
+        appdelete();
+        return 1;
+    }
+}
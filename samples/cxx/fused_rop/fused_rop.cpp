@@ -0,0 +1,162 @@
+/*!
+ * @file fused_rop.cpp
+ *
+ * Fused evaluation of net production rates
+ *
+ * This example compares the evaluation of net production rates using the
+ * stoichiometry managers, which traverse the reactions in several passes, with
+ * the fused evaluation, which streams a single compressed layout of the
+ * reaction stoichiometry once per evaluation (see FusedRopKernel). The wall
+ * time per evaluation is measured, both in total and excluding the evaluation
+ * of rate constants and concentrations, which is the same for both approaches.
+ * In addition, the amount of data read and written per evaluation is estimated
+ * from the sizes of the arrays involved; the actual memory traffic depends on
+ * the caches of the processor and is not measured.
+ *
+ * Usage: fused_rop [mechanism] [number of evaluations]
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/base/Solution.h"
+#include <chrono>
+#include <iostream>
+
+using namespace Cantera;
+
+//! Average wall time [s] of `nEval` evaluations of the net production rates,
+//! where the composition alternates between `Y1` and `Y2` such that the rates
+//! of progress are recomputed in each evaluation
+double timeEvaluations(ThermoPhase& gas, Kinetics& kin, const vector_fp& Y1,
+                       const vector_fp& Y2, size_t nEval)
+{
+    vector_fp wdot(kin.nTotalSpecies());
+    auto start = std::chrono::steady_clock::now();
+    for (size_t n = 0; n < nEval; n++) {
+        gas.setMassFractions_NoNorm((n % 2) ? Y2.data() : Y1.data());
+        kin.getNetProductionRates(wdot.data());
+    }
+    std::chrono::duration<double> dt = std::chrono::steady_clock::now() - start;
+    return dt.count() / nEval;
+}
+
+//! Average wall time [s] of `nEval` evaluations as for timeEvaluations(),
+//! excluding the time spent in the evaluation of rate constants and
+//! concentrations as recorded by the kinetics manager's instrumentation
+double timeRopEvaluations(ThermoPhase& gas, Kinetics& kin, const vector_fp& Y1,
+                          const vector_fp& Y2, size_t nEval)
+{
+    kin.setInstrumentation(true);
+    kin.clearInstrumentation();
+    double total = nEval * timeEvaluations(gas, kin, Y1, Y2, nEval);
+    AnyMap report = kin.instrumentationReport();
+    kin.setInstrumentation(false);
+    for (const auto& name : {"update_rates_T", "update_rates_C"}) {
+        if (report.hasKey(name)) {
+            total -= report[name]["time"].asDouble();
+        }
+    }
+    return total / nEval;
+}
+
+void run(const std::string& mech, size_t nEval)
+{
+    auto sol = newSolution(mech, "", "None");
+    auto gas = sol->thermo();
+    auto& kin = dynamic_cast<GasKinetics&>(*sol->kinetics());
+    size_t nsp = gas->nSpecies();
+    size_t nr = kin.nReactions();
+
+    // Two compositions with all species present
+    vector_fp Y1(nsp), Y2(nsp);
+    for (size_t k = 0; k < nsp; k++) {
+        Y1[k] = 1.0 + 0.1 * (k % 7);
+        Y2[k] = 1.0 + 0.1 * (k % 5);
+    }
+    gas->setState_TPY(1500.0, OneAtm, Y1.data());
+    gas->getMassFractions(Y1.data());
+    gas->setMassFractions(Y2.data());
+    gas->getMassFractions(Y2.data());
+
+    // Evaluate once using each approach to compare the results and to build
+    // the fused kernel
+    vector_fp wdot_multi(nsp), wdot_fused(nsp);
+    gas->setMassFractions_NoNorm(Y1.data());
+    kin.getNetProductionRates(wdot_multi.data());
+    kin.setFusedEvaluation(true);
+    gas->setMassFractions_NoNorm(Y1.data());
+    kin.getNetProductionRates(wdot_fused.data());
+    double maxDiff = 0.0;
+    double maxRate = 0.0;
+    for (size_t k = 0; k < nsp; k++) {
+        maxDiff = std::max(maxDiff, std::abs(wdot_fused[k] - wdot_multi[k]));
+        maxRate = std::max(maxRate, std::abs(wdot_multi[k]));
+    }
+
+    // Estimated data read and written per evaluation. Both approaches read the
+    // species concentrations and write the net production rates. In addition,
+    // the multi-pass evaluation reads and writes the vectors of forward and
+    // reverse rates of progress in four passes (perturbation factors and
+    // equilibrium constants, two concentration products and net rates of
+    // progress) and reads the net rates of progress twice when accumulating
+    // the production rates; the fused evaluation reads the rate coefficients,
+    // perturbation factors and equilibrium constants and writes the three
+    // vectors of rates of progress once.
+    const FusedRopKernel& kernel = kin.fusedKernel();
+    size_t multiVec = 14 * nr * sizeof(double) + 3 * nsp * sizeof(double);
+    size_t fusedVec = 6 * nr * sizeof(double) + 2 * nsp * sizeof(double);
+    size_t multiBytes = kernel.multiPassDataSize() + multiVec;
+    size_t fusedBytes = kernel.dataSize() + fusedVec;
+
+    kin.setFusedEvaluation(false);
+    double tMulti = timeEvaluations(*gas, kin, Y1, Y2, nEval);
+    kin.setFusedEvaluation(true);
+    double tFused = timeEvaluations(*gas, kin, Y1, Y2, nEval);
+    kin.setFusedEvaluation(false);
+    double tRopMulti = timeRopEvaluations(*gas, kin, Y1, Y2, nEval);
+    kin.setFusedEvaluation(true);
+    double tRopFused = timeRopEvaluations(*gas, kin, Y1, Y2, nEval);
+
+    writelog("Mechanism: {} ({} species, {} reactions)\n", mech, nsp, nr);
+    writelog("Maximum relative difference of net production rates: {:.2e}\n\n",
+             maxDiff / maxRate);
+    writelog("                               multi-pass      fused\n");
+    writelog("Measured time per call [us]\n");
+    writelog("  total                        {:10.3f}   {:10.3f}\n",
+             1e6 * tMulti, 1e6 * tFused);
+    writelog("  excluding rate constants     {:10.3f}   {:10.3f}   ({:.1f}% less)\n",
+             1e6 * tRopMulti, 1e6 * tRopFused,
+             100.0 * (1.0 - tRopFused / tRopMulti));
+    writelog("Estimated data per call [bytes]\n");
+    writelog("  index data                   {:10d}   {:10d}\n",
+             kernel.multiPassDataSize(), kernel.dataSize());
+    writelog("  vector data                  {:10d}   {:10d}\n",
+             multiVec, fusedVec);
+    writelog("  total                        {:10d}   {:10d}   ({:.1f}% less)\n",
+             multiBytes, fusedBytes,
+             100.0 * (1.0 - double(fusedBytes) / multiBytes));
+    writelog("\nTimes excluding rate constants omit the evaluation of rate "
+             "constants,\nconcentrations and third-body efficiencies, which is "
+             "the same for both\napproaches. Data sizes are estimated from the "
+             "sizes of the arrays involved\nand do not account for caching.\n");
+}
+
+int main(int argc, char** argv)
+{
+    std::string mech = (argc > 1) ? argv[1] : "gri30.yaml";
+    size_t nEval = (argc > 2) ? std::stoul(argv[2]) : 20000;
+    try {
+        run(mech, nEval);
+        appdelete();
+        return 0;
+    } catch (CanteraError& err) {
+        // handle exceptions thrown by Cantera
+        std::cout << err.what() << std::endl;
+        std::cout << " terminating... " << std::endl;
+        appdelete();
+        return 1;
+    }
+}
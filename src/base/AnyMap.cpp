@@ -14,7 +14,9 @@
 #endif
 
 #include <boost/algorithm/string.hpp>
+#include <cstring>
 #include <fstream>
+#include <limits>
 #include <mutex>
 #include <unordered_set>
 
@@ -28,6 +30,126 @@ std::mutex yaml_cache_mutex;
 std::mutex yaml_field_order_mutex;
 using namespace Cantera;
 
+//! Identifier at the start of the binary representation of an AnyMap
+const char binaryMagic[8] = {'C', 'T', 'A', 'N', 'Y', 'M', 'A', 'P'};
+
+//! Version of the binary representation, which is incremented for any
+//! incompatible changes of the format
+const uint32_t binaryVersion = 2;
+
+//! Tags identifying the type of values in the binary representation
+enum class BinaryType : unsigned char {
+    Empty, Double, Integer, Bool, String, Map, ValueList, MapList,
+    DoubleList, IntegerList, BoolList, StringList,
+    DoubleList2, IntegerList2, BoolList2, StringList2
+};
+
+template <class T>
+void writeBinary(string& out, const T& value)
+{
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void writeBinary(string& out, const string& value)
+{
+    writeBinary<uint64_t>(out, value.size());
+    out.append(value);
+}
+
+void writeBinary(string& out, bool value)
+{
+    writeBinary<unsigned char>(out, value);
+}
+
+// Integers are always stored as 64-bit values, independent of `sizeof(long)`
+void writeBinary(string& out, long int value)
+{
+    writeBinary<int64_t>(out, value);
+}
+
+template <class T>
+void writeBinary(string& out, const vector<T>& values)
+{
+    writeBinary<uint64_t>(out, values.size());
+    for (const auto& value : values) {
+        writeBinary(out, static_cast<const T&>(value));
+    }
+}
+
+void checkBinarySize(const char* pos, const char* end, size_t n)
+{
+    if (static_cast<size_t>(end - pos) < n) {
+        throw CanteraError("AnyMap::fromBinaryString",
+                           "Unexpected end of binary data");
+    }
+}
+
+template <class T>
+void readBinary(const char*& pos, const char* end, T& value)
+{
+    checkBinarySize(pos, end, sizeof(T));
+    std::memcpy(&value, pos, sizeof(T));
+    pos += sizeof(T);
+}
+
+void readBinary(const char*& pos, const char* end, string& value)
+{
+    uint64_t n;
+    readBinary(pos, end, n);
+    checkBinarySize(pos, end, n);
+    value.assign(pos, n);
+    pos += n;
+}
+
+void readBinary(const char*& pos, const char* end, bool& value)
+{
+    unsigned char b;
+    readBinary(pos, end, b);
+    value = b;
+}
+
+void readBinary(const char*& pos, const char* end, vector<bool>::reference value)
+{
+    unsigned char b;
+    readBinary(pos, end, b);
+    value = b;
+}
+
+void readBinary(const char*& pos, const char* end, long int& value)
+{
+    int64_t i;
+    readBinary<int64_t>(pos, end, i);
+    if (i < std::numeric_limits<long int>::min()
+        || i > std::numeric_limits<long int>::max()) {
+        throw CanteraError("AnyMap::fromBinaryString",
+                           "Integer value {} is out of range", i);
+    }
+    value = static_cast<long int>(i);
+}
+
+template <class T>
+void readBinary(const char*& pos, const char* end, vector<T>& values)
+{
+    uint64_t n;
+    readBinary(pos, end, n);
+    // each element occupies at least one byte
+    checkBinarySize(pos, end, n);
+    values.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        readBinary(pos, end, values[i]);
+    }
+}
+
+template <class T>
+AnyValue readBinaryValue(const char*& pos, const char* end)
+{
+    T value;
+    readBinary(pos, end, value);
+    AnyValue out;
+    out = std::move(value);
+    return out;
+}
+
 bool isFloat(const std::string& val)
 {
     // This function duplicates the logic of fpValueCheck, but doesn't throw
@@ -1776,22 +1898,25 @@ AnyMap AnyMap::fromYamlString(const std::string& yaml) {
     return amap;
 }
 
-AnyMap AnyMap::fromYamlFile(const std::string& name,
-                            const std::string& parent_name)
+std::string AnyMap::findFile(const std::string& name,
+                             const std::string& parent_name)
 {
-    std::string fullName;
     // See if a file with this name exists in a path relative to the parent file
     size_t islash = parent_name.find_last_of("/\\");
     if (islash != npos) {
         std::string parent_path = parent_name.substr(0, islash);
         if (std::ifstream(parent_path + "/" + name).good()) {
-            fullName = parent_path + "/" + name;
+            return parent_path + "/" + name;
         }
     }
     // Otherwise, search the Cantera include path for the file
-    if (fullName.empty()) {
-        fullName = findInputFile(name);
-    }
+    return findInputFile(name);
+}
+
+AnyMap AnyMap::fromYamlFile(const std::string& name,
+                            const std::string& parent_name)
+{
+    std::string fullName = findFile(name, parent_name);
 
     // Check for an already-parsed YAML file with the same last-modified time,
     // and return that if possible
@@ -1835,6 +1960,316 @@ AnyMap AnyMap::fromYamlFile(const std::string& name,
     return cache_item.first;
 }
 
+AnyMap AnyMap::fromBinaryFile(const std::string& name,
+                              const std::string& parent_name)
+{
+    std::string fullName = findFile(name, parent_name);
+
+    // Use an already-read binary file with the same last-modified time if
+    // possible. Consistency with the source file is checked in either case.
+    AnyMap amap;
+    int mtime = get_modified_time(fullName);
+    std::unique_lock<std::mutex> lock(yaml_cache_mutex);
+    auto iter = s_cache.find(fullName);
+    if (iter != s_cache.end() && iter->second.second == mtime) {
+        amap = iter->second.first;
+    } else {
+        std::ifstream infile(fullName, std::ios::binary);
+        if (!infile.good()) {
+            throw CanteraError("AnyMap::fromBinaryFile", "Input file '{}' not "
+                "found on the Cantera search path.", name);
+        }
+        std::string data((std::istreambuf_iterator<char>(infile)),
+                         std::istreambuf_iterator<char>());
+        amap = fromBinaryString(data);
+        auto& cache_item = s_cache[fullName];
+        cache_item.first = amap;
+        cache_item.second = mtime;
+        if (amap.hasKey("deprecated")) {
+            warn_deprecated(fullName, amap["deprecated"].asString());
+        }
+    }
+    lock.unlock();
+
+    // Check whether the binary file is consistent with its source. Input file
+    // context for error messages is only available if the source exists.
+    std::string source = fullName;
+    if (amap.hasKey("__source__")) {
+        const AnyMap& info = amap["__source__"].as<AnyMap>();
+        const std::string& yamlName = info["file"].asString();
+        if (std::ifstream(yamlName).good()) {
+            if (fileChecksum(yamlName) != info["checksum"].asString()) {
+                throw CanteraError("AnyMap::fromBinaryFile", "Binary file '{}' "
+                    "is out of date, as its source '{}' has changed since it "
+                    "was created.", fullName, yamlName);
+            }
+            amap.setMetadata("filename", AnyValue(yamlName));
+            source = yamlName;
+        }
+        // Files from which elements, species or reactions are imported
+        if (info.hasKey("imports")) {
+            for (const auto& item : info["imports"].asVector<AnyMap>()) {
+                const std::string& name = item["file"].asString();
+                if (std::ifstream(name).good()
+                    && fileChecksum(name) != item["checksum"].asString()) {
+                    throw CanteraError("AnyMap::fromBinaryFile", "Binary file "
+                        "'{}' is out of date, as the file '{}' imported by its "
+                        "source has changed since it was created.",
+                        fullName, name);
+                }
+            }
+        }
+    }
+    amap["__file__"] = source;
+    return amap;
+}
+
+AnyMap AnyMap::fromBinaryString(const std::string& data)
+{
+    const char* pos = data.data();
+    const char* end = pos + data.size();
+    char magic[sizeof(binaryMagic)];
+    uint32_t version;
+    if (data.size() < sizeof(binaryMagic) + sizeof(version)
+        || !std::equal(binaryMagic, binaryMagic + sizeof(binaryMagic), pos))
+    {
+        throw CanteraError("AnyMap::fromBinaryString",
+                           "Data is not a binary representation of an AnyMap");
+    }
+    ::readBinary(pos, end, magic);
+    ::readBinary(pos, end, version);
+    if (version != binaryVersion) {
+        throw CanteraError("AnyMap::fromBinaryString", "Unsupported version {} "
+            "of binary data (expected version {})", version, binaryVersion);
+    }
+    double check;
+    ::readBinary(pos, end, check);
+    if (check != 1.0 / 3.0) {
+        throw CanteraError("AnyMap::fromBinaryString", "Binary data was "
+            "created on a machine with a different byte order or number format");
+    }
+    AnyMap amap;
+    amap.readBinary(pos, end);
+    if (pos != end) {
+        throw CanteraError("AnyMap::fromBinaryString",
+                           "Unexpected data after the end of the map");
+    }
+    amap.applyUnits();
+    return amap;
+}
+
+std::string AnyMap::toBinaryString() const
+{
+    std::string out(binaryMagic, sizeof(binaryMagic));
+    ::writeBinary(out, binaryVersion);
+    // A known value used to detect differences in byte order or number format
+    ::writeBinary(out, 1.0 / 3.0);
+    writeBinary(out);
+    return out;
+}
+
+std::string AnyMap::fileChecksum(const std::string& filename)
+{
+    std::ifstream infile(filename, std::ios::binary);
+    if (!infile.good()) {
+        throw CanteraError("AnyMap::fileChecksum",
+                           "Unable to open file '{}'", filename);
+    }
+    // 64-bit FNV-1a hash
+    uint64_t hash = 14695981039346656037ull;
+    char buffer[65536];
+    while (infile) {
+        infile.read(buffer, sizeof(buffer));
+        for (std::streamsize i = 0; i < infile.gcount(); i++) {
+            hash ^= static_cast<unsigned char>(buffer[i]);
+            hash *= 1099511628211ull;
+        }
+    }
+    return fmt::format("{:016x}", hash);
+}
+
+void AnyMap::writeBinary(std::string& out) const
+{
+    ::writeBinary<int32_t>(out, m_line);
+    ::writeBinary<int32_t>(out, m_column);
+    ::writeBinary<uint64_t>(out, m_data.size());
+    for (const auto& item : m_data) {
+        ::writeBinary(out, item.first);
+        writeBinary(out, item.second);
+    }
+}
+
+void AnyMap::writeBinary(std::string& out, const AnyValue& value)
+{
+    auto loc = value.order();
+    ::writeBinary<int32_t>(out, loc.first);
+    ::writeBinary<int32_t>(out, loc.second);
+    if (value.is<void>()) {
+        ::writeBinary(out, BinaryType::Empty);
+    } else if (value.is<double>()) {
+        ::writeBinary(out, BinaryType::Double);
+        ::writeBinary(out, value.as<double>());
+    } else if (value.is<long int>()) {
+        ::writeBinary(out, BinaryType::Integer);
+        ::writeBinary(out, value.as<long int>());
+    } else if (value.is<bool>()) {
+        ::writeBinary(out, BinaryType::Bool);
+        ::writeBinary(out, value.as<bool>());
+    } else if (value.is<string>()) {
+        ::writeBinary(out, BinaryType::String);
+        ::writeBinary(out, value.as<string>());
+    } else if (value.is<AnyMap>()) {
+        ::writeBinary(out, BinaryType::Map);
+        value.as<AnyMap>().writeBinary(out);
+    } else if (value.is<vector<AnyValue>>()) {
+        ::writeBinary(out, BinaryType::ValueList);
+        const auto& items = value.as<vector<AnyValue>>();
+        ::writeBinary<uint64_t>(out, items.size());
+        for (const auto& item : items) {
+            writeBinary(out, item);
+        }
+    } else if (value.is<vector<AnyMap>>()) {
+        ::writeBinary(out, BinaryType::MapList);
+        const auto& items = value.as<vector<AnyMap>>();
+        ::writeBinary<uint64_t>(out, items.size());
+        for (const auto& item : items) {
+            item.writeBinary(out);
+        }
+    } else if (value.is<vector<double>>()) {
+        ::writeBinary(out, BinaryType::DoubleList);
+        ::writeBinary(out, value.as<vector<double>>());
+    } else if (value.is<vector<long int>>()) {
+        ::writeBinary(out, BinaryType::IntegerList);
+        ::writeBinary(out, value.as<vector<long int>>());
+    } else if (value.is<vector<bool>>()) {
+        ::writeBinary(out, BinaryType::BoolList);
+        ::writeBinary(out, value.as<vector<bool>>());
+    } else if (value.is<vector<string>>()) {
+        ::writeBinary(out, BinaryType::StringList);
+        ::writeBinary(out, value.as<vector<string>>());
+    } else if (value.is<vector<vector<double>>>()) {
+        ::writeBinary(out, BinaryType::DoubleList2);
+        ::writeBinary(out, value.as<vector<vector<double>>>());
+    } else if (value.is<vector<vector<long int>>>()) {
+        ::writeBinary(out, BinaryType::IntegerList2);
+        ::writeBinary(out, value.as<vector<vector<long int>>>());
+    } else if (value.is<vector<vector<bool>>>()) {
+        ::writeBinary(out, BinaryType::BoolList2);
+        ::writeBinary(out, value.as<vector<vector<bool>>>());
+    } else if (value.is<vector<vector<string>>>()) {
+        ::writeBinary(out, BinaryType::StringList2);
+        ::writeBinary(out, value.as<vector<vector<string>>>());
+    } else {
+        throw CanteraError("AnyMap::toBinaryString",
+            "Unable to write value of type '{}'", value.type_str());
+    }
+}
+
+void AnyMap::readBinary(const char*& pos, const char* end)
+{
+    int32_t line, column;
+    uint64_t n;
+    ::readBinary(pos, end, line);
+    ::readBinary(pos, end, column);
+    ::readBinary(pos, end, n);
+    setLoc(line, column);
+    // each entry occupies at least one byte
+    checkBinarySize(pos, end, n);
+    m_data.reserve(n);
+    std::string key;
+    for (size_t i = 0; i < n; i++) {
+        ::readBinary(pos, end, key);
+        AnyValue& value = m_data[key];
+        readBinary(pos, end, value);
+        value.setKey(key);
+    }
+}
+
+void AnyMap::readBinary(const char*& pos, const char* end, AnyValue& value)
+{
+    int32_t line, column;
+    BinaryType type;
+    ::readBinary(pos, end, line);
+    ::readBinary(pos, end, column);
+    ::readBinary(pos, end, type);
+    switch (type) {
+    case BinaryType::Empty:
+        value = AnyValue();
+        break;
+    case BinaryType::Double:
+        value = readBinaryValue<double>(pos, end);
+        break;
+    case BinaryType::Integer:
+        value = readBinaryValue<long int>(pos, end);
+        break;
+    case BinaryType::Bool:
+        value = readBinaryValue<bool>(pos, end);
+        break;
+    case BinaryType::String:
+        value = readBinaryValue<string>(pos, end);
+        break;
+    case BinaryType::Map:
+    {
+        AnyMap m;
+        m.readBinary(pos, end);
+        value = std::move(m);
+        break;
+    }
+    case BinaryType::ValueList:
+    {
+        uint64_t n;
+        ::readBinary(pos, end, n);
+        checkBinarySize(pos, end, n);
+        vector<AnyValue> items(n);
+        for (auto& item : items) {
+            readBinary(pos, end, item);
+        }
+        value = std::move(items);
+        break;
+    }
+    case BinaryType::MapList:
+    {
+        uint64_t n;
+        ::readBinary(pos, end, n);
+        checkBinarySize(pos, end, n);
+        vector<AnyMap> items(n);
+        for (auto& item : items) {
+            item.readBinary(pos, end);
+        }
+        value = std::move(items);
+        break;
+    }
+    case BinaryType::DoubleList:
+        value = readBinaryValue<vector<double>>(pos, end);
+        break;
+    case BinaryType::IntegerList:
+        value = readBinaryValue<vector<long int>>(pos, end);
+        break;
+    case BinaryType::BoolList:
+        value = readBinaryValue<vector<bool>>(pos, end);
+        break;
+    case BinaryType::StringList:
+        value = readBinaryValue<vector<string>>(pos, end);
+        break;
+    case BinaryType::DoubleList2:
+        value = readBinaryValue<vector<vector<double>>>(pos, end);
+        break;
+    case BinaryType::IntegerList2:
+        value = readBinaryValue<vector<vector<long int>>>(pos, end);
+        break;
+    case BinaryType::BoolList2:
+        value = readBinaryValue<vector<vector<bool>>>(pos, end);
+        break;
+    case BinaryType::StringList2:
+        value = readBinaryValue<vector<vector<string>>>(pos, end);
+        break;
+    default:
+        throw CanteraError("AnyMap::fromBinaryString",
+            "Unknown type tag {}", static_cast<int>(type));
+    }
+    value.setLoc(line, column);
+}
+
 std::string AnyMap::toYamlString() const
 {
     YAML::Emitter out;
@@ -13,7 +13,10 @@
 #include "cantera/kinetics/KineticsFactory.h"
 #include "cantera/transport/TransportBase.h"
 #include "cantera/transport/TransportFactory.h"
+#include "cantera/transport/GasTransport.h"
 #include "cantera/base/stringUtils.h"
+#include <fstream>
+#include <set>
 
 namespace Cantera
 {
@@ -120,9 +123,10 @@ shared_ptr<Solution> newSolution(const std::string& infile,
         extension = toLowerCopy(infile.substr(dot+1));
     }
 
-    if (extension == "yml" || extension == "yaml") {
-        // load YAML file
-        auto rootNode = AnyMap::fromYamlFile(infile);
+    if (extension == "yml" || extension == "yaml" || extension == "ctb") {
+        // load YAML file or its binary representation
+        auto rootNode = (extension == "ctb") ? AnyMap::fromBinaryFile(infile)
+                                             : AnyMap::fromYamlFile(infile);
         AnyMap& phaseNode = rootNode["phases"].getMapWhere("name", name);
         auto sol = newSolution(phaseNode, rootNode, transport, adjacent);
         sol->setSource(infile);
@@ -205,4 +209,104 @@ shared_ptr<Solution> newSolution(AnyMap& phaseNode,
     return sol;
 }
 
+namespace {
+
+//! Add the files containing the sections `file/section` referenced by the
+//! `elements`, `species` or `reactions` entry `key` of a phase definition to
+//! `files`
+void addImportedFiles(const AnyMap& phaseNode, const std::string& key,
+                      const std::string& parent, std::set<std::string>& files)
+{
+    if (!phaseNode.hasKey(key)) {
+        return;
+    }
+    // Lists of maps have the section as the key of their only item, while
+    // lists of names only refer to sections for 'reactions'
+    const AnyValue& sections = phaseNode[key];
+    std::vector<std::string> names;
+    if (sections.is<std::vector<AnyMap>>()) {
+        for (const auto& item : sections.asVector<AnyMap>()) {
+            names.push_back(item.begin()->first);
+        }
+    } else if (sections.is<std::vector<std::string>>() && key == "reactions") {
+        names = sections.asVector<std::string>();
+    }
+    for (const auto& name : names) {
+        size_t slash = name.rfind('/');
+        if (slash != npos) {
+            // The file is located in the same way as when it is imported
+            AnyMap imported = AnyMap::fromYamlFile(name.substr(0, slash), parent);
+            files.insert(imported["__file__"].asString());
+        }
+    }
+}
+
+}
+
+void compileMechanism(const std::string& infile, const std::string& outfile,
+                      const std::vector<std::string>& transport)
+{
+    AnyMap root = AnyMap::fromYamlFile(infile);
+    std::string source = root["__file__"].asString();
+    root.erase("__file__");
+
+    // Files from which phases import elements, species or reactions
+    std::set<std::string> imports;
+
+    // Store transport property fits for phases using gas transport models
+    if (root.hasKey("phases")) {
+        for (auto& phaseNode : root["phases"].asVector<AnyMap>()) {
+            for (const auto& key : {"elements", "species", "reactions"}) {
+                addImportedFiles(phaseNode, key, source, imports);
+            }
+            if (!phaseNode.hasKey("transport")) {
+                continue;
+            }
+            unique_ptr<ThermoPhase> thermo(newPhase(phaseNode, root));
+            unique_ptr<Transport> tr(newDefaultTransportMgr(thermo.get()));
+            if (!dynamic_cast<GasTransport*>(tr.get())) {
+                continue;
+            }
+            std::vector<AnyMap> fits;
+            fits.push_back(dynamic_cast<GasTransport&>(*tr).fittedProperties());
+            for (const auto& model : transport) {
+                tr.reset(newTransportMgr(model, thermo.get()));
+                auto gas = dynamic_cast<GasTransport*>(tr.get());
+                if (!gas) {
+                    throw CanteraError("compileMechanism", "Transport model "
+                        "'{}' is not a gas transport model", model);
+                }
+                bool found = false;
+                for (const auto& item : fits) {
+                    found |= (item["model"] == gas->transportType()
+                              && item["CK-mode"].asBool() == gas->CKMode());
+                }
+                if (!found) {
+                    fits.push_back(gas->fittedProperties());
+                }
+            }
+            phaseNode["__transport-fits__"] = std::move(fits);
+        }
+    }
+
+    root["__source__"]["file"] = source;
+    root["__source__"]["checksum"] = AnyMap::fileChecksum(source);
+    if (!imports.empty()) {
+        std::vector<AnyMap> files;
+        for (const auto& name : imports) {
+            AnyMap item;
+            item["file"] = name;
+            item["checksum"] = AnyMap::fileChecksum(name);
+            files.push_back(std::move(item));
+        }
+        root["__source__"]["imports"] = std::move(files);
+    }
+    std::ofstream out(outfile, std::ios::binary);
+    out << root.toBinaryString();
+    if (!out.good()) {
+        throw CanteraError("compileMechanism",
+                           "Unable to write file '{}'", outfile);
+    }
+}
+
 } // namespace Cantera
@@ -38,6 +38,9 @@ static std::mutex app_mutex;
 //! Mutex for controlling access to XML file storage
 static std::mutex xml_mutex;
 
+//! Mutex for controlling access to the set of emitted deprecation warnings
+static std::mutex warnings_mutex;
+
 int get_modified_time(const std::string& path) {
 #ifdef _WIN32
     HANDLE hFile = CreateFile(path.c_str(), 0, 0,
@@ -171,10 +174,13 @@ void Application::warn_deprecated(const std::string& method,
 {
     if (m_fatal_deprecation_warnings) {
         throw CanteraError(method, "Deprecated: " + extra);
-    } else if (m_suppress_deprecation_warnings || warnings.count(method)) {
+    } else if (m_suppress_deprecation_warnings) {
+        return;
+    }
+    std::unique_lock<std::mutex> warningsLock(warnings_mutex);
+    if (!warnings.insert(method).second) {
         return;
     }
-    warnings.insert(method);
     writelog(fmt::format("DeprecationWarning: {}: {}", method, extra));
     writelogendl();
 }
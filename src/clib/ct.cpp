@@ -1184,6 +1184,18 @@ extern "C" {
         }
     }
 
+    int kin_getNetProductionRatesBatch(int n, size_t nStates, const double* T,
+                                       const double* P, const double* Y,
+                                       double* wdot)
+    {
+        try {
+            KineticsCabinet::item(n).getNetProductionRates(nStates, T, P, Y, wdot);
+            return 0;
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+
     int kin_getSourceTerms(int n, size_t len, double* ydot)
     {
         try {
@@ -1275,6 +1287,36 @@ extern "C" {
         }
     }
 
+    int kin_setInstrumentation(int n, int enabled)
+    {
+        try {
+            KineticsCabinet::item(n).setInstrumentation(enabled != 0);
+            return 0;
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+
+    int kin_clearInstrumentation(int n)
+    {
+        try {
+            KineticsCabinet::item(n).clearInstrumentation();
+            return 0;
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+
+    int kin_getInstrumentationReport(int n, int len, char* buf)
+    {
+        try {
+            AnyMap report = KineticsCabinet::item(n).instrumentationReport();
+            return static_cast<int>(copyString(report.toYamlString(), buf, len));
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+    }
+
     //------------------- Transport ---------------------------
 
     int trans_newDefault(int ith, int loglevel)
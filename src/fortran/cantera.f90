@@ -175,6 +175,10 @@ MODULE CANTERA
      MODULE PROCEDURE ctkin_getNetProductionRates
   END INTERFACE getNetProductionRates
 
+  INTERFACE getNetProductionRatesBatch
+     MODULE PROCEDURE ctkin_getNetProductionRatesBatch
+  END INTERFACE getNetProductionRatesBatch
+
   INTERFACE getNetRatesOfProgress
      MODULE PROCEDURE ctkin_getNetRatesOfProgress
   END INTERFACE getNetRatesOfProgress
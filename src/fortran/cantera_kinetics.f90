@@ -210,6 +210,17 @@ module cantera_kinetics
       self%err = kin_getnetproductionrates(self%kin_id, wdot)
     end subroutine ctkin_getnetproductionrates
 
+    subroutine ctkin_getNetProductionRatesBatch(self, nstates, t, p, y, wdot)
+      implicit none
+      type(phase_t), intent(inout) :: self
+      integer, intent(in) :: nstates
+      double precision, intent(in) :: t(*)
+      double precision, intent(in) :: p(*)
+      double precision, intent(in) :: y(*)
+      double precision, intent(out) :: wdot(*)
+      self%err = kin_getnetproductionratesbatch(self%kin_id, nstates, t, p, y, wdot)
+    end subroutine ctkin_getnetproductionratesbatch
+
     double precision function ctkin_multiplier(self, i)
       implicit none
       type(phase_t), intent(inout) :: self
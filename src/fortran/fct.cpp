@@ -878,6 +878,19 @@ extern "C" {
         return 0;
     }
 
+    status_t kin_getnetproductionratesbatch_(const integer* n,
+            const integer* nstates, const doublereal* t, const doublereal* p,
+            const doublereal* y, doublereal* wdot)
+    {
+        try {
+            Kinetics* k = _fkin(n);
+            k->getNetProductionRates(*nstates, t, p, y, wdot);
+        } catch (...) {
+            return handleAllExceptions(-1, ERR);
+        }
+        return 0;
+    }
+
     doublereal kin_multiplier_(const integer* n, integer* i)
     {
         try {
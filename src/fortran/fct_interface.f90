@@ -373,6 +373,15 @@ interface
         double precision, intent(out) :: wdot(*)
     end function kin_getnetproductionrates
 
+    integer function kin_getnetproductionratesbatch(n, nstates, t, p, y, wdot)
+        integer, intent(in) :: n
+        integer, intent(in) :: nstates
+        double precision, intent(in) :: t(*)
+        double precision, intent(in) :: p(*)
+        double precision, intent(in) :: y(*)
+        double precision, intent(out) :: wdot(*)
+    end function kin_getnetproductionratesbatch
+
     double precision function kin_multiplier(n, i)
         integer, intent(in) :: n
         integer, intent(in) :: i
@@ -137,6 +137,8 @@ bool BulkKinetics::addReaction(shared_ptr<Reaction> r, bool resize)
         if (m_bulk_types.find(rate->type()) == m_bulk_types.end()) {
             m_bulk_types[rate->type()] = m_bulk_rates.size();
             m_bulk_rates.push_back(rate->newMultiRate());
+            m_bulk_sections.push_back(
+                m_instrumentation.section("rates: " + rate->type()));
             m_bulk_rates.back()->resize(m_kk, nReactions());
         }
 
@@ -172,9 +174,10 @@ void BulkKinetics::addThirdBody(shared_ptr<Reaction> r)
                 "' while adding reaction '" + r->equation() + "'");
         }
     }
-    m_multi_concm.install(nReactions() - 1, efficiencies,
-                          r->thirdBody()->default_efficiency,
-                          r->thirdBody()->mass_action);
+    size_t row = m_efficiencies.addRow(efficiencies,
+                                       r->thirdBody()->default_efficiency);
+    m_concm_rows.push_back(0.0);
+    m_multi_concm.install(nReactions() - 1, row, r->thirdBody()->mass_action);
 }
 
 void BulkKinetics::addElementaryReaction(ElementaryReaction2& r)
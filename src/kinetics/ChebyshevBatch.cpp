@@ -0,0 +1,170 @@
+/**
+ *  @file ChebyshevBatch.cpp
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/ChebyshevBatch.h"
+#include "cantera/kinetics/RxnRates.h"
+
+namespace Cantera
+{
+
+ChebyshevBatch::ChebyshevBatch() :
+    m_packed(false),
+    m_recipT(NAN),
+    m_log10P(NAN)
+{
+}
+
+void ChebyshevBatch::clear()
+{
+    m_groups.clear();
+    m_packed = false;
+    m_recipT = NAN;
+    m_log10P = NAN;
+}
+
+void ChebyshevBatch::add(size_t rxn, const ChebyshevRate3& rate)
+{
+    const Array2D& coeffs = rate.data();
+    size_t nT = coeffs.nRows();
+    size_t nP = coeffs.nColumns();
+    auto iter = std::find_if(m_groups.begin(), m_groups.end(),
+        [&](const Group& g) {
+            return g.nT == nT && g.nP == nP
+                && g.Tmin == rate.Tmin() && g.Tmax == rate.Tmax()
+                && g.Pmin == rate.Pmin() && g.Pmax == rate.Pmax();
+        });
+    if (iter == m_groups.end()) {
+        m_groups.emplace_back();
+        iter = m_groups.end() - 1;
+        iter->nT = nT;
+        iter->nP = nP;
+        iter->Tmin = rate.Tmin();
+        iter->Tmax = rate.Tmax();
+        iter->Pmin = rate.Pmin();
+        iter->Pmax = rate.Pmax();
+    }
+    iter->rxn.push_back(rxn);
+    iter->data.push_back(coeffs);
+    m_packed = false;
+}
+
+void ChebyshevBatch::pack()
+{
+    for (auto& g : m_groups) {
+        size_t n = g.rxn.size();
+        g.coeffs.resize(g.nT * g.nP * n);
+        for (size_t i = 0; i < n; i++) {
+            for (size_t t = 0; t < g.nT; t++) {
+                for (size_t p = 0; p < g.nP; p++) {
+                    g.coeffs[(t * g.nP + p) * n + i] = g.data[i](t, p);
+                }
+            }
+        }
+        g.dotProd.resize(g.nT * n);
+        g.k.resize(n);
+    }
+    m_packed = true;
+    m_recipT = NAN;
+    m_log10P = NAN;
+}
+
+void ChebyshevBatch::polynomials(double x, size_t n, vector_fp& phi)
+{
+    phi.resize(n);
+    double Cnm1 = x;
+    double Cn = 1;
+    phi[0] = 1;
+    for (size_t j = 1; j < n; j++) {
+        double Cnp1 = 2 * x * Cn - Cnm1;
+        phi[j] = Cnp1;
+        Cnm1 = Cn;
+        Cn = Cnp1;
+    }
+}
+
+void ChebyshevBatch::updatePressure(double log10P)
+{
+    for (auto& g : m_groups) {
+        // reduced pressure as in ChebyshevRate3::update_C
+        double logPmin = std::log10(g.Pmin);
+        double logPmax = std::log10(g.Pmax);
+        double Pr = (2 * log10P + (- logPmin - logPmax))
+            * (1.0 / (logPmax - logPmin));
+        polynomials(Pr, g.nP, m_phi);
+
+        // contraction of the coefficients with the pressure polynomials
+        size_t n = g.rxn.size();
+        for (size_t t = 0; t < g.nT; t++) {
+            double* dot = &g.dotProd[t * n];
+            const double* c = &g.coeffs[t * g.nP * n];
+            for (size_t i = 0; i < n; i++) {
+                dot[i] = c[i];
+            }
+            for (size_t p = 1; p < g.nP; p++) {
+                const double phi = m_phi[p];
+                const double* cp = c + p * n;
+                for (size_t i = 0; i < n; i++) {
+                    dot[i] += phi * cp[i];
+                }
+            }
+        }
+    }
+    m_log10P = log10P;
+    m_recipT = NAN;
+}
+
+void ChebyshevBatch::updateTemperature(double recipT)
+{
+    for (auto& g : m_groups) {
+        // reduced temperature as in ChebyshevRate3::updateRC
+        double TminInv = 1.0 / g.Tmin;
+        double TmaxInv = 1.0 / g.Tmax;
+        double Tr = (2 * recipT + (- TminInv - TmaxInv))
+            * (1.0 / (TmaxInv - TminInv));
+        polynomials(Tr, g.nT, m_phi);
+
+        // contraction with the temperature polynomials
+        size_t n = g.rxn.size();
+        double* logk = g.k.data();
+        const double* dot = g.dotProd.data();
+        for (size_t i = 0; i < n; i++) {
+            logk[i] = dot[i];
+        }
+        for (size_t t = 1; t < g.nT; t++) {
+            const double phi = m_phi[t];
+            const double* dt = dot + t * n;
+            for (size_t i = 0; i < n; i++) {
+                logk[i] += phi * dt[i];
+            }
+        }
+        for (size_t i = 0; i < n; i++) {
+            logk[i] = std::pow(10, logk[i]);
+        }
+    }
+    m_recipT = recipT;
+}
+
+bool ChebyshevBatch::getRateConstants(const ChebyshevData& data, double* kf)
+{
+    if (!m_packed) {
+        pack();
+    }
+    if (data.log10P != m_log10P) {
+        updatePressure(data.log10P);
+    }
+    if (data.recipT != m_recipT) {
+        updateTemperature(data.recipT);
+    }
+    for (const auto& g : m_groups) {
+        for (size_t i = 0; i < g.rxn.size(); i++) {
+            kf[g.rxn[i]] = g.k[i];
+        }
+    }
+    return true;
+}
+
+}
@@ -0,0 +1,466 @@
+/**
+ *  @file DirectedRelationGraph.cpp
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/DirectedRelationGraph.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/kinetics/Reaction.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/thermo/Species.h"
+#include "cantera/base/Solution.h"
+
+#include <queue>
+#include <set>
+
+namespace Cantera
+{
+
+namespace {
+
+//! Explicit collision partner of a three-body or falloff reaction, or an empty
+//! string if the reaction does not have one
+std::string explicitCollider(Reaction& rxn)
+{
+    const ThirdBody* tbody = rxn.thirdBody().get();
+    if (auto r = dynamic_cast<ThreeBodyReaction2*>(&rxn)) {
+        tbody = &r->third_body;
+    } else if (auto r = dynamic_cast<FalloffReaction2*>(&rxn)) {
+        tbody = &r->third_body;
+    }
+    if (tbody && tbody->specified_collision_partner
+        && tbody->efficiencies.size() == 1) {
+        return tbody->efficiencies.begin()->first;
+    }
+    return "";
+}
+
+}
+
+void RelationGraph::build(Kinetics& kin)
+{
+    m_spStart.clear();
+    m_spIndex.clear();
+    m_spNu.clear();
+    m_edgeStart.clear();
+    m_edgeTarget.clear();
+    m_rxnStart.clear();
+    m_rxnEdge.clear();
+    m_rxnNu.clear();
+    size_t nsp = kin.nTotalSpecies();
+    size_t nrxn = kin.nReactions();
+
+    // Net stoichiometric coefficients of participating species
+    m_spStart.push_back(0);
+    for (size_t i = 0; i < nrxn; i++) {
+        std::map<size_t, double> nu;
+        auto rxn = kin.reaction(i);
+        for (const auto& sp : rxn->reactants) {
+            nu[kin.kineticsSpeciesIndex(sp.first)] -= sp.second;
+        }
+        for (const auto& sp : rxn->products) {
+            nu[kin.kineticsSpeciesIndex(sp.first)] += sp.second;
+        }
+        std::string collider = explicitCollider(*rxn);
+        if (collider != "") {
+            // participates without being consumed or produced
+            nu[kin.kineticsSpeciesIndex(collider)] += 0.0;
+        }
+        for (const auto& item : nu) {
+            m_spIndex.push_back(item.first);
+            m_spNu.push_back(item.second);
+        }
+        m_spStart.push_back(m_spIndex.size());
+    }
+
+    // Edges connect all pairs of species participating in the same reaction
+    std::vector<std::set<size_t>> adjacent(nsp);
+    for (size_t i = 0; i < nrxn; i++) {
+        for (size_t j = m_spStart[i]; j < m_spStart[i+1]; j++) {
+            for (size_t m = m_spStart[i]; m < m_spStart[i+1]; m++) {
+                if (m != j) {
+                    adjacent[m_spIndex[j]].insert(m_spIndex[m]);
+                }
+            }
+        }
+    }
+    m_edgeStart.push_back(0);
+    for (size_t k = 0; k < nsp; k++) {
+        m_edgeTarget.insert(m_edgeTarget.end(), adjacent[k].begin(),
+                            adjacent[k].end());
+        m_edgeStart.push_back(m_edgeTarget.size());
+    }
+
+    // Contributions of each reaction to the numerators of the edge weights
+    m_rxnStart.push_back(0);
+    for (size_t i = 0; i < nrxn; i++) {
+        for (size_t j = m_spStart[i]; j < m_spStart[i+1]; j++) {
+            size_t kA = m_spIndex[j];
+            auto begin = m_edgeTarget.begin() + m_edgeStart[kA];
+            auto end = m_edgeTarget.begin() + m_edgeStart[kA+1];
+            for (size_t m = m_spStart[i]; m < m_spStart[i+1]; m++) {
+                if (m != j) {
+                    auto iter = std::lower_bound(begin, end, m_spIndex[m]);
+                    m_rxnEdge.push_back(iter - m_edgeTarget.begin());
+                    m_rxnNu.push_back(m_spNu[j]);
+                }
+            }
+        }
+        m_rxnStart.push_back(m_rxnEdge.size());
+    }
+}
+
+void RelationGraph::evaluate(const double* ropnet,
+                             const std::vector<size_t>& targets, bool drg,
+                             double* R)
+{
+    size_t nsp = nSpecies();
+    size_t nrxn = nReactions();
+
+    // Numerators of the edge weights, and production and consumption rates
+    m_num.assign(m_edgeTarget.size(), 0.0);
+    m_prod.assign(nsp, 0.0);
+    m_cons.assign(nsp, 0.0);
+    for (size_t i = 0; i < nrxn; i++) {
+        double rop = ropnet[i];
+        for (size_t j = m_spStart[i]; j < m_spStart[i+1]; j++) {
+            double rate = m_spNu[j] * rop;
+            if (rate > 0) {
+                m_prod[m_spIndex[j]] += rate;
+            } else {
+                m_cons[m_spIndex[j]] -= rate;
+            }
+        }
+        for (size_t j = m_rxnStart[i]; j < m_rxnStart[i+1]; j++) {
+            double rate = m_rxnNu[j] * rop;
+            m_num[m_rxnEdge[j]] += drg ? std::abs(rate) : rate;
+        }
+    }
+    m_weight.resize(m_edgeTarget.size());
+    for (size_t k = 0; k < nsp; k++) {
+        double den = drg ? m_prod[k] + m_cons[k] : std::max(m_prod[k], m_cons[k]);
+        for (size_t e = m_edgeStart[k]; e < m_edgeStart[k+1]; e++) {
+            m_weight[e] = (den > 0) ? std::abs(m_num[e]) / den : 0.0;
+        }
+    }
+
+    // Graph search starting at all targets. The path coefficient is the
+    // smallest edge weight along the path for DRG and the product of the edge
+    // weights for DRGEP. In both cases, it does not increase along a path,
+    // such that a modified Dijkstra algorithm finds the best paths.
+    std::fill(R, R + nsp, 0.0);
+    std::priority_queue<std::pair<double, size_t>> queue;
+    for (size_t k : targets) {
+        R[k] = 1.0;
+        queue.emplace(1.0, k);
+    }
+    while (!queue.empty()) {
+        double RA = queue.top().first;
+        size_t kA = queue.top().second;
+        queue.pop();
+        if (RA < R[kA]) {
+            continue; // outdated entry
+        }
+        for (size_t e = m_edgeStart[kA]; e < m_edgeStart[kA+1]; e++) {
+            double RB = drg ? std::min(RA, m_weight[e]) : RA * m_weight[e];
+            size_t kB = m_edgeTarget[e];
+            if (RB > R[kB]) {
+                R[kB] = RB;
+                queue.emplace(RB, kB);
+            }
+        }
+    }
+}
+
+void RelationGraph::getActiveReactions(const std::vector<bool>& speciesActive,
+                                       std::vector<bool>& reactionActive) const
+{
+    reactionActive.resize(nReactions());
+    for (size_t i = 0; i < nReactions(); i++) {
+        bool active = true;
+        for (size_t j = m_spStart[i]; j < m_spStart[i+1]; j++) {
+            active &= speciesActive[m_spIndex[j]];
+        }
+        reactionActive[i] = active;
+    }
+}
+
+DirectedRelationGraph::DirectedRelationGraph(shared_ptr<Solution> soln,
+                                             const std::string& method)
+    : m_soln(soln)
+    , m_thermo(soln->thermo())
+    , m_kin(soln->kinetics())
+    , m_method(method)
+    , m_nSamples(0)
+{
+    if (method != "DRG" && method != "DRGEP") {
+        throw CanteraError("DirectedRelationGraph::DirectedRelationGraph",
+            "Unknown reduction method '{}'.", method);
+    }
+    if (!m_kin || m_kin->nPhases() != 1) {
+        throw CanteraError("DirectedRelationGraph::DirectedRelationGraph",
+            "Mechanism reduction requires a kinetics manager associated with "
+            "a single phase.");
+    }
+    m_graph.build(*m_kin);
+    m_importance.resize(m_thermo->nSpecies(), 0.0);
+}
+
+void DirectedRelationGraph::setTargets(const std::vector<std::string>& targets)
+{
+    m_targets.clear();
+    for (const auto& name : targets) {
+        m_targets.push_back(m_thermo->speciesIndex(name));
+        if (m_targets.back() == npos) {
+            throw CanteraError("DirectedRelationGraph::setTargets",
+                "Unknown species '{}'.", name);
+        }
+    }
+    clearSamples();
+}
+
+void DirectedRelationGraph::setRetainedSpecies(
+    const std::vector<std::string>& species)
+{
+    m_retained.clear();
+    for (const auto& name : species) {
+        m_retained.push_back(m_thermo->speciesIndex(name));
+        if (m_retained.back() == npos) {
+            throw CanteraError("DirectedRelationGraph::setRetainedSpecies",
+                "Unknown species '{}'.", name);
+        }
+    }
+}
+
+void DirectedRelationGraph::clearSamples()
+{
+    m_nSamples = 0;
+    std::fill(m_importance.begin(), m_importance.end(), 0.0);
+}
+
+void DirectedRelationGraph::addSample()
+{
+    if (m_targets.empty()) {
+        throw CanteraError("DirectedRelationGraph::addSample",
+            "No target species defined.");
+    }
+    update();
+}
+
+void DirectedRelationGraph::addSample(const ThermoPhase& phase)
+{
+    if (&phase == m_thermo.get()) {
+        addSample();
+        return;
+    } else if (phase.nSpecies() != m_thermo->nSpecies()) {
+        throw CanteraError("DirectedRelationGraph::addSample",
+            "Sampled phase has {} species, but the detailed mechanism has {}.",
+            phase.nSpecies(), m_thermo->nSpecies());
+    }
+    vector_fp state;
+    m_thermo->saveState(state);
+    m_thermo->setState_TRY(phase.temperature(), phase.density(),
+                           phase.massFractions());
+    addSample();
+    m_thermo->restoreState(state);
+}
+
+void DirectedRelationGraph::update()
+{
+    m_ropnet.resize(m_kin->nReactions());
+    m_R.resize(m_thermo->nSpecies());
+    m_kin->getNetRatesOfProgress(m_ropnet.data());
+    m_graph.evaluate(m_ropnet.data(), m_targets, m_method == "DRG", m_R.data());
+    for (size_t k = 0; k < m_R.size(); k++) {
+        m_importance[k] = std::max(m_importance[k], m_R[k]);
+    }
+    m_nSamples++;
+}
+
+std::vector<std::string> DirectedRelationGraph::retainedSpecies(
+    double threshold) const
+{
+    std::vector<bool> keep(m_thermo->nSpecies(), false);
+    for (size_t k : m_targets) {
+        keep[k] = true;
+    }
+    for (size_t k : m_retained) {
+        keep[k] = true;
+    }
+    std::vector<std::string> names;
+    for (size_t k = 0; k < keep.size(); k++) {
+        if (keep[k] || m_importance[k] >= threshold) {
+            names.push_back(m_thermo->speciesName(k));
+        }
+    }
+    return names;
+}
+
+shared_ptr<Solution> DirectedRelationGraph::reducedSolution(double threshold) const
+{
+    auto names = retainedSpecies(threshold);
+    std::set<std::string> keep(names.begin(), names.end());
+
+    std::vector<AnyMap> speciesDefs;
+    for (const auto& name : names) {
+        speciesDefs.push_back(m_thermo->species(name)->parameters(m_thermo.get()));
+    }
+
+    std::vector<AnyMap> reactionDefs;
+    std::map<std::string, std::vector<size_t>> duplicates;
+    for (size_t i = 0; i < m_kin->nReactions(); i++) {
+        auto rxn = m_kin->reaction(i);
+        bool retained = true;
+        for (const auto& sp : rxn->reactants) {
+            retained &= (keep.count(sp.first) != 0);
+        }
+        for (const auto& sp : rxn->products) {
+            retained &= (keep.count(sp.first) != 0);
+        }
+        std::string collider = explicitCollider(*rxn);
+        if (!retained || (collider != "" && !keep.count(collider))) {
+            continue;
+        }
+
+        AnyMap rdef = rxn->parameters();
+        // Remove removed species from third-body efficiencies and reaction
+        // orders
+        for (const auto& key : {"efficiencies", "orders"}) {
+            if (!rdef.hasKey(key)) {
+                continue;
+            }
+            AnyMap& coeffs = rdef[key].as<AnyMap>();
+            std::vector<std::string> removed;
+            for (const auto& item : coeffs) {
+                if (!keep.count(item.first)) {
+                    removed.push_back(item.first);
+                }
+            }
+            for (const auto& name : removed) {
+                coeffs.erase(name);
+            }
+            if (coeffs.empty()) {
+                rdef.erase(key);
+            }
+        }
+
+        if (rxn->duplicate) {
+            // Reactions with the same reactants and products, irrespective of
+            // their direction, may form a group of duplicates
+            std::string reactants, products;
+            for (const auto& sp : rxn->reactants) {
+                reactants += fmt::format("{}:{} ", sp.first, sp.second);
+            }
+            for (const auto& sp : rxn->products) {
+                products += fmt::format("{}:{} ", sp.first, sp.second);
+            }
+            if (rxn->reversible && products < reactants) {
+                std::swap(reactants, products);
+            }
+            duplicates[rxn->type() + ": " + reactants + "=> " + products]
+                .push_back(reactionDefs.size());
+        }
+        reactionDefs.push_back(std::move(rdef));
+    }
+    // Duplicates whose counterparts were all removed are no longer duplicates
+    for (const auto& group : duplicates) {
+        if (group.second.size() == 1) {
+            reactionDefs[group.second[0]].erase("duplicate");
+        }
+    }
+
+    AnyMap phaseDef = m_soln->parameters();
+    phaseDef["species"] = names;
+    phaseDef.erase("state"); // may refer to removed species
+    if (phaseDef.hasKey("qss-species")) {
+        std::vector<std::string> qss;
+        for (const auto& name : phaseDef["qss-species"].asVector<std::string>()) {
+            if (keep.count(name)) {
+                qss.push_back(name);
+            }
+        }
+        if (qss.empty()) {
+            phaseDef.erase("qss-species");
+        } else {
+            phaseDef["qss-species"] = qss;
+        }
+    }
+
+    // Serialize the skeletal mechanism to resolve units consistently with
+    // input files written by YamlWriter
+    AnyMap root;
+    root["phases"] = std::vector<AnyMap>{phaseDef};
+    root["species"] = std::move(speciesDefs);
+    root["reactions"] = std::move(reactionDefs);
+    root.setUnits(UnitSystem());
+    AnyMap input = AnyMap::fromYamlString(root.toYamlString());
+    auto reduced = newSolution(input["phases"].asVector<AnyMap>()[0], input);
+    reduced->setName(m_soln->name());
+    reduced->setSource("skeletal mechanism of '" + m_soln->source() + "'");
+    return reduced;
+}
+
+void DirectedRelationGraph::addErrorTarget(
+    std::function<double(shared_ptr<Solution>)> metric, double rtol)
+{
+    m_metrics.push_back(metric);
+    m_rtol.push_back(rtol);
+}
+
+bool DirectedRelationGraph::satisfiesErrorTargets(shared_ptr<Solution> soln)
+{
+    for (size_t i = 0; i < m_metrics.size(); i++) {
+        double value = m_metrics[i](soln);
+        // also fails if the value is NaN
+        if (!(std::abs(value - m_reference[i]) <= m_rtol[i] * std::abs(m_reference[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+double DirectedRelationGraph::findThreshold()
+{
+    if (m_metrics.empty()) {
+        throw CanteraError("DirectedRelationGraph::findThreshold",
+            "No error targets defined.");
+    } else if (!m_nSamples) {
+        throw CanteraError("DirectedRelationGraph::findThreshold",
+            "No states sampled.");
+    }
+    vector_fp state;
+    m_thermo->saveState(state);
+    m_reference.resize(m_metrics.size());
+    for (size_t i = 0; i < m_metrics.size(); i++) {
+        m_reference[i] = m_metrics[i](m_soln);
+    }
+    m_thermo->restoreState(state);
+
+    // The smallest candidate retains all species, which reproduces the
+    // detailed mechanism
+    vector_fp candidates = m_importance;
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()),
+                     candidates.end());
+    size_t lo = 0;
+    size_t hi = candidates.size();
+    while (hi - lo > 1) {
+        size_t mid = (lo + hi) / 2;
+        bool valid;
+        try {
+            valid = satisfiesErrorTargets(reducedSolution(candidates[mid]));
+        } catch (CanteraError&) {
+            valid = false;
+        }
+        if (valid) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return candidates[lo];
+}
+
+}
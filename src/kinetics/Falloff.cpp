@@ -16,6 +16,40 @@
 namespace Cantera
 {
 
+namespace {
+
+//! Partial derivatives of ln(F) for the Troe form of the falloff function,
+//! where log10(F) = log10(Fcent) / (1 + f1^2)
+void troeDerivatives(double logFcent, double dFcent_dT, double Fcent, double pr,
+                     double& dlnF_dT, double& dlnF_dlnPr)
+{
+    double lpr = log10(std::max(pr, SmallNumber));
+    double cc = -0.4 - 0.67 * logFcent;
+    double nn = 0.75 - 1.27 * logFcent;
+    double u = lpr + cc;
+    double den = nn - 0.14 * u;
+    double f1 = u / den;
+    double g = 1.0 / (1.0 + f1 * f1);
+
+    // derivatives of f1 with respect to log10(Pr) and log10(Fcent)
+    double df1_dlpr = nn / (den * den);
+    double df1_dlfc = (-0.67 * den + 1.1762 * u) / (den * den);
+
+    // derivatives of log10(F) with respect to log10(Fcent) and log10(Pr)
+    double dlgf_dlfc = g - 2.0 * logFcent * f1 * g * g * df1_dlfc;
+    double dlgf_dlpr = -2.0 * logFcent * f1 * g * g * df1_dlpr;
+
+    if (Fcent > SmallNumber) {
+        // d log10(Fcent) / dT = dFcent/dT / (Fcent ln(10))
+        dlnF_dT = dlgf_dlfc * dFcent_dT / Fcent;
+    } else {
+        dlnF_dT = 0.0;
+    }
+    dlnF_dlnPr = (pr > SmallNumber) ? dlgf_dlpr : 0.0;
+}
+
+}
+
 void FalloffRate::init(const vector_fp& c)
 {
     setFalloffCoeffs(c);
@@ -94,6 +128,34 @@ void FalloffRate::setParameters(const AnyMap& node, const UnitStack& rate_units)
     }
 }
 
+double FalloffRate::ddTScaled(double T, double pr, const double* work,
+                              double dlnk_low, double dlnk_high,
+                              bool chemAct) const
+{
+    double dlnF_dT, dlnF_dlnPr;
+    getDerivativesF(T, pr, work, dlnF_dT, dlnF_dlnPr);
+    double dlnPr_dT = dlnk_low - dlnk_high;
+    double dlnF = dlnF_dT + dlnF_dlnPr * dlnPr_dT;
+    if (chemAct) {
+        // k = k_0 F / (1 + Pr)
+        return dlnk_low - dlnPr_dT * pr / (1.0 + pr) + dlnF;
+    }
+    // k = k_inf F Pr / (1 + Pr)
+    return dlnk_high + dlnPr_dT / (1.0 + pr) + dlnF;
+}
+
+double FalloffRate::ddTFromStruct(const FalloffData& shared_data) const
+{
+    double recipT = shared_data.recipT;
+    double dlnk_low = (m_lowRate.temperatureExponent()
+                       + m_lowRate.activationEnergy_R() * recipT) * recipT;
+    double dlnk_high = (m_highRate.temperatureExponent()
+                        + m_highRate.activationEnergy_R() * recipT) * recipT;
+    double pr = m_thirdBodyConcentration * m_rc_low / (m_rc_high + SmallNumber);
+    return evalFromStruct(shared_data) * ddTScaled(shared_data.temperature, pr,
+        m_work.data(), dlnk_low, dlnk_high, m_chemicallyActivated);
+}
+
 void FalloffRate::getParameters(AnyMap& node) const
 {
     if (m_chemicallyActivated) {
@@ -198,6 +260,21 @@ double TroeRate::F(double pr, const double* work) const
     return pow(10.0, lgf);
 }
 
+void TroeRate::getDerivativesF(double T, double pr, const double* work,
+                               double& dlnF_dT, double& dlnF_dlnPr) const
+{
+    double e3 = exp(-T*m_rt3);
+    double e1 = exp(-T*m_rt1);
+    double Fcent = (1.0 - m_a) * e3 + m_a * e1;
+    double dFcent_dT = -(1.0 - m_a) * m_rt3 * e3 - m_a * m_rt1 * e1;
+    if (m_t2) {
+        double e2 = exp(- m_t2 / T);
+        Fcent += e2;
+        dFcent_dT += m_t2 / (T * T) * e2;
+    }
+    troeDerivatives(*work, dFcent_dT, Fcent, pr, dlnF_dT, dlnF_dlnPr);
+}
+
 void TroeRate::setParameters(const AnyMap& node, const UnitStack& rate_units)
 {
     if (node.empty()) {
@@ -311,6 +388,25 @@ double SriRate::F(double pr, const double* work) const
     return pow(*work, xx) * work[1];
 }
 
+void SriRate::getDerivativesF(double T, double pr, const double* work,
+                              double& dlnF_dT, double& dlnF_dlnPr) const
+{
+    double lpr = log10(std::max(pr,SmallNumber));
+    double xx = 1.0/(1.0 + lpr*lpr);
+
+    // derivative of a exp(-b/T) + exp(-T/c)
+    double dwork_dT = m_a * m_b / (T * T) * exp(- m_b / T);
+    if (m_c != 0.0) {
+        dwork_dT -= exp(- T/m_c) / m_c;
+    }
+    dlnF_dT = xx * dwork_dT / (*work) + m_e / T;
+    if (pr > SmallNumber) {
+        dlnF_dlnPr = -2.0 * lpr * xx * xx * log(*work) / log(10.0);
+    } else {
+        dlnF_dlnPr = 0.0;
+    }
+}
+
 void SriRate::setParameters(const AnyMap& node, const UnitStack& rate_units)
 {
     if (node.empty()) {
@@ -419,6 +515,12 @@ double TsangRate::F(double pr, const double* work) const
     return pow(10.0, lgf);
 }
 
+void TsangRate::getDerivativesF(double T, double pr, const double* work,
+                                double& dlnF_dT, double& dlnF_dlnPr) const
+{
+    troeDerivatives(*work, m_b, m_a + (m_b * T), pr, dlnF_dT, dlnF_dlnPr);
+}
+
 void TsangRate::setParameters(const AnyMap& node, const UnitStack& rate_units)
 {
     if (node.empty()) {
@@ -0,0 +1,189 @@
+/**
+ *  @file FalloffBatch.cpp
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/FalloffBatch.h"
+#include "cantera/kinetics/Falloff.h"
+#include "cantera/numerics/funcs.h"
+
+namespace Cantera
+{
+
+FalloffBatch::FalloffBatch() :
+    m_type(0),
+    m_temperature(NAN)
+{
+}
+
+void FalloffBatch::clear()
+{
+    m_type = 0;
+    m_rxn.clear();
+    m_A_low.clear();
+    m_b_low.clear();
+    m_Ea_R_low.clear();
+    m_A_high.clear();
+    m_b_high.clear();
+    m_Ea_R_high.clear();
+    m_chem_act.clear();
+    m_params.clear();
+    m_temperature = NAN;
+}
+
+void FalloffBatch::addLimits(size_t rxn, const FalloffRate& rate)
+{
+    m_rxn.push_back(rxn);
+    m_A_low.push_back(rate.m_lowRate.preExponentialFactor());
+    m_b_low.push_back(rate.m_lowRate.temperatureExponent());
+    m_Ea_R_low.push_back(rate.m_lowRate.activationEnergy_R());
+    m_A_high.push_back(rate.m_highRate.preExponentialFactor());
+    m_b_high.push_back(rate.m_highRate.temperatureExponent());
+    m_Ea_R_high.push_back(rate.m_highRate.activationEnergy_R());
+    m_chem_act.push_back(rate.m_chemicallyActivated ? 1.0 : 0.0);
+    m_temperature = NAN;
+}
+
+void FalloffBatch::add(size_t rxn, const TroeRate& rate)
+{
+    AssertThrowMsg(m_type != 2, "FalloffBatch::add",
+                   "Cannot mix Troe and SRI falloff functions.");
+    m_type = 1;
+    addLimits(rxn, rate);
+    m_params.resize(4);
+    m_params[0].push_back(rate.m_a);
+    m_params[1].push_back(rate.m_rt3);
+    m_params[2].push_back(rate.m_rt1);
+    m_params[3].push_back(rate.m_t2 ? rate.m_t2 : INFINITY);
+}
+
+void FalloffBatch::add(size_t rxn, const SriRate& rate)
+{
+    AssertThrowMsg(m_type != 1, "FalloffBatch::add",
+                   "Cannot mix Troe and SRI falloff functions.");
+    m_type = 2;
+    addLimits(rxn, rate);
+    m_params.resize(5);
+    m_params[0].push_back(rate.m_a);
+    m_params[1].push_back(rate.m_b);
+    m_params[2].push_back(rate.m_c != 0.0 ? 1.0 / rate.m_c : INFINITY);
+    m_params[3].push_back(rate.m_d);
+    m_params[4].push_back(rate.m_e);
+}
+
+void FalloffBatch::updateTemp(const FalloffData& data)
+{
+    size_t n = m_rxn.size();
+    double T = data.temperature;
+    double logT = data.logT;
+    double recipT = data.recipT;
+    m_k_low.resize(n);
+    m_k_high.resize(n);
+    m_logF.resize(n);
+    m_pr.resize(n);
+    m_work.resize(5 * n);
+
+    // Arguments of all exponentials, where infinite parameters yield
+    // vanishing terms
+    double* w = m_work.data();
+    for (size_t i = 0; i < n; i++) {
+        w[i] = m_b_low[i] * logT - m_Ea_R_low[i] * recipT;
+        w[n + i] = m_b_high[i] * logT - m_Ea_R_high[i] * recipT;
+    }
+    const vector_fp& p1 = m_params[1];
+    const vector_fp& p2 = m_params[2];
+    if (m_type == 1) {
+        const vector_fp& p3 = m_params[3];
+        for (size_t i = 0; i < n; i++) {
+            w[2 * n + i] = -T * p1[i];
+            w[3 * n + i] = -T * p2[i];
+            w[4 * n + i] = -p3[i] * recipT;
+        }
+    } else {
+        const vector_fp& p4 = m_params[4];
+        for (size_t i = 0; i < n; i++) {
+            w[2 * n + i] = -p1[i] * recipT;
+            w[3 * n + i] = -T * p2[i];
+            w[4 * n + i] = p4[i] * logT;
+        }
+    }
+    vectorExp(w, w, 5 * n);
+
+    const vector_fp& p0 = m_params[0];
+    for (size_t i = 0; i < n; i++) {
+        m_k_low[i] = m_A_low[i] * w[i];
+        m_k_high[i] = m_A_high[i] * w[n + i];
+    }
+    if (m_type == 1) {
+        for (size_t i = 0; i < n; i++) {
+            double Fcent = (1.0 - p0[i]) * w[2 * n + i] + p0[i] * w[3 * n + i]
+                + w[4 * n + i];
+            m_logF[i] = std::max(Fcent, SmallNumber);
+        }
+    } else {
+        const vector_fp& p3 = m_params[3];
+        m_dTe.resize(n);
+        for (size_t i = 0; i < n; i++) {
+            m_logF[i] = p0[i] * w[2 * n + i] + w[3 * n + i];
+            m_dTe[i] = p3[i] * w[4 * n + i];
+        }
+    }
+    vectorLog(m_logF.data(), m_logF.data(), n);
+    m_temperature = T;
+}
+
+bool FalloffBatch::getRateConstants(const FalloffData& data, double* kf)
+{
+    if (!data.finalized) {
+        return false;
+    }
+    if (data.temperature != m_temperature) {
+        updateTemp(data);
+    }
+    size_t n = m_rxn.size();
+    double* lpr = m_work.data();
+    for (size_t i = 0; i < n; i++) {
+        m_pr[i] = data.conc_3b[m_rxn[i]] * m_k_low[i] / (m_k_high[i] + SmallNumber);
+        lpr[i] = std::max(m_pr[i], SmallNumber);
+    }
+    vectorLog(lpr, lpr, n);
+
+    // Natural logarithm of the falloff function F
+    const double log10e = 1.0 / std::log(10.0);
+    if (m_type == 1) {
+        for (size_t i = 0; i < n; i++) {
+            double logFcent = m_logF[i] * log10e;
+            double cc = -0.4 - 0.67 * logFcent;
+            double nn = 0.75 - 1.27 * logFcent;
+            double f1 = (lpr[i] * log10e + cc) / (nn - 0.14 * (lpr[i] * log10e + cc));
+            lpr[i] = m_logF[i] / (1.0 + f1 * f1);
+        }
+    } else {
+        for (size_t i = 0; i < n; i++) {
+            double lpr10 = lpr[i] * log10e;
+            lpr[i] = m_logF[i] / (1.0 + lpr10 * lpr10);
+        }
+    }
+    vectorExp(lpr, lpr, n);
+    if (m_type == 2) {
+        for (size_t i = 0; i < n; i++) {
+            lpr[i] *= m_dTe[i];
+        }
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        double F = lpr[i] / (1.0 + m_pr[i]);
+        if (m_chem_act[i]) {
+            // 1 / (1 + Pr) * F
+            kf[m_rxn[i]] = F * m_k_low[i];
+        } else {
+            // Pr / (1 + Pr) * F
+            kf[m_rxn[i]] = m_pr[i] * F * m_k_high[i];
+        }
+    }
+    return true;
+}
+
+}
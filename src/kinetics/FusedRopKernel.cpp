@@ -0,0 +1,323 @@
+/**
+ *  @file FusedRopKernel.cpp
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/FusedRopKernel.h"
+#include "cantera/kinetics/StoichManager.h"
+#include "cantera/base/ctexceptions.h"
+
+namespace Cantera
+{
+
+namespace {
+
+// Layout of the row headers of the generic block: reaction index and number
+// of net terms, followed by a word holding the numbers of forward and reverse
+// terms
+const uint32_t rxnMask = 0xfffff;
+const int netShift = 20;
+const uint32_t maxNetTerms = 0xfff;
+const uint32_t maxOrderTerms = 0xffff;
+const int revShift = 16;
+
+// Layout of the terms of the generic block: species index and signed integer
+// coefficient
+const uint32_t speciesMask = 0xffffff;
+const int codeShift = 24;
+const int8_t unitCode = 1;
+const int8_t valueCode = -128; // coefficient is read from the value array
+
+// Maximum number of reactant or product molecules of specialized blocks
+const int maxMolecules = 3;
+
+uint32_t encodeTerm(size_t k, int8_t code)
+{
+    return static_cast<uint32_t>(k)
+        | (static_cast<uint32_t>(static_cast<uint8_t>(code)) << codeShift);
+}
+
+inline int8_t termCode(uint32_t term)
+{
+    return static_cast<int8_t>(term >> codeShift);
+}
+
+//! Evaluate rows of reactions with `NR` reactant and `NP` product molecules
+template<int NR, int NP>
+void evaluateRows(const uint32_t* p, size_t nRows, const double* conc,
+                  const double* mult, const double* rkc, double* ropf,
+                  double* ropr, double* ropnet, double* wdot)
+{
+    for (size_t j = 0; j < nRows; j++, p += NR + NP + 1) {
+        size_t i = p[0];
+        const uint32_t* reac = p + 1;
+        const uint32_t* prod = p + 1 + NR;
+        double rf = ropf[i] * mult[i];
+        // reciprocal equilibrium constants are zero for irreversible reactions
+        double rr = rf * rkc[i];
+        for (int n = 0; n < NR; n++) {
+            rf *= conc[reac[n]];
+        }
+        for (int n = 0; n < NP; n++) {
+            rr *= conc[prod[n]];
+        }
+        double net = rf - rr;
+        ropf[i] = rf;
+        ropr[i] = rr;
+        ropnet[i] = net;
+        for (int n = 0; n < NR; n++) {
+            wdot[reac[n]] -= net;
+        }
+        for (int n = 0; n < NP; n++) {
+            wdot[prod[n]] += net;
+        }
+    }
+}
+
+typedef void (*RowKernel)(const uint32_t*, size_t, const double*, const double*,
+                          const double*, double*, double*, double*, double*);
+
+//! Specialized row kernels, indexed by the numbers of reactant and product
+//! molecules
+const RowKernel rowKernels[maxMolecules + 1][maxMolecules + 1] = {
+    {evaluateRows<0, 0>, evaluateRows<0, 1>,
+     evaluateRows<0, 2>, evaluateRows<0, 3>},
+    {evaluateRows<1, 0>, evaluateRows<1, 1>,
+     evaluateRows<1, 2>, evaluateRows<1, 3>},
+    {evaluateRows<2, 0>, evaluateRows<2, 1>,
+     evaluateRows<2, 2>, evaluateRows<2, 3>},
+    {evaluateRows<3, 0>, evaluateRows<3, 1>,
+     evaluateRows<3, 2>, evaluateRows<3, 3>}
+};
+
+//! Multiply `rate` by the concentration factors of `n` terms starting at `p`
+inline const uint32_t* multiplyTerms(const uint32_t* p, uint32_t n,
+                                     const double* conc, const double*& values,
+                                     double& rate)
+{
+    for (uint32_t m = 0; m < n; m++, p++) {
+        double c = conc[*p & speciesMask];
+        if (termCode(*p) == unitCode) {
+            rate *= c;
+        } else {
+            double order = *values++;
+            rate = (c > 0.0) ? rate * std::pow(c, order) : 0.0;
+        }
+    }
+    return p;
+}
+
+//! Evaluate rows of the generic block
+void evaluateGenericRows(const uint32_t* p, size_t nRows, const double* values,
+                         const double* conc, const double* mult,
+                         const double* rkc, double* ropf, double* ropr,
+                         double* ropnet, double* wdot)
+{
+    for (size_t j = 0; j < nRows; j++) {
+        uint32_t head = *p++;
+        size_t i = head & rxnMask;
+        uint32_t nn = head >> netShift;
+        uint32_t nf = *p & maxOrderTerms;
+        uint32_t nr = *p++ >> revShift;
+        double rf = ropf[i] * mult[i];
+        double rr = rf * rkc[i];
+        p = multiplyTerms(p, nf, conc, values, rf);
+        p = multiplyTerms(p, nr, conc, values, rr);
+        double net = rf - rr;
+        ropf[i] = rf;
+        ropr[i] = rr;
+        ropnet[i] = net;
+        for (uint32_t n = 0; n < nn; n++, p++) {
+            int8_t code = termCode(*p);
+            double coeff = (code == valueCode) ? *values++ : code;
+            wdot[*p & speciesMask] += coeff * net;
+        }
+    }
+}
+
+//! Append the species of the molecules in column `i` of the stoichiometric
+//! coefficient matrix `stoich` to `molecules`. Returns `false` if any
+//! coefficient is not a positive integer.
+bool addMolecules(const Eigen::SparseMatrix<double>& stoich, size_t i,
+                  std::vector<uint32_t>& molecules)
+{
+    for (Eigen::SparseMatrix<double>::InnerIterator it(stoich, i); it; ++it) {
+        double coeff = it.value();
+        if (coeff <= 0.0 || coeff != std::round(coeff)) {
+            return false;
+        }
+        molecules.insert(molecules.end(), static_cast<size_t>(coeff),
+                         static_cast<uint32_t>(it.row()));
+    }
+    return true;
+}
+
+}
+
+void FusedRopKernel::build(size_t nSpecies, size_t nReactions,
+                           const StoichManagerN& reactants,
+                           const StoichManagerN& revProducts,
+                           const StoichManagerN& products)
+{
+    const Eigen::SparseMatrix<double>& rstoich = reactants.stoichCoeffs();
+    const Eigen::SparseMatrix<double>& pstoich = products.stoichCoeffs();
+    if (static_cast<size_t>(rstoich.cols()) != nReactions
+        || static_cast<size_t>(pstoich.cols()) != nReactions) {
+        throw CanteraError("FusedRopKernel::build", "Stoichiometric "
+            "coefficients are not available for all {} reactions.", nReactions);
+    }
+    if (nSpecies > speciesMask || nReactions > rxnMask) {
+        throw CanteraError("FusedRopKernel::build", "Mechanisms with more than "
+            "{} species or {} reactions are not supported.",
+            speciesMask, rxnMask);
+    }
+
+    // Group reaction orders by reaction, and find reactions where reaction
+    // orders differ from the reactant stoichiometric coefficients
+    std::vector<std::vector<std::pair<size_t, double>>> fwd(nReactions);
+    std::vector<std::vector<std::pair<size_t, double>>> rev(nReactions);
+    std::vector<bool> massAction(nReactions, true);
+    for (const auto& t : reactants.orders()) {
+        fwd[t.row()].emplace_back(t.col(), t.value());
+        if (t.value() != rstoich.coeff(t.col(), t.row())) {
+            massAction[t.row()] = false;
+        }
+    }
+    for (const auto& t : revProducts.orders()) {
+        rev[t.row()].emplace_back(t.col(), t.value());
+    }
+    Eigen::SparseMatrix<double> nu = pstoich - rstoich;
+
+    // Rows of the specialized blocks, indexed by the numbers of reactant and
+    // product molecules, and of the generic block
+    const size_t nShapes = (maxMolecules + 1) * (maxMolecules + 1);
+    std::vector<std::vector<uint32_t>> rows(nShapes + 1);
+    std::vector<size_t> nRows(nShapes + 1, 0);
+    std::vector<uint32_t> reac, prod;
+
+    // Append the terms of a concentration product to the generic block and
+    // return their number. Positive integer orders are expanded to repeated
+    // terms of unit order.
+    std::vector<uint32_t>& generic = rows[nShapes];
+    auto addOrders = [&](const std::vector<std::pair<size_t, double>>& orders) {
+        size_t n = generic.size();
+        for (const auto& item : orders) {
+            double order = item.second;
+            if (order == 0.0) {
+                continue;
+            } else if (order > 0.0 && order == std::round(order)) {
+                generic.insert(generic.end(), static_cast<size_t>(order),
+                               encodeTerm(item.first, unitCode));
+            } else {
+                generic.push_back(encodeTerm(item.first, valueCode));
+                m_values.push_back(order);
+            }
+        }
+        return generic.size() - n;
+    };
+
+    m_values.clear();
+    for (size_t i = 0; i < nReactions; i++) {
+        reac.clear();
+        prod.clear();
+        if (massAction[i] && addMolecules(rstoich, i, reac)
+            && addMolecules(pstoich, i, prod)
+            && reac.size() <= maxMolecules && prod.size() <= maxMolecules) {
+            size_t n = reac.size() * (maxMolecules + 1) + prod.size();
+            rows[n].push_back(static_cast<uint32_t>(i));
+            rows[n].insert(rows[n].end(), reac.begin(), reac.end());
+            rows[n].insert(rows[n].end(), prod.begin(), prod.end());
+            nRows[n]++;
+            continue;
+        }
+
+        size_t head = generic.size();
+        generic.resize(head + 2);
+        size_t nf = addOrders(fwd[i]);
+        size_t nr = addOrders(rev[i]);
+        size_t nn = 0;
+        for (Eigen::SparseMatrix<double>::InnerIterator it(nu, i); it; ++it) {
+            double coeff = it.value();
+            if (coeff == 0.0) {
+                continue;
+            } else if (coeff == std::round(coeff) && std::abs(coeff) < 128) {
+                generic.push_back(encodeTerm(it.row(),
+                                             static_cast<int8_t>(coeff)));
+            } else {
+                generic.push_back(encodeTerm(it.row(), valueCode));
+                m_values.push_back(coeff);
+            }
+            nn++;
+        }
+        if (nf > maxOrderTerms || nr > maxOrderTerms || nn > maxNetTerms) {
+            throw CanteraError("FusedRopKernel::build", "Reaction {} has too "
+                "many terms to be represented.", i);
+        }
+        generic[head] = static_cast<uint32_t>(i | (nn << netShift));
+        generic[head + 1] = static_cast<uint32_t>(nf | (nr << revShift));
+        nRows[nShapes]++;
+    }
+
+    // Concatenate the blocks, where the generic block is last
+    m_blocks.clear();
+    m_data.clear();
+    for (size_t n = 0; n <= nShapes; n++) {
+        if (nRows[n] == 0) {
+            continue;
+        }
+        Block block;
+        block.nReactants = -1;
+        block.nProducts = -1;
+        if (n != nShapes) {
+            block.nReactants = static_cast<int>(n / (maxMolecules + 1));
+            block.nProducts = static_cast<int>(n % (maxMolecules + 1));
+        }
+        block.nRows = nRows[n];
+        block.start = m_data.size();
+        m_blocks.push_back(block);
+        m_data.insert(m_data.end(), rows[n].begin(), rows[n].end());
+    }
+    m_nSpecies = nSpecies;
+    m_nReactions = nReactions;
+
+    // The multi-pass evaluation reads the reactant data twice (concentration
+    // products and consumption of reactants)
+    m_multiPassSize = 2 * reactants.dataSize() + revProducts.dataSize()
+        + products.dataSize();
+}
+
+void FusedRopKernel::clear()
+{
+    m_nSpecies = 0;
+    m_nReactions = 0;
+    m_blocks.clear();
+    m_data.clear();
+    m_values.clear();
+    m_multiPassSize = 0;
+}
+
+void FusedRopKernel::evaluate(const double* conc, const double* mult,
+                              const double* rkc, double* ropf, double* ropr,
+                              double* ropnet, double* wdot) const
+{
+    std::fill(wdot, wdot + m_nSpecies, 0.0);
+    for (const auto& block : m_blocks) {
+        const uint32_t* p = m_data.data() + block.start;
+        if (block.nReactants < 0) {
+            evaluateGenericRows(p, block.nRows, m_values.data(), conc, mult,
+                                rkc, ropf, ropr, ropnet, wdot);
+        } else {
+            rowKernels[block.nReactants][block.nProducts](
+                p, block.nRows, conc, mult, rkc, ropf, ropr, ropnet, wdot);
+        }
+    }
+}
+
+size_t FusedRopKernel::dataSize() const
+{
+    return m_data.size() * sizeof(uint32_t) + m_values.size() * sizeof(double);
+}
+
+}
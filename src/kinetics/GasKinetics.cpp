@@ -15,8 +15,66 @@ namespace Cantera
 GasKinetics::GasKinetics(ThermoPhase* thermo) :
     BulkKinetics(thermo),
     m_logStandConc(0.0),
-    m_pres(0.0)
+    m_pres(0.0),
+    m_jac_skip_third_bodies(false),
+    m_jac_skip_pressure(false),
+    m_jac_rtol_delta(1e-8),
+    m_tab_Tmin(0.0),
+    m_tab_Tmax(0.0),
+    m_tab_rtol(1e-6),
+    m_tab_maxPoints(100000),
+    m_tab_kc(false),
+    m_tab_active(false),
+    m_dac_enabled(false),
+    m_dac_threshold(1e-4),
+    m_dac_rtol(0.01),
+    m_dac_hysteresis(0.5),
+    m_dac_maxInterval(64),
+    m_dac_interval(1),
+    m_dac_count(0),
+    m_dac_nRefresh(0),
+    m_dac_T(0.0),
+    m_dac_P(0.0),
+    m_mask_ok(false),
+    m_mask_enabled(false),
+    m_fused_enabled(false),
+    m_fused_wdot_ok(false),
+    m_qss_rtol(1e-10),
+    m_qss_atol(1e-20),
+    m_qss_maxIter(100)
 {
+    m_sec_rop = m_instrumentation.section("updateROP");
+    m_sec_rates_T = m_instrumentation.section("update_rates_T");
+    m_sec_rates_C = m_instrumentation.section("update_rates_C");
+    m_sec_Kc = m_instrumentation.section("updateKc");
+    m_sec_table = m_instrumentation.section("rate table");
+    m_sec_legacy = m_instrumentation.section("rates: legacy");
+    m_sec_thirdbody = m_instrumentation.section("third-body concentrations");
+    m_sec_falloff = m_instrumentation.section("falloff");
+    m_sec_qss = m_instrumentation.section("QSS");
+    m_sec_stoich = m_instrumentation.section("concentration products");
+}
+
+void GasKinetics::resizeReactions()
+{
+    BulkKinetics::resizeReactions();
+    m_rbuf0.resize(nReactions());
+    m_rbuf1.resize(nReactions());
+    m_rbuf2.resize(nReactions());
+    m_fused.clear();
+}
+
+AnyMap GasKinetics::parameters()
+{
+    AnyMap out = BulkKinetics::parameters();
+    if (!m_qss.empty()) {
+        std::vector<std::string> names;
+        for (size_t k : m_qss) {
+            names.push_back(kineticsSpeciesName(k));
+        }
+        out["qss-species"] = names;
+    }
+    return out;
 }
 
 void GasKinetics::getThirdBodyConcentrations(double* concm) const
@@ -28,39 +86,80 @@ void GasKinetics::getThirdBodyConcentrations(double* concm) const
 
 void GasKinetics::update_rates_T()
 {
+    KineticsInstrumentation::Timer timer(m_instrumentation, m_sec_rates_T);
     double T = thermo().temperature();
     double P = thermo().pressure();
     m_logStandConc = log(thermo().standardConcentration());
     double logT = log(T);
 
-    if (T != m_temp) {
-        // Update forward rate constant for each reaction
-        if (!m_rfn.empty()) {
-            m_rates.update(T, logT, m_rfn.data());
+    if (T == m_temp) {
+        m_instrumentation.hit(m_sec_rates_T);
+    } else {
+        if (m_tab_Tmax > 0.0 && !m_rate_table.ready()) {
+            buildRateTable();
+        }
+        m_tab_active = m_rate_table.inRange(T);
+        if (m_tab_active) {
+            KineticsInstrumentation::Timer tableTimer(m_instrumentation,
+                                                      m_sec_table);
+            // Interpolate tabulated forward rate constants and equilibrium
+            // constants
+            m_rate_table.interpolate(T, m_tab_values.data());
+            size_t nkf = m_tab_kf.size();
+            for (size_t n = 0; n < nkf; n++) {
+                m_rfn[m_tab_kf[n]] = m_tab_sign[n] * m_tab_values[n];
+            }
+            if (m_tab_kc) {
+                for (size_t i = 0; i < m_revindex.size(); i++) {
+                    m_rkcn[m_revindex[i]] = std::min(m_tab_values[nkf + i],
+                                                     BigNumber);
+                }
+                for (size_t i = 0; i != m_irrev.size(); ++i) {
+                    m_rkcn[ m_irrev[i] ] = 0.0;
+                }
+            } else {
+                updateKc();
+            }
+        } else {
+            // Update forward rate constant for each reaction
+            if (!m_rfn.empty()) {
+                KineticsInstrumentation::Timer legacyTimer(m_instrumentation,
+                                                           m_sec_legacy);
+                m_rates.update(T, logT, m_rfn.data());
+            }
+            updateKc();
         }
 
         // Falloff reactions (legacy)
         if (!m_rfn_low.empty()) {
+            KineticsInstrumentation::Timer legacyTimer(m_instrumentation,
+                                                       m_sec_legacy);
             m_falloff_low_rates.update(T, logT, m_rfn_low.data());
             m_falloff_high_rates.update(T, logT, m_rfn_high.data());
         }
         if (!falloff_work.empty()) {
             m_falloffn.updateTemp(T, falloff_work.data());
         }
-
-        updateKc();
         m_ROP_ok = false;
     }
 
     // loop over MultiBulkRate evaluators for each reaction type
-    for (auto& rates : m_bulk_rates) {
+    for (size_t j = 0; j < m_bulk_rates.size(); j++) {
+        auto& rates = m_bulk_rates[j];
+        KineticsInstrumentation::Timer ratesTimer(m_instrumentation,
+                                                  m_bulk_sections[j]);
         bool changed = rates->update(thermo(), *this);
-        if (changed) {
+        if (changed && !(m_tab_active && rates->type() == "Arrhenius")) {
             rates->getRateConstants(m_rfn.data());
             m_ROP_ok = false;
+        } else if (!changed) {
+            m_instrumentation.hit(m_bulk_sections[j]);
         }
     }
-    if (T != m_temp || P != m_pres) {
+    if ((T != m_temp || P != m_pres)
+        && (m_plog_rates.nReactions() || m_cheb_rates.nReactions())) {
+        KineticsInstrumentation::Timer legacyTimer(m_instrumentation,
+                                                   m_sec_legacy);
         // P-log reactions (legacy)
         if (m_plog_rates.nReactions()) {
             m_plog_rates.update(T, logT, m_rfn.data());
@@ -79,22 +178,30 @@ void GasKinetics::update_rates_T()
 
 void GasKinetics::update_rates_C()
 {
+    KineticsInstrumentation::Timer timer(m_instrumentation, m_sec_rates_C);
+    if (!m_mask_ok) {
+        updateReactionMask();
+    }
     thermo().getActivityConcentrations(m_act_conc.data());
     thermo().getConcentrations(m_phys_conc.data());
     doublereal ctot = thermo().molarDensity();
 
+    // Effective third-body concentrations of all reactions, evaluated as a
+    // single sparse matrix-vector product
+    m_efficiencies.evaluate(m_phys_conc.data(), ctot, m_concm_rows.data());
+
     // Third-body objects interacting with MultiRate evaluator
-    m_multi_concm.update(m_phys_conc, ctot, m_concm.data());
+    m_multi_concm.update(m_concm_rows, m_concm.data());
 
     // 3-body reactions (legacy)
     if (!concm_3b_values.empty()) {
-        m_3b_concm.update(m_phys_conc, ctot, concm_3b_values.data());
+        m_3b_concm.update(m_concm_rows, concm_3b_values.data());
         m_3b_concm.copy(concm_3b_values, m_concm.data());
     }
 
     // Falloff reactions (legacy)
     if (!concm_falloff_values.empty()) {
-        m_falloff_concm.update(m_phys_conc, ctot, concm_falloff_values.data());
+        m_falloff_concm.update(m_concm_rows, concm_falloff_values.data());
         m_falloff_concm.copy(concm_falloff_values, m_concm.data());
     }
 
@@ -114,6 +221,21 @@ void GasKinetics::update_rates_C()
 }
 
 void GasKinetics::updateKc()
+{
+    KineticsInstrumentation::Timer timer(m_instrumentation, m_sec_Kc);
+    const auto& revindex = m_mask_enabled ? m_mask_revindex : m_revindex;
+    updateLogKc(revindex);
+    for (size_t i = 0; i < revindex.size(); i++) {
+        size_t irxn = revindex[i];
+        m_rkcn[irxn] = std::min(exp(m_rkcn[irxn]), BigNumber);
+    }
+
+    for (size_t i = 0; i != m_irrev.size(); ++i) {
+        m_rkcn[ m_irrev[i] ] = 0.0;
+    }
+}
+
+void GasKinetics::updateLogKc(const std::vector<size_t>& revindex)
 {
     thermo().getStandardChemPotentials(m_grt.data());
     fill(m_rkcn.begin(), m_rkcn.end(), 0.0);
@@ -122,14 +244,553 @@ void GasKinetics::updateKc()
     getRevReactionDelta(m_grt.data(), m_rkcn.data());
 
     doublereal rrt = 1.0 / thermo().RT();
-    for (size_t i = 0; i < m_revindex.size(); i++) {
-        size_t irxn = m_revindex[i];
-        m_rkcn[irxn] = std::min(exp(m_rkcn[irxn]*rrt - m_dn[irxn]*m_logStandConc),
-                                BigNumber);
+    for (size_t i = 0; i < revindex.size(); i++) {
+        size_t irxn = revindex[i];
+        m_rkcn[irxn] = m_rkcn[irxn]*rrt - m_dn[irxn]*m_logStandConc;
     }
+}
 
-    for (size_t i = 0; i != m_irrev.size(); ++i) {
-        m_rkcn[ m_irrev[i] ] = 0.0;
+void GasKinetics::setRateTabulation(double Tmin, double Tmax, double rtol,
+                                    size_t maxPoints)
+{
+    if (Tmin <= 0 || Tmax <= Tmin) {
+        throw CanteraError("GasKinetics::setRateTabulation",
+            "Invalid temperature range [{}, {}].", Tmin, Tmax);
+    }
+    m_tab_Tmin = Tmin;
+    m_tab_Tmax = Tmax;
+    m_tab_rtol = rtol;
+    m_tab_maxPoints = maxPoints;
+    m_rate_table.clear();
+    invalidateCache();
+}
+
+void GasKinetics::disableRateTabulation()
+{
+    m_tab_Tmin = 0.0;
+    m_tab_Tmax = 0.0;
+    m_rate_table.clear();
+    invalidateCache();
+}
+
+void GasKinetics::buildRateTable()
+{
+    // Reactions with Arrhenius rates, including legacy reactions
+    m_tab_kf = m_rates.reactionIndices();
+    MultiRateBase* arrhenius = nullptr;
+    if (m_bulk_types.find("Arrhenius") != m_bulk_types.end()) {
+        arrhenius = m_bulk_rates[m_bulk_types["Arrhenius"]].get();
+        for (size_t i = 0; i < nReactions(); i++) {
+            auto rate = m_reactions[i]->rate();
+            if (!m_reactions[i]->usesLegacy() && rate
+                && rate->type() == "Arrhenius") {
+                m_tab_kf.push_back(i);
+            }
+        }
+    }
+    size_t nkf = m_tab_kf.size();
+
+    // Logarithms of the magnitudes of the rate constants are tabulated, and
+    // their signs (which do not depend on temperature) are stored separately
+    m_tab_sign.assign(nkf, 0.0);
+
+    // For ideal gases, equilibrium constants in concentration units only
+    // depend on temperature
+    m_tab_kc = (thermo().type() == "IdealGas");
+    size_t nValues = nkf + (m_tab_kc ? m_revindex.size() : 0);
+    m_tab_values.resize(nValues);
+
+    vector_fp state;
+    thermo().saveState(state);
+    double logStandConc = m_logStandConc;
+    bool masked = m_mask_enabled;
+    m_mask_enabled = false;
+    if (arrhenius && masked) {
+        arrhenius->setActiveReactions({});
+    }
+    vector_fp kf(nReactions(), 0.0);
+    auto eval = [&](double T, double* values) {
+        m_rates.update(T, std::log(T), kf.data());
+        if (arrhenius) {
+            arrhenius->update(T);
+            arrhenius->getRateConstants(kf.data());
+        }
+        for (size_t n = 0; n < nkf; n++) {
+            double k = kf[m_tab_kf[n]];
+            if (k != 0.0) {
+                m_tab_sign[n] = (k > 0.0) ? 1.0 : -1.0;
+            }
+            values[n] = std::log(std::max(std::abs(k), SmallNumber));
+        }
+        if (m_tab_kc) {
+            // Equilibrium constants are tabulated without limiting their
+            // magnitude, which is applied after interpolation
+            thermo().setTemperature(T);
+            m_logStandConc = std::log(thermo().standardConcentration());
+            updateLogKc(m_revindex);
+            for (size_t i = 0; i < m_revindex.size(); i++) {
+                values[nkf + i] = m_rkcn[m_revindex[i]];
+            }
+        }
+    };
+    try {
+        m_rate_table.build(m_tab_Tmin, m_tab_Tmax, nValues, eval, m_tab_rtol,
+                           m_tab_maxPoints);
+    } catch (CanteraError&) {
+        thermo().restoreState(state);
+        m_logStandConc = logStandConc;
+        m_mask_enabled = masked;
+        if (arrhenius && masked) {
+            arrhenius->setActiveReactions(m_mask_rxn);
+        }
+        throw;
+    }
+    thermo().restoreState(state);
+    m_logStandConc = logStandConc;
+    m_mask_enabled = masked;
+    if (arrhenius && masked) {
+        arrhenius->setActiveReactions(m_mask_rxn);
+    }
+}
+
+void GasKinetics::setMultiplier(size_t i, double f)
+{
+    if ((f == 0.0) != (m_perturb[i] == 0.0)) {
+        m_mask_ok = false;
+    }
+    BulkKinetics::setMultiplier(i, f);
+}
+
+void GasKinetics::updateReactionMask()
+{
+    bool wasEnabled = m_mask_enabled;
+    m_mask_rxn.resize(nReactions());
+    m_mask_active.clear();
+    m_mask_inactive.clear();
+    for (size_t i = 0; i < nReactions(); i++) {
+        m_mask_rxn[i] = (m_perturb[i] != 0.0);
+        if (m_mask_rxn[i]) {
+            m_mask_active.push_back(i);
+        } else {
+            m_mask_inactive.push_back(i);
+        }
+    }
+    m_mask_enabled = !m_mask_inactive.empty();
+    m_mask_ok = true;
+    if (!m_mask_enabled && !wasEnabled) {
+        return;
+    }
+
+    m_mask_revindex.clear();
+    for (size_t i : m_revindex) {
+        if (m_mask_rxn[i]) {
+            m_mask_revindex.push_back(i);
+        }
+    }
+    m_reactantStoich.copyActive(m_mask_rxn, m_mask_reactantStoich);
+    m_revProductStoich.copyActive(m_mask_rxn, m_mask_revProductStoich);
+
+    // skipped reactions are not evaluated by the rate evaluators, and rate
+    // constants of reactions that were skipped before need to be updated
+    std::vector<bool> empty;
+    const auto& active = m_mask_enabled ? m_mask_rxn : empty;
+    for (auto& rates : m_bulk_rates) {
+        rates->setActiveReactions(active);
+    }
+    m_multi_concm.setActiveReactions(active);
+    m_dac_species.clear();
+    invalidateCache();
+}
+
+void GasKinetics::enableAdaptiveChemistry(const std::vector<std::string>& targets,
+    double threshold, double rtol, size_t maxInterval, double hysteresis)
+{
+    if (targets.empty()) {
+        throw CanteraError("GasKinetics::enableAdaptiveChemistry",
+            "No target species given.");
+    } else if (threshold <= 0 || threshold >= 1) {
+        throw CanteraError("GasKinetics::enableAdaptiveChemistry",
+            "Threshold needs to be between 0 and 1; got {}.", threshold);
+    } else if (hysteresis <= 0 || hysteresis > 1) {
+        throw CanteraError("GasKinetics::enableAdaptiveChemistry",
+            "Hysteresis factor needs to be in (0, 1]; got {}.", hysteresis);
+    } else if (maxInterval < 1) {
+        throw CanteraError("GasKinetics::enableAdaptiveChemistry",
+            "Maximum refresh interval needs to be at least one.");
+    }
+    m_dac_targets.clear();
+    for (const auto& name : targets) {
+        size_t k = kineticsSpeciesIndex(name);
+        if (k == npos) {
+            throw CanteraError("GasKinetics::enableAdaptiveChemistry",
+                "Unknown species '{}'.", name);
+        }
+        m_dac_targets.push_back(k);
+    }
+    m_dac_threshold = threshold;
+    m_dac_rtol = rtol;
+    m_dac_maxInterval = maxInterval;
+    m_dac_hysteresis = hysteresis;
+    m_dac_enabled = true;
+    m_dac_species.clear();
+    m_dac_rxn.clear();
+    m_dac_nRefresh = 0;
+    invalidateCache();
+}
+
+void GasKinetics::disableAdaptiveChemistry()
+{
+    m_dac_enabled = false;
+    m_dac_species.clear();
+    m_dac_rxn.clear();
+    invalidateCache();
+}
+
+bool GasKinetics::adaptiveRefreshDue()
+{
+    if (m_dac_species.empty() || m_dac_count >= m_dac_interval) {
+        return true;
+    }
+    double T = thermo().temperature();
+    double P = thermo().pressure();
+    if (std::abs(T - m_dac_T) > m_dac_rtol * m_dac_T
+        || std::abs(P - m_dac_P) > m_dac_rtol * m_dac_P) {
+        return true;
+    }
+    m_dac_work.resize(m_kk);
+    thermo().getMoleFractions(m_dac_work.data());
+    for (size_t k = 0; k < m_kk; k++) {
+        if (std::abs(m_dac_work[k] - m_dac_X[k]) > m_dac_rtol) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void GasKinetics::updateActiveSet()
+{
+    if (m_dac_graph.nReactions() != nReactions()) {
+        m_dac_graph.build(*this);
+    }
+    m_dac_work.resize(m_kk);
+    m_dac_graph.evaluate(m_ropnet.data(), m_dac_targets, false,
+                         m_dac_work.data());
+
+    bool changed = m_dac_species.empty();
+    m_dac_species.resize(m_kk, false);
+    for (size_t k = 0; k < m_kk; k++) {
+        double threshold = m_dac_threshold;
+        if (m_dac_species[k]) {
+            threshold *= m_dac_hysteresis;
+        }
+        bool active = (m_dac_work[k] >= threshold);
+        changed |= (active != m_dac_species[k]);
+        m_dac_species[k] = active;
+    }
+
+    if (changed) {
+        m_dac_graph.getActiveReactions(m_dac_species, m_dac_rxn);
+        m_dac_active.clear();
+        m_dac_inactive.clear();
+        for (size_t i = 0; i < nReactions(); i++) {
+            if (m_mask_enabled && !m_mask_rxn[i]) {
+                m_dac_rxn[i] = false;
+            }
+            if (m_dac_rxn[i]) {
+                m_dac_active.push_back(i);
+            } else {
+                m_dac_inactive.push_back(i);
+            }
+        }
+        m_reactantStoich.copyActive(m_dac_rxn, m_dac_reactantStoich);
+        m_revProductStoich.copyActive(m_dac_rxn, m_dac_revProductStoich);
+        m_dac_interval = 1;
+    } else {
+        m_dac_interval = std::min(2 * m_dac_interval, m_dac_maxInterval);
+    }
+
+    m_dac_T = thermo().temperature();
+    m_dac_P = thermo().pressure();
+    m_dac_X.resize(m_kk);
+    thermo().getMoleFractions(m_dac_X.data());
+    m_dac_count = 0;
+    m_dac_nRefresh++;
+}
+
+void GasKinetics::updateActiveROP(const std::vector<size_t>& active,
+                                  const std::vector<size_t>& inactive,
+                                  StoichManagerN& reactants,
+                                  StoichManagerN& revProducts)
+{
+    for (size_t i : active) {
+        m_ropf[i] *= m_perturb[i];
+        m_ropr[i] = m_ropf[i] * m_rkcn[i];
+    }
+    reactants.multiply(m_act_conc.data(), m_ropf.data());
+    revProducts.multiply(m_act_conc.data(), m_ropr.data());
+    for (size_t i : active) {
+        m_ropnet[i] = m_ropf[i] - m_ropr[i];
+    }
+    for (size_t i : inactive) {
+        m_ropf[i] = 0.0;
+        m_ropr[i] = 0.0;
+        m_ropnet[i] = 0.0;
+    }
+}
+
+void GasKinetics::setQssSpecies(const std::vector<std::string>& names)
+{
+    std::vector<size_t> qss;
+    for (const auto& name : names) {
+        size_t k = kineticsSpeciesIndex(name);
+        if (k == npos) {
+            throw CanteraError("GasKinetics::setQssSpecies",
+                "Unknown species '{}'.", name);
+        }
+        if (std::find(qss.begin(), qss.end(), k) == qss.end()) {
+            qss.push_back(k);
+        }
+    }
+    m_qss = qss;
+    m_qss_groups.clear();
+    invalidateCache();
+}
+
+bool GasKinetics::isQssSpecies(size_t k) const
+{
+    return std::find(m_qss.begin(), m_qss.end(), k) != m_qss.end();
+}
+
+void GasKinetics::buildQssGroups()
+{
+    m_qss_groups.clear();
+    size_t nqss = m_qss.size();
+    std::vector<size_t> pos(m_kk, npos); // position of species in m_qss
+    for (size_t j = 0; j < nqss; j++) {
+        pos[m_qss[j]] = j;
+    }
+
+    // Merge QSS species participating in the same reaction, using a
+    // disjoint-set forest
+    std::vector<size_t> parent(nqss);
+    for (size_t j = 0; j < nqss; j++) {
+        parent[j] = j;
+    }
+    auto root = [&parent](size_t j) {
+        while (parent[j] != j) {
+            j = parent[j] = parent[parent[j]];
+        }
+        return j;
+    };
+    std::vector<bool> consumed(nqss, false);
+    std::vector<std::vector<size_t>> rxnQss(nReactions());
+    for (size_t i = 0; i < nReactions(); i++) {
+        const Reaction& R = *m_reactions[i];
+        for (const auto& comp : {&R.reactants, &R.products, &R.orders}) {
+            for (const auto& sp : *comp) {
+                size_t j = pos[kineticsSpeciesIndex(sp.first)];
+                if (j == npos) {
+                    continue;
+                }
+                if (comp != &R.products || R.reversible) {
+                    consumed[j] = true;
+                }
+                auto& list = rxnQss[i];
+                if (std::find(list.begin(), list.end(), j) == list.end()) {
+                    list.push_back(j);
+                    parent[root(j)] = root(list[0]);
+                }
+            }
+        }
+    }
+    for (size_t j = 0; j < nqss; j++) {
+        if (!consumed[j]) {
+            throw CanteraError("GasKinetics::buildQssGroups",
+                "QSS species '{}' is not consumed by any reaction.",
+                kineticsSpeciesName(m_qss[j]));
+        }
+    }
+
+    // Assign species to groups
+    std::vector<size_t> group(nqss, npos), loc(nqss);
+    for (size_t j = 0; j < nqss; j++) {
+        size_t r = root(j);
+        if (group[r] == npos) {
+            group[r] = m_qss_groups.size();
+            m_qss_groups.emplace_back();
+            m_qss_groups.back().linear = true;
+        }
+        group[j] = group[r];
+        loc[j] = m_qss_groups[group[j]].species.size();
+        m_qss_groups[group[j]].species.push_back(m_qss[j]);
+    }
+
+    // Concentration products and stoichiometric coefficients of reactions
+    for (size_t i = 0; i < nReactions(); i++) {
+        if (rxnQss[i].empty()) {
+            continue;
+        }
+        const Reaction& R = *m_reactions[i];
+        QssGroup& G = m_qss_groups[group[rxnQss[i][0]]];
+        QssReaction qr;
+        qr.rxn = i;
+        auto addTerm = [&](std::vector<QssReaction::Term>& terms,
+                           const std::string& name, double order) {
+            size_t k = kineticsSpeciesIndex(name);
+            size_t j = pos[k];
+            terms.push_back({k, j == npos ? npos : loc[j], order});
+        };
+        for (const auto& sp : R.reactants) {
+            auto order = R.orders.find(sp.first);
+            addTerm(qr.fwd, sp.first,
+                    order == R.orders.end() ? sp.second : order->second);
+        }
+        for (const auto& sp : R.orders) {
+            if (!R.reactants.count(sp.first)) {
+                addTerm(qr.fwd, sp.first, sp.second);
+            }
+        }
+        if (R.reversible) {
+            for (const auto& sp : R.products) {
+                addTerm(qr.rev, sp.first, sp.second);
+            }
+        }
+        for (size_t j : rxnQss[i]) {
+            double nu = 0.0;
+            const std::string& name = kineticsSpeciesName(m_qss[j]);
+            auto prod = R.products.find(name);
+            if (prod != R.products.end()) {
+                nu += prod->second;
+            }
+            auto reac = R.reactants.find(name);
+            if (reac != R.reactants.end()) {
+                nu -= reac->second;
+            }
+            if (nu != 0.0) {
+                qr.nu.emplace_back(loc[j], nu);
+            }
+        }
+        // Reactions that are not of first order in the QSS species make the
+        // system nonlinear
+        for (const auto& terms : {&qr.fwd, &qr.rev}) {
+            double order = 0.0;
+            for (const auto& term : *terms) {
+                if (term.loc != npos) {
+                    order += term.order;
+                    G.linear &= (term.order == 1.0);
+                }
+            }
+            G.linear &= (order <= 1.0);
+        }
+        G.rxn.push_back(std::move(qr));
+    }
+
+    for (auto& G : m_qss_groups) {
+        size_t n = G.species.size();
+        G.jac.resize(n, n, 0.0);
+        G.conc.assign(n, 0.0);
+        G.resid.assign(n, 0.0);
+    }
+}
+
+void GasKinetics::solveQss(bool restricted)
+{
+    if (m_qss_groups.empty()) {
+        buildQssGroups();
+    }
+    double atol = m_qss_atol * thermo().molarDensity();
+    // Initial guess for nonlinear groups, where the Jacobian of reactions that
+    // are of higher order in a QSS species vanishes at zero concentration
+    double guess = 1e-12 * thermo().molarDensity();
+    for (auto& G : m_qss_groups) {
+        size_t n = G.species.size();
+        for (size_t j = 0; j < n; j++) {
+            if (!G.linear && G.conc[j] <= 0.0) {
+                G.conc[j] = guess;
+            }
+            m_act_conc[G.species[j]] = G.conc[j];
+        }
+        bool converged = false;
+        for (size_t iter = 0; iter < m_qss_maxIter && !converged; iter++) {
+            evalQssResidual(G, restricted);
+            for (size_t j = 0; j < n; j++) {
+                G.resid[j] = -G.resid[j];
+            }
+            try {
+                solve(G.jac, G.resid.data());
+            } catch (CanteraError& err) {
+                throw CanteraError("GasKinetics::solveQss", "Singular Jacobian "
+                    "for QSS species including '{}' at the current state:\n{}",
+                    kineticsSpeciesName(G.species[0]), err.getMessage());
+            }
+            // the solution of a linear system is found in a single step
+            converged = G.linear;
+            bool changed = false;
+            for (size_t j = 0; j < n; j++) {
+                double c = G.conc[j] + G.resid[j];
+                if (c < 0.0) {
+                    // keep concentrations of nonlinear groups positive, such
+                    // that the Jacobian remains non-singular
+                    c = G.linear ? 0.0 : 0.5 * G.conc[j];
+                }
+                changed |= (std::abs(c - G.conc[j]) >
+                            m_qss_rtol * std::max(c, G.conc[j]) + atol);
+                G.conc[j] = c;
+                m_act_conc[G.species[j]] = c;
+            }
+            converged |= !changed;
+        }
+        if (!converged) {
+            throw CanteraError("GasKinetics::solveQss",
+                "Concentrations of QSS species did not converge after {} "
+                "iterations.", m_qss_maxIter);
+        }
+    }
+}
+
+void GasKinetics::evalQssResidual(QssGroup& G, bool restricted)
+{
+    G.jac.zero();
+    std::fill(G.resid.begin(), G.resid.end(), 0.0);
+    auto power = [](double c, double order) {
+        return (order == 1.0) ? c : std::pow(c, order);
+    };
+    for (const auto& R : G.rxn) {
+        if (restricted && !m_dac_rxn[R.rxn]) {
+            continue;
+        }
+        double kf = m_ropf[R.rxn] * m_perturb[R.rxn];
+        for (const auto& terms : {&R.fwd, &R.rev}) {
+            if (terms->empty()) {
+                continue;
+            }
+            double k = (terms == &R.fwd) ? kf : -kf * m_rkcn[R.rxn];
+            double rate = k;
+            for (const auto& term : *terms) {
+                rate *= power(m_act_conc[term.k], term.order);
+            }
+            for (const auto& nu : R.nu) {
+                G.resid[nu.first] += nu.second * rate;
+            }
+            // derivatives with respect to the concentrations of the group
+            for (size_t t = 0; t < terms->size(); t++) {
+                const auto& term = (*terms)[t];
+                if (term.loc == npos) {
+                    continue;
+                }
+                double drate = k * term.order *
+                    power(m_act_conc[term.k], term.order - 1.0);
+                for (size_t s = 0; s < terms->size(); s++) {
+                    if (s != t) {
+                        drate *= power(m_act_conc[(*terms)[s].k],
+                                       (*terms)[s].order);
+                    }
+                }
+                for (const auto& nu : R.nu) {
+                    G.jac(nu.first, term.loc) += nu.second * drate;
+                }
+            }
+        }
     }
 }
 
@@ -154,6 +815,7 @@ void GasKinetics::getEquilibriumConstants(doublereal* kc)
 
 void GasKinetics::processFalloffReactions()
 {
+    KineticsInstrumentation::Timer timer(m_instrumentation, m_sec_falloff);
     // use m_ropr for temporary storage of reduced pressure
     vector_fp& pr = m_ropr;
 
@@ -177,43 +839,96 @@ void GasKinetics::processFalloffReactions()
 
 void GasKinetics::updateROP()
 {
+    KineticsInstrumentation::Timer timer(m_instrumentation, m_sec_rop);
     update_rates_C();
     update_rates_T();
     if (m_ROP_ok) {
+        m_instrumentation.hit(m_sec_rop);
         return;
     }
+    m_fused_wdot_ok = false;
+
+    // checked after update_rates_C(), which updates the reaction mask and
+    // discards the active set if multipliers were set to or from zero
+    bool refresh = m_dac_enabled && adaptiveRefreshDue();
 
     // copy rate coefficients into ropf
     m_ropf = m_rfn;
 
-    // reactions involving third body
-    m_multi_concm.multiply(m_ropf.data(), m_concm.data());
+    {
+        KineticsInstrumentation::Timer thirdBodyTimer(m_instrumentation,
+                                                      m_sec_thirdbody);
+        // reactions involving third body
+        m_multi_concm.multiply(m_ropf.data(), m_concm.data());
 
-    // multiply ropf by enhanced 3b conc for all 3b rxns
-    if (!concm_3b_values.empty()) {
-        m_3b_concm.multiply(m_ropf.data(), concm_3b_values.data());
+        // multiply ropf by enhanced 3b conc for all 3b rxns
+        if (!concm_3b_values.empty()) {
+            m_3b_concm.multiply(m_ropf.data(), concm_3b_values.data());
+        }
     }
 
     if (m_falloff_high_rates.nReactions()) {
         processFalloffReactions();
     }
 
-    for (size_t i = 0; i < nReactions(); i++) {
-        // Scale the forward rate coefficient by the perturbation factor
-        m_ropf[i] *= m_perturb[i];
-        // For reverse rates computed from thermochemistry, multiply the forward
-        // rate coefficients by the reciprocals of the equilibrium constants
-        m_ropr[i] = m_ropf[i] * m_rkcn[i];
+    if (!m_qss.empty()) {
+        KineticsInstrumentation::Timer qssTimer(m_instrumentation, m_sec_qss);
+        solveQss(m_dac_enabled && !refresh);
     }
 
-    // multiply ropf by concentration products
-    m_reactantStoich.multiply(m_act_conc.data(), m_ropf.data());
+    if (m_dac_enabled && !refresh) {
+        updateActiveROP(m_dac_active, m_dac_inactive, m_dac_reactantStoich,
+                        m_dac_revProductStoich);
+        m_dac_count++;
+    } else if (m_mask_enabled) {
+        updateActiveROP(m_mask_active, m_mask_inactive, m_mask_reactantStoich,
+                        m_mask_revProductStoich);
+        if (refresh) {
+            updateActiveSet();
+        }
+    } else if (m_fused_enabled) {
+        KineticsInstrumentation::Timer stoichTimer(m_instrumentation,
+                                                   m_sec_stoich);
+        if (m_fused.nReactions() != nReactions() || m_fused.nSpecies() != m_kk) {
+            m_fused.build(m_kk, nReactions(), m_reactantStoich,
+                          m_revProductStoich, m_productStoich);
+            m_fused_wdot.resize(m_kk);
+        }
+        // concentration products, rates of progress and net production rates
+        // in a single pass over the reactions
+        m_fused.evaluate(m_act_conc.data(), m_perturb.data(), m_rkcn.data(),
+                         m_ropf.data(), m_ropr.data(), m_ropnet.data(),
+                         m_fused_wdot.data());
+        m_fused_wdot_ok = true;
+
+        if (refresh) {
+            updateActiveSet();
+        }
+    } else {
+        KineticsInstrumentation::Timer stoichTimer(m_instrumentation,
+                                                   m_sec_stoich);
+        for (size_t i = 0; i < nReactions(); i++) {
+            // Scale the forward rate coefficient by the perturbation factor
+            m_ropf[i] *= m_perturb[i];
+            // For reverse rates computed from thermochemistry, multiply the
+            // forward rate coefficients by the reciprocals of the equilibrium
+            // constants
+            m_ropr[i] = m_ropf[i] * m_rkcn[i];
+        }
+
+        // multiply ropf by concentration products
+        m_reactantStoich.multiply(m_act_conc.data(), m_ropf.data());
 
-    // for reversible reactions, multiply ropr by concentration products
-    m_revProductStoich.multiply(m_act_conc.data(), m_ropr.data());
+        // for reversible reactions, multiply ropr by concentration products
+        m_revProductStoich.multiply(m_act_conc.data(), m_ropr.data());
 
-    for (size_t j = 0; j != nReactions(); ++j) {
-        m_ropnet[j] = m_ropf[j] - m_ropr[j];
+        for (size_t j = 0; j != nReactions(); ++j) {
+            m_ropnet[j] = m_ropf[j] - m_ropr[j];
+        }
+
+        if (refresh) {
+            updateActiveSet();
+        }
     }
 
     for (size_t i = 0; i < m_rfn.size(); i++) {
@@ -227,6 +942,170 @@ void GasKinetics::updateROP()
     m_ROP_ok = true;
 }
 
+void GasKinetics::setFusedEvaluation(bool enabled)
+{
+    m_fused_enabled = enabled;
+    if (!enabled) {
+        m_fused.clear();
+        m_fused_wdot_ok = false;
+    }
+}
+
+void GasKinetics::getNetProductionRates(double* wdot)
+{
+    updateROP();
+    if (m_fused_wdot_ok && m_fused_wdot.size() == m_kk) {
+        copy(m_fused_wdot.begin(), m_fused_wdot.end(), wdot);
+        return;
+    }
+    fill(wdot, wdot + m_kk, 0.0);
+    // products are created for positive net rate of progress
+    m_productStoich.incrementSpecies(m_ropnet.data(), wdot);
+    // reactants are destroyed for positive net rate of progress
+    m_reactantStoich.decrementSpecies(m_ropnet.data(), wdot);
+}
+
+void GasKinetics::getNetProductionRates(size_t nStates, const double* T,
+                                        const double* P, const double* Y,
+                                        double* wdot)
+{
+    if (!m_mask_ok) {
+        updateReactionMask();
+    }
+    if (m_mask_enabled || m_dac_enabled || !m_qss.empty() || m_tab_Tmax > 0.0
+        || m_rates.nReactions() || m_falloff_high_rates.nReactions()
+        || m_plog_rates.nReactions() || m_cheb_rates.nReactions()) {
+        // features that are only implemented for a single state
+        BulkKinetics::getNetProductionRates(nStates, T, P, Y, wdot);
+        return;
+    }
+
+    ThermoPhase& phase = thermo();
+    size_t nRxn = nReactions();
+    size_t nRows = m_efficiencies.nRows();
+    size_t nBlock = std::min<size_t>(nStates, 32);
+    m_batch_rrt.resize(nBlock);
+    m_batch_logc0.resize(nBlock);
+    m_batch_conc.resize(m_kk * nBlock);
+    m_batch_mu.resize(m_kk * nBlock);
+    m_batch_concm.resize(nRows * nBlock);
+    m_batch_ropf.resize(nRxn * nBlock);
+    m_batch_ropr.resize(nRxn * nBlock);
+    m_batch_wdot.resize(m_kk * nBlock);
+
+    // Arrhenius rate constants are evaluated for all states of a block at
+    // once; other rate types are evaluated for each state
+    MultiRateBase* arrhenius = nullptr;
+    std::vector<MultiRateBase*> single;
+    for (auto& rates : m_bulk_rates) {
+        if (rates->type() == "Arrhenius") {
+            arrhenius = rates.get();
+        } else {
+            single.push_back(rates.get());
+        }
+    }
+    m_batch_single.clear();
+    for (size_t i = 0; i < nRxn; i++) {
+        if (reaction(i)->rate()->type() != "Arrhenius") {
+            m_batch_single.push_back(i);
+        }
+    }
+
+    for (size_t start = 0; start < nStates; start += nBlock) {
+        size_t n = std::min(nBlock, nStates - start);
+        double* ropf = m_batch_ropf.data();
+        double* ropr = m_batch_ropr.data();
+
+        // Properties depending on the thermodynamic state
+        for (size_t j = 0; j < n; j++) {
+            size_t s = start + j;
+            phase.setState_TPY(T[s], P[s], Y + s * m_kk);
+            phase.getActivityConcentrations(m_act_conc.data());
+            phase.getConcentrations(m_phys_conc.data());
+            phase.getStandardChemPotentials(m_grt.data());
+            m_batch_rrt[j] = 1.0 / phase.RT();
+            m_batch_logc0[j] = log(phase.standardConcentration());
+            m_efficiencies.evaluate(m_phys_conc.data(), phase.molarDensity(),
+                                    m_concm_rows.data());
+            for (size_t k = 0; k < m_kk; k++) {
+                m_batch_conc[k * n + j] = m_act_conc[k];
+                m_batch_mu[k * n + j] = m_grt[k];
+            }
+            for (size_t r = 0; r < nRows; r++) {
+                m_batch_concm[r * n + j] = m_concm_rows[r];
+            }
+            if (!single.empty()) {
+                m_multi_concm.update(m_concm_rows, m_concm.data());
+                for (auto rates : single) {
+                    rates->update(phase, *this);
+                    rates->getRateConstants(m_rfn.data());
+                }
+                for (size_t i : m_batch_single) {
+                    ropf[i * n + j] = m_rfn[i];
+                }
+            }
+        }
+
+        // Forward rate constants
+        if (arrhenius) {
+            arrhenius->getRateConstants(n, T + start, ropf);
+        }
+        m_multi_concm.multiply(ropf, m_batch_concm.data(), n);
+
+        // Reciprocals of the equilibrium constants in molar units
+        fill(ropr, ropr + nRxn * n, 0.0);
+        m_revProductStoich.incrementReactions(m_batch_mu.data(), ropr, n);
+        m_reactantStoich.decrementReactions(m_batch_mu.data(), ropr, n);
+        for (size_t irxn : m_revindex) {
+            double* rkc = ropr + irxn * n;
+            for (size_t j = 0; j < n; j++) {
+                rkc[j] = rkc[j] * m_batch_rrt[j] - m_dn[irxn] * m_batch_logc0[j];
+            }
+        }
+        for (size_t irxn : m_irrev) {
+            fill(ropr + irxn * n, ropr + (irxn + 1) * n, 0.0);
+        }
+        vectorExp(ropr, ropr, nRxn * n);
+        for (size_t i = 0; i < nRxn * n; i++) {
+            ropr[i] = std::min(ropr[i], BigNumber);
+        }
+        for (size_t irxn : m_irrev) {
+            fill(ropr + irxn * n, ropr + (irxn + 1) * n, 0.0);
+        }
+
+        // Rates of progress
+        for (size_t i = 0; i < nRxn; i++) {
+            double perturb = m_perturb[i];
+            double* kf = ropf + i * n;
+            double* kr = ropr + i * n;
+            for (size_t j = 0; j < n; j++) {
+                kf[j] *= perturb;
+                kr[j] *= kf[j];
+            }
+        }
+        m_reactantStoich.multiply(m_batch_conc.data(), ropf, n);
+        m_revProductStoich.multiply(m_batch_conc.data(), ropr, n);
+        for (size_t i = 0; i < nRxn * n; i++) {
+            ropf[i] -= ropr[i];
+        }
+
+        // Net production rates
+        double* wdot_b = m_batch_wdot.data();
+        fill(wdot_b, wdot_b + m_kk * n, 0.0);
+        m_productStoich.incrementSpecies(ropf, wdot_b, n);
+        m_reactantStoich.decrementSpecies(ropf, wdot_b, n);
+        for (size_t j = 0; j < n; j++) {
+            double* out = wdot + (start + j) * m_kk;
+            for (size_t k = 0; k < m_kk; k++) {
+                out[k] = wdot_b[k * n + j];
+            }
+        }
+    }
+
+    // Cached rate data do not correspond to the current state of the phase
+    invalidateCache();
+}
+
 void GasKinetics::getFwdRateConstants(double* kfwd)
 {
     update_rates_C();
@@ -262,10 +1141,263 @@ void GasKinetics::getFwdRateConstants(double* kfwd)
     }
 }
 
+void GasKinetics::getDerivativeSettings(AnyMap& settings) const
+{
+    settings["skip-third-bodies"] = m_jac_skip_third_bodies;
+    settings["skip-pressure-dependence"] = m_jac_skip_pressure;
+    settings["rtol-delta"] = m_jac_rtol_delta;
+}
+
+void GasKinetics::setDerivativeSettings(const AnyMap& settings)
+{
+    m_jac_skip_third_bodies = settings.getBool("skip-third-bodies",
+                                               m_jac_skip_third_bodies);
+    m_jac_skip_pressure = settings.getBool("skip-pressure-dependence",
+                                           m_jac_skip_pressure);
+    m_jac_rtol_delta = settings.getDouble("rtol-delta", m_jac_rtol_delta);
+    if (m_jac_rtol_delta <= 0.0) {
+        throw CanteraError("GasKinetics::setDerivativeSettings",
+            "Relative perturbation 'rtol-delta' must be positive.");
+    }
+}
+
+void GasKinetics::assertDerivativesValid(const std::string& name,
+                                         bool legacy_ok)
+{
+    if (!legacy_ok && (m_rates.nReactions() || m_falloff_high_rates.nReactions() ||
+        m_plog_rates.nReactions() || m_cheb_rates.nReactions()))
+    {
+        throw NotImplementedError(name,
+            "Not supported for legacy reaction types.");
+    }
+    if (!m_ready) {
+        throw CanteraError(name, "The object is not fully configured; make "
+            "sure to call resizeReactions().");
+    }
+}
+
+void GasKinetics::process_ddT(const vector_fp& in, double* drop)
+{
+    // derivatives of rate constants at constant pressure
+    copy(in.begin(), in.end(), drop);
+    for (auto& rates : m_bulk_rates) {
+        rates->processRateConstants_ddT(drop, m_rfn.data(), m_jac_rtol_delta);
+    }
+    processLegacy_ddT(drop);
+
+    if (m_jac_skip_pressure) {
+        return;
+    }
+
+    // at constant concentrations, pressure is proportional to temperature, i.e.
+    // d ln(P)/dT = 1/T
+    copy(in.begin(), in.end(), m_rbuf2.begin());
+    for (auto& rates : m_bulk_rates) {
+        rates->processRateConstants_ddP(m_rbuf2.data(), m_rfn.data(),
+                                        m_jac_rtol_delta);
+    }
+    processLegacy_ddP(m_rbuf2.data());
+    double Tinv = 1.0 / thermo().temperature();
+    for (size_t i = 0; i < nReactions(); i++) {
+        drop[i] += m_rbuf2[i] * Tinv;
+    }
+}
+
+void GasKinetics::processLegacy_ddT(double* drop)
+{
+    double T = thermo().temperature();
+    double logT = log(T);
+
+    // logarithmic derivatives of rate constants are stored in m_rbuf1
+    m_rates.update_ddT(T, logT, m_rbuf1.data());
+    m_plog_rates.update_ddT(T, logT, m_rbuf1.data());
+    m_cheb_rates.update_ddT(T, logT, m_rbuf1.data());
+    for (auto rates : {&m_rates.reactionIndices(), &m_plog_rates.reactionIndices(),
+                       &m_cheb_rates.reactionIndices()}) {
+        for (size_t i : *rates) {
+            drop[i] *= m_rbuf1[i];
+        }
+    }
+
+    size_t nfall = m_fallindx.size();
+    if (!nfall) {
+        return;
+    }
+    // falloff reactions, where entries in the work arrays refer to the index
+    // of the reaction within the falloff manager. The reduced pressures are
+    // stored in m_fbuf0, and the logarithmic derivatives of the low- and
+    // high-pressure rate constants in m_fbuf1 and m_fbuf2.
+    m_falloff_low_rates.update_ddT(T, logT, m_fbuf1.data());
+    m_falloff_high_rates.update_ddT(T, logT, m_fbuf2.data());
+    for (size_t i = 0; i < nfall; i++) {
+        m_fbuf0[i] = concm_falloff_values[i] * m_rfn_low[i] / (m_rfn_high[i] + SmallNumber);
+    }
+    m_falloffn.pr_to_falloff_ddT(T, m_fbuf0.data(), m_fbuf1.data(), m_fbuf2.data(),
+                                 falloff_work.data(), m_rbuf1.data());
+    for (size_t i = 0; i < nfall; i++) {
+        drop[m_fallindx[i]] *= m_rbuf1[i];
+    }
+}
+
+void GasKinetics::processLegacy_ddP(double* drop)
+{
+    for (size_t i : m_rates.reactionIndices()) {
+        drop[i] = 0.0;
+    }
+    for (size_t i : m_fallindx) {
+        drop[i] = 0.0;
+    }
+    double T = thermo().temperature();
+    double logT = log(T);
+    m_plog_rates.update_ddP(T, logT, m_rbuf1.data());
+    m_cheb_rates.update_ddP(T, logT, m_rbuf1.data());
+    for (auto rates : {&m_plog_rates.reactionIndices(),
+                       &m_cheb_rates.reactionIndices()}) {
+        for (size_t i : *rates) {
+            drop[i] *= m_rbuf1[i];
+        }
+    }
+}
+
+void GasKinetics::incrementRevRates_ddKc(double factor, double* drop)
+{
+    // reverse rate constants also depend on temperature through the equilibrium
+    // constants, where d ln(1/Kc)/dT = -Delta H^0/(R T^2) + Delta n/T
+    getDeltaSSEnthalpy(m_rbuf1.data());
+    double T = thermo().temperature();
+    double RT2 = thermo().RT() * T;
+    for (size_t i = 0; i < nReactions(); i++) {
+        drop[i] += factor * m_ropr[i] * (m_dn[i] / T - m_rbuf1[i] / RT2);
+    }
+}
+
+void GasKinetics::getFwdRatesOfProgress_ddT(double* drop)
+{
+    assertDerivativesValid("GasKinetics::getFwdRatesOfProgress_ddT", true);
+    updateROP();
+    process_ddT(m_ropf, drop);
+}
+
+void GasKinetics::getRevRatesOfProgress_ddT(double* drop)
+{
+    assertDerivativesValid("GasKinetics::getRevRatesOfProgress_ddT", true);
+    updateROP();
+    process_ddT(m_ropr, drop);
+    incrementRevRates_ddKc(1.0, drop);
+}
+
+void GasKinetics::getNetRatesOfProgress_ddT(double* drop)
+{
+    assertDerivativesValid("GasKinetics::getNetRatesOfProgress_ddT", true);
+    updateROP();
+    // rate constant derivatives scale forward and reverse rates alike, which
+    // allows for them to be applied to net rates of progress directly
+    process_ddT(m_ropnet, drop);
+    incrementRevRates_ddKc(-1.0, drop);
+}
+
+void GasKinetics::getNetProductionRates_ddT(double* dwdot)
+{
+    getNetRatesOfProgress_ddT(m_rbuf0.data());
+    fill(dwdot, dwdot + m_kk, 0.0);
+    m_productStoich.incrementSpecies(m_rbuf0.data(), dwdot);
+    m_reactantStoich.decrementSpecies(m_rbuf0.data(), dwdot);
+}
+
+Eigen::SparseMatrix<double> GasKinetics::process_ddC(
+    StoichManagerN& stoich, const vector_fp& in, bool reverse)
+{
+    // rate coefficients multiplying the concentration products
+    for (size_t i = 0; i < nReactions(); i++) {
+        m_rbuf0[i] = m_rfn[i] * m_perturb[i];
+    }
+    if (reverse) {
+        for (size_t i = 0; i < nReactions(); i++) {
+            m_rbuf0[i] *= m_rkcn[i];
+        }
+    }
+
+    SparseTriplets trips;
+    if (!m_jac_skip_third_bodies) {
+        // derivatives with respect to effective third-body concentrations, which
+        // enter either the rate constants (falloff) or the law of mass action
+        copy(in.begin(), in.end(), m_rbuf1.begin());
+        for (auto& rates : m_bulk_rates) {
+            rates->processRateConstants_ddM(m_rbuf1.data(), m_rfn.data(),
+                                            m_jac_rtol_delta);
+        }
+        for (size_t i = 0; i < nReactions(); i++) {
+            // entries for reactions without third bodies are not-a-number
+            m_rbuf1[i] = (m_concm[i] > 0.0) ? m_rbuf1[i] / m_concm[i] : 0.0;
+        }
+        // for the law of mass action, d(rop)/d[M] is the rate of progress
+        // without the factor [M], which remains valid if [M] vanishes
+        copy(m_rbuf0.begin(), m_rbuf0.end(), m_rbuf2.begin());
+        stoich.multiply(m_act_conc.data(), m_rbuf2.data());
+        m_multi_concm.incrementMassAction(m_rbuf2.data(), m_rbuf1.data());
+        m_multi_concm.derivatives(m_efficiencies, m_rbuf1.data(), m_kk, trips);
+    }
+
+    // law of mass action
+    m_multi_concm.multiply(m_rbuf0.data(), m_concm.data());
+    Eigen::SparseMatrix<double> jac = stoich.derivatives(m_act_conc.data(),
+                                                         m_rbuf0.data());
+
+    if (!m_jac_skip_pressure) {
+        // pressure-dependent rate constants; for an ideal gas, dP/dC_k = RT
+        copy(in.begin(), in.end(), m_rbuf2.begin());
+        for (auto& rates : m_bulk_rates) {
+            rates->processRateConstants_ddP(m_rbuf2.data(), m_rfn.data(),
+                                            m_jac_rtol_delta);
+        }
+        double ctot = thermo().molarDensity();
+        for (size_t i = 0; i < nReactions(); i++) {
+            if (m_rbuf2[i] != 0.0) {
+                for (size_t k = 0; k < m_kk; k++) {
+                    trips.emplace_back(i, k, m_rbuf2[i] / ctot);
+                }
+            }
+        }
+    }
+
+    if (trips.size()) {
+        Eigen::SparseMatrix<double> extra(nReactions(), m_kk);
+        extra.setFromTriplets(trips.begin(), trips.end());
+        jac += extra;
+    }
+    return jac;
+}
+
+Eigen::SparseMatrix<double> GasKinetics::fwdRatesOfProgress_ddC()
+{
+    assertDerivativesValid("GasKinetics::fwdRatesOfProgress_ddC");
+    updateROP();
+    return process_ddC(m_reactantStoich, m_ropf, false);
+}
+
+Eigen::SparseMatrix<double> GasKinetics::revRatesOfProgress_ddC()
+{
+    assertDerivativesValid("GasKinetics::revRatesOfProgress_ddC");
+    updateROP();
+    return process_ddC(m_revProductStoich, m_ropr, true);
+}
+
+Eigen::SparseMatrix<double> GasKinetics::netRatesOfProgress_ddC()
+{
+    assertDerivativesValid("GasKinetics::netRatesOfProgress_ddC");
+    updateROP();
+    return process_ddC(m_reactantStoich, m_ropf, false)
+        - process_ddC(m_revProductStoich, m_ropr, true);
+}
+
 bool GasKinetics::addReaction(shared_ptr<Reaction> r, bool resize)
 {
     // operations common to all reaction types
     bool added = BulkKinetics::addReaction(r, resize);
+    m_rate_table.clear();
+    m_dac_species.clear();
+    m_qss_groups.clear();
+    m_mask_ok = false;
     if (!added) {
         return false;
     } else if (!(r->usesLegacy())) {
@@ -301,6 +1433,9 @@ void GasKinetics::addFalloffReaction(FalloffReaction& r)
     m_rfn_high.push_back(0.0);
     m_falloff_low_rates.install(nfall, r.low_rate);
     m_rfn_low.push_back(0.0);
+    m_fbuf0.push_back(0.0);
+    m_fbuf1.push_back(0.0);
+    m_fbuf2.push_back(0.0);
 
     // add this reaction number to the list of falloff reactions
     m_fallindx.push_back(nReactions()-1);
@@ -314,9 +1449,10 @@ void GasKinetics::addFalloffReaction(FalloffReaction& r)
             efficiencies[k] = eff.second;
         }
     }
-    m_falloff_concm.install(nfall, efficiencies,
-                            r.third_body.default_efficiency,
-                            nReactions() - 1);
+    size_t row = m_efficiencies.addRow(efficiencies,
+                                       r.third_body.default_efficiency);
+    m_concm_rows.push_back(0.0);
+    m_falloff_concm.install(nfall, row, nReactions() - 1);
     concm_falloff_values.resize(m_falloff_concm.workSize());
 
     // install the falloff function calculator for this reaction
@@ -334,8 +1470,10 @@ void GasKinetics::addThreeBodyReaction(ThreeBodyReaction2& r)
             efficiencies[k] = eff.second;
         }
     }
-    m_3b_concm.install(nReactions()-1, efficiencies,
-                       r.third_body.default_efficiency);
+    size_t row = m_efficiencies.addRow(efficiencies,
+                                       r.third_body.default_efficiency);
+    m_concm_rows.push_back(0.0);
+    m_3b_concm.install(nReactions()-1, row);
     concm_3b_values.resize(m_3b_concm.workSize());
 }
 
@@ -356,6 +1494,10 @@ void GasKinetics::modifyReaction(size_t i, shared_ptr<Reaction> rNew)
 
     // invalidate all cached data
     invalidateCache();
+    m_rate_table.clear();
+    m_dac_species.clear();
+    m_qss_groups.clear();
+    m_mask_ok = false;
 
     if (!(rNew->usesLegacy())) {
         // Rate object already modified in BulkKinetics::modifyReaction
@@ -0,0 +1,441 @@
+/**
+ *  @file GeneratedKinetics.cpp Kinetics managers using source code generated
+ *      for a specific reaction mechanism
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/GeneratedKinetics.h"
+#include "cantera/kinetics/Reaction.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/base/stringUtils.h"
+#include <boost/algorithm/string/join.hpp>
+
+using namespace std;
+
+namespace Cantera
+{
+
+GeneratedKinetics::GeneratedKinetics(ThermoPhase* thermo) :
+    GasKinetics(thermo),
+    m_generated_ok(-1),
+    m_arrhenius_index(npos)
+{
+}
+
+bool GeneratedKinetics::addReaction(shared_ptr<Reaction> r, bool resize)
+{
+    m_generated_ok = -1;
+    return GasKinetics::addReaction(r, resize);
+}
+
+void GeneratedKinetics::modifyReaction(size_t i, shared_ptr<Reaction> rNew)
+{
+    GasKinetics::modifyReaction(i, rNew);
+    // rate parameters are compiled into the generated kernels
+    m_generated_ok = 0;
+}
+
+bool GeneratedKinetics::usesGeneratedCode()
+{
+    if (!m_ready) {
+        return false;
+    } else if (m_generated_ok == -1) {
+        m_generated_ok = (mechanismHash(*this) == generatedHash());
+        if (!m_generated_ok) {
+            warn_user("GeneratedKinetics::usesGeneratedCode",
+                "Mechanism does not match the generated source code; using "
+                "generic evaluation of reaction rates instead.");
+        }
+        m_arrhenius_index = npos;
+        if (m_bulk_types.count("Arrhenius")) {
+            m_arrhenius_index = m_bulk_types["Arrhenius"];
+        }
+    }
+    return m_generated_ok == 1 && m_qss.empty() && !m_dac_enabled
+        && !rateTabulationEnabled();
+}
+
+uint64_t GeneratedKinetics::mechanismHash(Kinetics& kin)
+{
+    // Canonical description of all properties built into generated kernels
+    fmt::memory_buffer b;
+    for (size_t k = 0; k < kin.nTotalSpecies(); k++) {
+        fmt_append(b, "{};", kin.kineticsSpeciesName(k));
+    }
+    for (size_t i = 0; i < kin.nReactions(); i++) {
+        auto R = kin.reaction(i);
+        fmt_append(b, "\n{}|{}|{}|", R->equation(), R->reversible,
+                   R->usesLegacy() ? R->type() : R->rate()->type());
+        auto rate = R->usesLegacy() ? nullptr :
+            std::dynamic_pointer_cast<ArrheniusRate>(R->rate());
+        if (rate) {
+            fmt_append(b, "{:.17g},{:.17g},{:.17g}|",
+                       rate->preExponentialFactor(),
+                       rate->temperatureExponent(),
+                       rate->activationEnergy_R());
+        }
+        if (R->thirdBody()) {
+            fmt_append(b, "{:.17g},{}", R->thirdBody()->default_efficiency,
+                       R->thirdBody()->mass_action);
+            for (const auto& eff : R->thirdBody()->efficiencies) {
+                if (kin.kineticsSpeciesIndex(eff.first) != npos) {
+                    fmt_append(b, ",{}:{:.17g}", eff.first, eff.second);
+                }
+            }
+            fmt_append(b, "|");
+        }
+        for (const auto& order : R->orders) {
+            fmt_append(b, "{}:{:.17g},", order.first, order.second);
+        }
+    }
+
+    // 64-bit FNV-1a hash, which does not depend on the standard library
+    // implementation used to compile the generated code
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t n = 0; n < b.size(); n++) {
+        hash ^= static_cast<unsigned char>(b.data()[n]);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+void GeneratedKinetics::update_rates_C()
+{
+    if (!usesGeneratedCode()) {
+        GasKinetics::update_rates_C();
+        return;
+    }
+    thermo().getActivityConcentrations(m_act_conc.data());
+    thermo().getConcentrations(m_phys_conc.data());
+    evalThirdBodyConcentrations(m_phys_conc.data(), thermo().molarDensity(),
+                                m_concm.data());
+    m_ROP_ok = false;
+}
+
+void GeneratedKinetics::update_rates_T()
+{
+    if (!usesGeneratedCode()) {
+        GasKinetics::update_rates_T();
+        return;
+    }
+    double T = thermo().temperature();
+    double P = thermo().pressure();
+    m_logStandConc = log(thermo().standardConcentration());
+
+    if (T != m_temp) {
+        evalArrheniusRates(log(T), 1.0 / T, m_rfn.data());
+        updateKcGenerated();
+        m_ROP_ok = false;
+    }
+
+    // The shared data of the Arrhenius evaluator is kept up to date, as it is
+    // used for derivatives of rate constants
+    for (size_t i = 0; i < m_bulk_rates.size(); i++) {
+        bool changed = m_bulk_rates[i]->update(thermo(), *this);
+        if (changed && i != m_arrhenius_index) {
+            m_bulk_rates[i]->getRateConstants(m_rfn.data());
+            m_ROP_ok = false;
+        }
+    }
+    m_pres = P;
+    m_temp = T;
+}
+
+void GeneratedKinetics::updateKcGenerated()
+{
+    thermo().getStandardChemPotentials(m_grt.data());
+    double rrt = 1.0 / thermo().RT();
+    for (size_t k = 0; k < m_kk; k++) {
+        m_grt[k] *= rrt;
+    }
+    evalEquilibriumConstants(m_grt.data(), m_logStandConc, m_rkcn.data());
+}
+
+void GeneratedKinetics::updateROP()
+{
+    if (!usesGeneratedCode()) {
+        GasKinetics::updateROP();
+        return;
+    }
+    update_rates_C();
+    update_rates_T();
+    if (m_ROP_ok) {
+        return;
+    }
+
+    for (size_t i = 0; i < nReactions(); i++) {
+        m_ropf[i] = m_rfn[i] * m_perturb[i];
+        m_ropr[i] = m_ropf[i] * m_rkcn[i];
+    }
+    evalRatesOfProgress(m_act_conc.data(), m_concm.data(), m_ropf.data(),
+                        m_ropr.data());
+    for (size_t i = 0; i < nReactions(); i++) {
+        m_ropnet[i] = m_ropf[i] - m_ropr[i];
+    }
+    m_ROP_ok = true;
+}
+
+void GeneratedKinetics::getNetProductionRates(double* wdot)
+{
+    if (!usesGeneratedCode()) {
+        GasKinetics::getNetProductionRates(wdot);
+        return;
+    }
+    updateROP();
+    evalNetProductionRates(m_ropnet.data(), wdot);
+}
+
+namespace {
+
+//! Format a floating point constant such that it is read back exactly
+string literal(double x)
+{
+    string s = fmt::format("{:.17g}", x);
+    if (s.find_first_of(".en") == string::npos) {
+        s += ".0";
+    }
+    return s;
+}
+
+//! Append a term `coeff * name` to a sum of terms `sum`
+void addTerm(string& sum, double coeff, const string& name)
+{
+    if (coeff == 1.0) {
+        sum += sum.empty() ? name : " + " + name;
+    } else if (coeff == -1.0) {
+        sum += sum.empty() ? "-" + name : " - " + name;
+    } else if (coeff < 0) {
+        sum += fmt::format("{}{} * {}", sum.empty() ? "-" : " - ",
+                           literal(-coeff), name);
+    } else {
+        sum += fmt::format("{}{} * {}", sum.empty() ? "" : " + ",
+                           literal(coeff), name);
+    }
+}
+
+//! Factors of the law of mass action for species `k` with `order`, mirroring
+//! the evaluation in StoichManagerN
+void addConcentrationFactors(vector<string>& factors, size_t k, double order,
+                             bool power)
+{
+    if (order == 0.0) {
+        return;
+    }
+    if (power) {
+        factors.push_back(fmt::format("(c[{0}] > 0.0 ? std::pow(c[{0}], {1}) "
+                                      ": 0.0)", k, literal(order)));
+    } else {
+        for (int n = 0; n < order; n++) {
+            factors.push_back(fmt::format("c[{}]", k));
+        }
+    }
+}
+
+}
+
+void writeGeneratedKinetics(Kinetics& kin, const string& className,
+                            const string& model, ostream& s)
+{
+    if (kin.kineticsType() != "Gas" || kin.nPhases() != 1) {
+        throw CanteraError("writeGeneratedKinetics",
+            "Code generation is only supported for gas-phase kinetics.");
+    }
+    size_t nsp = kin.nTotalSpecies();
+    size_t nrxn = kin.nReactions();
+
+    // Collect mechanism data
+    vector<string> arrhenius, thirdBodies, kc, rop;
+    vector<string> wdot(nsp);
+    for (size_t i = 0; i < nrxn; i++) {
+        auto R = kin.reaction(i);
+        if (R->usesLegacy()) {
+            throw NotImplementedError("writeGeneratedKinetics",
+                "Reaction '{}' uses legacy rate type '{}'.",
+                R->equation(), R->type());
+        }
+
+        auto rate = std::dynamic_pointer_cast<ArrheniusRate>(R->rate());
+        if (rate) {
+            double A = rate->preExponentialFactor();
+            double b = rate->temperatureExponent();
+            double Ea_R = rate->activationEnergy_R();
+            string exponent;
+            if (b != 0.0) {
+                addTerm(exponent, b, "logT");
+            }
+            if (Ea_R != 0.0) {
+                addTerm(exponent, -Ea_R, "recipT");
+            }
+            string expr = literal(A);
+            if (!exponent.empty()) {
+                expr += fmt::format(" * std::exp({})", exponent);
+            }
+            arrhenius.push_back(fmt::format("kf[{}] = {};", i, expr));
+        }
+
+        bool massAction = false;
+        if (R->thirdBody()) {
+            auto tb = R->thirdBody();
+            massAction = tb->mass_action;
+            string sum;
+            if (tb->default_efficiency != 0.0) {
+                addTerm(sum, tb->default_efficiency, "ctot");
+            }
+            for (const auto& eff : tb->efficiencies) {
+                size_t k = kin.kineticsSpeciesIndex(eff.first);
+                double coeff = eff.second - tb->default_efficiency;
+                if (k != npos && coeff != 0.0) {
+                    addTerm(sum, coeff, fmt::format("conc[{}]", k));
+                }
+            }
+            thirdBodies.push_back(fmt::format("concm[{}] = {};", i,
+                                              sum.empty() ? "0.0" : sum));
+        }
+
+        // Stoichiometry, following Kinetics::addReaction
+        map<size_t, double> rstoich, rorder, pstoich;
+        for (const auto& sp : R->reactants) {
+            rstoich[kin.kineticsSpeciesIndex(sp.first)] += sp.second;
+        }
+        rorder = rstoich;
+        for (const auto& sp : R->orders) {
+            rorder[kin.kineticsSpeciesIndex(sp.first)] = sp.second;
+        }
+        for (const auto& sp : R->products) {
+            pstoich[kin.kineticsSpeciesIndex(sp.first)] += sp.second;
+        }
+
+        // Forward and reverse concentration products; use power functions for
+        // the same cases as StoichManagerN
+        bool fpower = rorder.size() > 3;
+        for (const auto& sp : rorder) {
+            double nu = rstoich.count(sp.first) ? rstoich[sp.first] : 0.0;
+            fpower |= (fmod(nu, 1.0) != 0.0 || nu != sp.second);
+        }
+        double nf = 0;
+        for (const auto& sp : rstoich) {
+            nf += sp.second;
+        }
+        fpower |= (nf > 3);
+        vector<string> ffactors, rfactors;
+        if (massAction) {
+            ffactors.push_back(fmt::format("concm[{}]", i));
+            rfactors.push_back(fmt::format("concm[{}]", i));
+        }
+        for (const auto& sp : rorder) {
+            addConcentrationFactors(ffactors, sp.first, sp.second, fpower);
+        }
+        bool rpower = pstoich.size() > 3;
+        double nr = 0;
+        for (const auto& sp : pstoich) {
+            rpower |= (fmod(sp.second, 1.0) != 0.0);
+            nr += sp.second;
+        }
+        rpower |= (nr > 3);
+        for (const auto& sp : pstoich) {
+            addConcentrationFactors(rfactors, sp.first, sp.second, rpower);
+        }
+        if (!ffactors.empty()) {
+            rop.push_back(fmt::format("ropf[{}] *= {};", i,
+                                      boost::algorithm::join(ffactors, " * ")));
+        }
+        if (R->reversible && !rfactors.empty()) {
+            rop.push_back(fmt::format("ropr[{}] *= {};", i,
+                                      boost::algorithm::join(rfactors, " * ")));
+        }
+
+        // Equilibrium constants and net production rates
+        string dG;
+        double dn = 0.0;
+        map<size_t, double> nu;
+        for (const auto& sp : pstoich) {
+            nu[sp.first] += sp.second;
+        }
+        for (const auto& sp : rstoich) {
+            nu[sp.first] -= sp.second;
+        }
+        for (const auto& sp : nu) {
+            dn += sp.second;
+            if (sp.second != 0.0) {
+                addTerm(dG, sp.second, fmt::format("g0_RT[{}]", sp.first));
+                addTerm(wdot[sp.first], sp.second, fmt::format("ropnet[{}]", i));
+            }
+        }
+        if (R->reversible) {
+            if (dn != 0.0) {
+                addTerm(dG, -dn, "logStandConc");
+            }
+            kc.push_back(fmt::format("rkc[{}] = std::min(std::exp({}), BigNumber);",
+                                     i, dG.empty() ? "0.0" : dG));
+        } else {
+            kc.push_back(fmt::format("rkc[{}] = 0.0;", i));
+        }
+    }
+
+    auto writeBody = [&s](const vector<string>& lines) {
+        for (const auto& line : lines) {
+            s << "        " << line << "\n";
+        }
+    };
+
+    s << "// Kinetics manager generated by Cantera " CANTERA_VERSION
+         " for a mechanism with\n";
+    s << fmt::format("// {} species and {} reactions. Do not edit.\n\n", nsp, nrxn);
+    s << "#include \"cantera/kinetics/GeneratedKinetics.h\"\n";
+    s << "#include \"cantera/kinetics/KineticsFactory.h\"\n\n";
+    s << "namespace Cantera\n{\n\n";
+    s << fmt::format("class {} : public GeneratedKinetics\n{{\n", className);
+    s << "public:\n";
+    s << fmt::format("    {}(ThermoPhase* thermo=0) : GeneratedKinetics(thermo) {{}}\n\n",
+                     className);
+    s << "protected:\n";
+    s << "    virtual uint64_t generatedHash() const override {\n";
+    s << fmt::format("        return {}ull;\n", GeneratedKinetics::mechanismHash(kin));
+    s << "    }\n\n";
+
+    s << "    virtual void evalArrheniusRates(double logT, double recipT,\n"
+         "                                    double* kf) const override {\n";
+    writeBody(arrhenius);
+    s << "    }\n\n";
+
+    s << "    virtual void evalThirdBodyConcentrations(const double* conc, double ctot,\n"
+         "                                             double* concm) const override {\n";
+    writeBody(thirdBodies);
+    s << "    }\n\n";
+
+    s << "    virtual void evalEquilibriumConstants(const double* g0_RT,\n"
+         "                                          double logStandConc,\n"
+         "                                          double* rkc) const override {\n";
+    writeBody(kc);
+    s << "    }\n\n";
+
+    s << "    virtual void evalRatesOfProgress(const double* c, const double* concm,\n"
+         "                                     double* ropf, double* ropr) const override {\n";
+    writeBody(rop);
+    s << "    }\n\n";
+
+    s << "    virtual void evalNetProductionRates(const double* ropnet,\n"
+         "                                        double* wdot) const override {\n";
+    for (size_t k = 0; k < nsp; k++) {
+        s << fmt::format("        wdot[{}] = {};\n", k,
+                         wdot[k].empty() ? "0.0" : wdot[k]);
+    }
+    s << "    }\n";
+    s << "};\n\n";
+
+    s << "namespace {\n\n";
+    s << "//! Register the generated class with the KineticsFactory when loaded\n";
+    s << fmt::format("struct {}Registration\n{{\n", className);
+    s << fmt::format("    {}Registration() {{\n", className);
+    s << fmt::format("        KineticsFactory::factory()->reg(\"{}\",\n"
+                     "            []() {{ return new {}(); }});\n",
+                     toLowerCopy(model), className);
+    s << "    }\n";
+    s << fmt::format("}} s_{}Registration;\n\n", className);
+    s << "}\n\n";
+    s << "}\n";
+}
+
+}
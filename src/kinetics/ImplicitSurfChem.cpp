@@ -11,6 +11,7 @@
 #include "cantera/kinetics/ImplicitSurfChem.h"
 #include "cantera/kinetics/solveSP.h"
 #include "cantera/thermo/SurfPhase.h"
+#include "cantera/numerics/AdaptivePreconditioner.h"
 
 using namespace std;
 
@@ -32,6 +33,7 @@ ImplicitSurfChem::ImplicitSurfChem(
     m_mediumSpeciesStart(-1),
     m_bulkSpeciesStart(-1),
     m_surfSpeciesStart(-1),
+    m_linearSolverType("auto"),
     m_commonTempPressForPhases(true),
     m_ioFlag(0)
 {
@@ -75,6 +77,23 @@ ImplicitSurfChem::ImplicitSurfChem(
         pLocVec.push_back(pLocTmp);
     }
     m_numTotalSpecies = m_nv + m_numTotalBulkSpecies;
+
+    // Map kinetic species to the surface coverages in the solution vector
+    for (auto kinPtr : m_vecKinPtrs) {
+        std::vector<size_t> stateIndex(kinPtr->nTotalSpecies(), npos);
+        for (size_t ip = 0; ip < kinPtr->nPhases(); ip++) {
+            for (size_t m = 0; m < m_surf.size(); m++) {
+                if (&kinPtr->thermo(ip) != m_surf[m]) {
+                    continue;
+                }
+                size_t kstart = kinPtr->kineticsSpeciesIndex(0, ip);
+                for (size_t k = 0; k < m_nsp[m]; k++) {
+                    stateIndex[kstart + k] = m_specStartIndex[m] + k;
+                }
+            }
+        }
+        m_kinSpecState.push_back(stateIndex);
+    }
     m_concSpecies.resize(m_numTotalSpecies, 0.0);
     m_concSpeciesSave.resize(m_numTotalSpecies, 0.0);
 
@@ -135,12 +154,44 @@ void ImplicitSurfChem::setMaxErrTestFails(size_t maxErrTestFails)
     m_integ->setMaxErrTestFails(static_cast<int>(m_maxErrTestFails));
 }
 
+void ImplicitSurfChem::setLinearSolverType(const std::string& type)
+{
+    if (type != "auto" && type != "dense" && type != "sparse") {
+        throw CanteraError("ImplicitSurfChem::setLinearSolverType",
+                           "Unknown linear solver type '{}'", type);
+    }
+    m_linearSolverType = type;
+    if (m_surfSolver) {
+        m_surfSolver->setLinearSolverType(type);
+    }
+}
+
 void ImplicitSurfChem::initialize(doublereal t0)
 {
     this->setTolerances(m_rtol, m_atol);
     this->setMaxStepSize(m_maxstep);
     this->setMaxSteps(m_nmax);
     this->setMaxErrTestFails(m_maxErrTestFails);
+
+    bool sparse = (m_linearSolverType == "sparse");
+    if (m_linearSolverType == "auto" && m_nv >= solveSP::s_sparseMinSize) {
+        m_jacTrips.clear();
+        getJacobianElements(m_jacTrips);
+        sparse = (m_jacTrips.size() <= solveSP::s_sparseMaxDensity * m_nv * m_nv);
+    }
+    if (sparse) {
+        if (!m_precon) {
+            m_precon = make_shared<AdaptivePreconditioner>();
+        }
+        m_precon->initialize(m_nv);
+        m_precon->setAbsoluteTolerance(m_atol);
+        m_integ->setPreconditioner(m_precon);
+        m_integ->setProblemType(GMRES);
+    } else if (m_precon) {
+        m_precon.reset();
+        m_integ->setPreconditioner(m_precon);
+        m_integ->setProblemType(DENSE + NOJAC);
+    }
     m_integ->initialize(t0, *this);
 }
 
@@ -182,13 +233,90 @@ void ImplicitSurfChem::eval(doublereal time, doublereal* y,
         double sum = 0.0;
         for (size_t k = 1; k < m_nsp[n]; k++) {
             ydot[k + loc] = m_work[kstart + k] * rs0 * m_surf[n]->size(k);
-            sum -= ydot[k];
+            sum -= ydot[k + loc];
         }
         ydot[loc] = sum;
         loc += m_nsp[n];
     }
 }
 
+void ImplicitSurfChem::getJacobianElements(SparseTriplets& trips)
+{
+    // Derivatives of the concentrations with respect to the coverages
+    vector_fp dCdtheta(m_nv);
+    for (size_t n = 0; n < m_surf.size(); n++) {
+        for (size_t k = 0; k < m_nsp[n]; k++) {
+            dCdtheta[m_specStartIndex[n] + k] = m_surf[n]->siteDensity()
+                                                / m_surf[n]->size(k);
+        }
+    }
+    for (size_t n = 0; n < m_surf.size(); n++) {
+        InterfaceKinetics* kinPtr = m_vecKinPtrs[n];
+        double rs0 = 1.0 / m_surf[n]->siteDensity();
+        size_t kstart = kinPtr->kineticsSpeciesIndex(0, m_surfindex[n]);
+        size_t loc = m_specStartIndex[n];
+        const auto& stateIndex = m_kinSpecState[n];
+        Eigen::SparseMatrix<double> dwdot = kinPtr->netProductionRates_ddC();
+        for (int j = 0; j < dwdot.outerSize(); j++) {
+            size_t col = stateIndex[j];
+            if (col == npos) {
+                continue;
+            }
+            for (Eigen::SparseMatrix<double>::InnerIterator it(dwdot, j);
+                 it; ++it) {
+                size_t k = it.row();
+                if (k <= kstart || k >= kstart + m_nsp[n]) {
+                    continue;
+                }
+                double value = it.value() * rs0 * m_surf[n]->size(k - kstart)
+                               * dCdtheta[col];
+                trips.emplace_back(static_cast<int>(loc + k - kstart),
+                                   static_cast<int>(col), value);
+                // The equation for the first species of each phase ensures
+                // that the sum of the coverages stays constant
+                trips.emplace_back(static_cast<int>(loc),
+                                   static_cast<int>(col), -value);
+            }
+        }
+    }
+}
+
+void ImplicitSurfChem::preconditionerSetup(double t, double* y, double gamma)
+{
+    if (!m_precon) {
+        throw CanteraError("ImplicitSurfChem::preconditionerSetup",
+                           "No preconditioner has been set.");
+    }
+    updateState(y);
+    m_precon->reset();
+    m_precon->setGamma(gamma);
+    m_jacTrips.clear();
+    getJacobianElements(m_jacTrips);
+    for (const auto& trip : m_jacTrips) {
+        m_precon->setValue(trip.row(), trip.col(), trip.value());
+    }
+    m_precon->setup();
+}
+
+void ImplicitSurfChem::updatePreconditioner(double gamma)
+{
+    if (!m_precon) {
+        throw CanteraError("ImplicitSurfChem::updatePreconditioner",
+                           "No preconditioner has been set.");
+    }
+    m_precon->setGamma(gamma);
+    m_precon->updatePreconditioner();
+}
+
+void ImplicitSurfChem::preconditionerSolve(double* rhs, double* output)
+{
+    if (!m_precon) {
+        throw CanteraError("ImplicitSurfChem::preconditionerSolve",
+                           "No preconditioner has been set.");
+    }
+    m_precon->solve(m_nv, rhs, output);
+}
+
 void ImplicitSurfChem::solvePseudoSteadyStateProblem(int ifuncOverride,
         doublereal timeScaleOverride)
 {
@@ -199,6 +327,7 @@ void ImplicitSurfChem::solvePseudoSteadyStateProblem(int ifuncOverride,
     doublereal time_scale = timeScaleOverride;
     if (!m_surfSolver) {
         m_surfSolver.reset(new solveSP(this, bulkFunc));
+        m_surfSolver->setLinearSolverType(m_linearSolverType);
         // set ifunc, which sets the algorithm.
         ifunc = SFLUX_INITIALIZE;
     } else {
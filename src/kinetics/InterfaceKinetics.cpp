@@ -31,6 +31,13 @@ InterfaceKinetics::InterfaceKinetics(ThermoPhase* thermo) :
     m_ioFlag(0),
     m_nDim(2)
 {
+    m_sec_rop = m_instrumentation.section("updateROP");
+    m_sec_rates_T = m_instrumentation.section("update_rates_T");
+    m_sec_rates_C = m_instrumentation.section("update_rates_C");
+    m_sec_Kc = m_instrumentation.section("updateKc");
+    m_sec_arrhenius = m_instrumentation.section("rates: surface-Arrhenius");
+    m_sec_blowers_masel = m_instrumentation.section("rates: Blowers-Masel");
+    m_sec_stoich = m_instrumentation.section("concentration products");
     if (thermo != 0) {
         addPhase(*thermo);
     }
@@ -49,6 +56,7 @@ void InterfaceKinetics::setElectricPotential(int n, doublereal V)
 
 void InterfaceKinetics::_update_rates_T()
 {
+    KineticsInstrumentation::Timer timer(m_instrumentation, m_sec_rates_T);
     // First task is update the electrical potentials from the Phases
     _update_rates_phi();
     if (m_has_coverage_dependence) {
@@ -60,19 +68,30 @@ void InterfaceKinetics::_update_rates_T()
 
     // Go find the temperature from the surface
     doublereal T = thermo(surfacePhaseIndex()).temperature();
+    // Rate constants are recomputed on every call and are never cached, so no
+    // cache hits are recorded for this section
     m_redo_rates = true;
     if (T != m_temp || m_redo_rates) {
         m_logtemp = log(T);
 
         //  Calculate the forward rate constant by calling m_rates and store it in m_rfn[]
-        m_rates.update(T, m_logtemp, m_rfn.data());
-        for (size_t n = 0; n < nPhases(); n++) {
-            thermo(n).getPartialMolarEnthalpies(m_grt.data() + m_start[n]);
+        {
+            KineticsInstrumentation::Timer ratesTimer(m_instrumentation,
+                                                      m_sec_arrhenius);
+            m_rates.update(T, m_logtemp, m_rfn.data());
         }
+        {
+            KineticsInstrumentation::Timer ratesTimer(m_instrumentation,
+                                                      m_sec_blowers_masel);
+            for (size_t n = 0; n < nPhases(); n++) {
+                thermo(n).getPartialMolarEnthalpies(m_grt.data() + m_start[n]);
+            }
 
-        // Use the stoichiometric manager to find deltaH for each reaction.
-        getReactionDelta(m_grt.data(), m_dH.data());
-        m_blowers_masel_rates.updateBlowersMasel(T, m_logtemp, m_rfn.data(), m_dH.data());
+            // Use the stoichiometric manager to find deltaH for each reaction.
+            getReactionDelta(m_grt.data(), m_dH.data());
+            m_blowers_masel_rates.updateBlowersMasel(T, m_logtemp, m_rfn.data(),
+                                                     m_dH.data());
+        }
         applyStickingCorrection(T, m_rfn.data());
 
         // If we need to do conversions between exchange current density
@@ -103,6 +122,7 @@ void InterfaceKinetics::_update_rates_phi()
 
 void InterfaceKinetics::_update_rates_C()
 {
+    KineticsInstrumentation::Timer timer(m_instrumentation, m_sec_rates_C);
     for (size_t n = 0; n < nPhases(); n++) {
         const ThermoPhase* tp = m_thermo[n];
         /*
@@ -128,6 +148,7 @@ void InterfaceKinetics::getActivityConcentrations(doublereal* const conc)
 
 void InterfaceKinetics::updateKc()
 {
+    KineticsInstrumentation::Timer timer(m_instrumentation, m_sec_Kc);
     fill(m_rkcn.begin(), m_rkcn.end(), 0.0);
 
     if (m_revindex.size() > 0) {
@@ -300,6 +321,7 @@ void InterfaceKinetics::getRevRateConstants(doublereal* krev, bool doIrreversibl
 
 void InterfaceKinetics::updateROP()
 {
+    KineticsInstrumentation::Timer timer(m_instrumentation, m_sec_rop);
     // evaluate rate constants and equilibrium constants at temperature and phi
     // (electric potential)
     _update_rates_T();
@@ -307,27 +329,33 @@ void InterfaceKinetics::updateROP()
     _update_rates_C();
 
     if (m_ROP_ok) {
+        m_instrumentation.hit(m_sec_rop);
         return;
     }
 
-    for (size_t i = 0; i < nReactions(); i++) {
-        // Scale the base forward rate coefficient by the perturbation factor
-        m_ropf[i] = m_rfn[i] * m_perturb[i];
-        // Multiply the scaled forward rate coefficient by the reciprocal of the
-        // equilibrium constant
-        m_ropr[i] = m_ropf[i] * m_rkcn[i];
-    }
+    {
+        KineticsInstrumentation::Timer stoichTimer(m_instrumentation,
+                                                   m_sec_stoich);
+        for (size_t i = 0; i < nReactions(); i++) {
+            // Scale the base forward rate coefficient by the perturbation
+            // factor
+            m_ropf[i] = m_rfn[i] * m_perturb[i];
+            // Multiply the scaled forward rate coefficient by the reciprocal
+            // of the equilibrium constant
+            m_ropr[i] = m_ropf[i] * m_rkcn[i];
+        }
 
-    // multiply ropf by the activity concentration reaction orders to obtain
-    // the forward rates of progress.
-    m_reactantStoich.multiply(m_actConc.data(), m_ropf.data());
+        // multiply ropf by the activity concentration reaction orders to obtain
+        // the forward rates of progress.
+        m_reactantStoich.multiply(m_actConc.data(), m_ropf.data());
 
-    // For reversible reactions, multiply ropr by the activity concentration
-    // products
-    m_revProductStoich.multiply(m_actConc.data(), m_ropr.data());
+        // For reversible reactions, multiply ropr by the activity concentration
+        // products
+        m_revProductStoich.multiply(m_actConc.data(), m_ropr.data());
 
-    for (size_t j = 0; j != nReactions(); ++j) {
-        m_ropnet[j] = m_ropf[j] - m_ropr[j];
+        for (size_t j = 0; j != nReactions(); ++j) {
+            m_ropnet[j] = m_ropf[j] - m_ropr[j];
+        }
     }
 
     // For reactions involving multiple phases, we must check that the phase
@@ -672,7 +700,8 @@ SurfaceArrhenius InterfaceKinetics::buildSurfaceArrhenius(
 
         if (!replace) {
             m_stickingData.emplace_back(StickData{i, surface_order, multiplier,
-                                                  r.use_motz_wise_correction});
+                                                  r.use_motz_wise_correction,
+                                                  1.0});
         } else {
             // Modifying an existing sticking reaction.
             for (auto& item : m_stickingData) {
@@ -695,6 +724,7 @@ SurfaceArrhenius InterfaceKinetics::buildSurfaceArrhenius(
         size_t k = thermo(reactionPhaseIndex()).speciesIndex(sp.first);
         rate.addCoverageDependence(k, sp.second.a, sp.second.m, sp.second.E);
     }
+    setCoverageDerivatives(i, r.coverage_deps);
     return rate;
 }
 
@@ -766,7 +796,8 @@ BMSurfaceArrhenius InterfaceKinetics::buildBMSurfaceArrhenius(
 
         if (!replace) {
             m_stickingData.emplace_back(StickData{i, surface_order, multiplier,
-                                                  r.use_motz_wise_correction});
+                                                  r.use_motz_wise_correction,
+                                                  1.0});
         } else {
             // Modifying an existing sticking reaction.
             for (auto& item : m_stickingData) {
@@ -790,9 +821,95 @@ BMSurfaceArrhenius InterfaceKinetics::buildBMSurfaceArrhenius(
         size_t k = thermo(reactionPhaseIndex()).speciesIndex(sp.first);
         rate.addCoverageDependence(k, sp.second.a, sp.second.m, sp.second.E);
     }
+    setCoverageDerivatives(i, r.coverage_deps);
     return rate;
 }
 
+void InterfaceKinetics::setCoverageDerivatives(
+    size_t i, const std::map<std::string, CoverageDependency>& deps)
+{
+    m_coverageDerivatives.erase(
+        std::remove_if(m_coverageDerivatives.begin(),
+                       m_coverageDerivatives.end(),
+                       [i](const CoverageDerivative& d) { return d.rxn == i; }),
+        m_coverageDerivatives.end());
+    for (const auto& sp : deps) {
+        size_t k = thermo(reactionPhaseIndex()).speciesIndex(sp.first);
+        m_coverageDerivatives.push_back(
+            CoverageDerivative{i, k, sp.second.a, sp.second.m, sp.second.E});
+    }
+}
+
+Eigen::SparseMatrix<double> InterfaceKinetics::process_ddC(
+    StoichManagerN& stoich, const vector_fp& in, bool reverse)
+{
+    // rate coefficients multiplying the concentration products
+    vector_fp rates(nReactions());
+    for (size_t i = 0; i < nReactions(); i++) {
+        rates[i] = m_rfn[i] * m_perturb[i];
+        if (reverse) {
+            rates[i] *= m_rkcn[i];
+        }
+    }
+
+    // law of mass action
+    Eigen::SparseMatrix<double> jac = stoich.derivatives(m_actConc.data(),
+                                                         rates.data());
+    if (m_coverageDerivatives.empty()) {
+        return jac;
+    }
+
+    // coverage-dependent rate constants, where
+    // d ln(k) / d theta_k = a ln(10) - E / T + m / theta_k and
+    // d theta_k / d C_k = size_k / n0
+    size_t nsp = m_surf->nSpecies();
+    vector_fp theta(nsp);
+    m_surf->getCoverages(theta.data());
+    size_t kstart = kineticsSpeciesIndex(0, surfacePhaseIndex());
+    double recipT = 1.0 / thermo(surfacePhaseIndex()).temperature();
+    double rn0 = 1.0 / m_surf->siteDensity();
+    vector_fp stickScale(nReactions(), 1.0);
+    for (const auto& item : m_stickingData) {
+        stickScale[item.index] = item.dlnk_dlngamma;
+    }
+
+    SparseTriplets trips;
+    trips.reserve(m_coverageDerivatives.size());
+    for (const auto& d : m_coverageDerivatives) {
+        if (in[d.rxn] == 0.0) {
+            continue;
+        }
+        double dlnk = d.a * log(10.0) - d.E * recipT;
+        if (d.m != 0.0 && theta[d.k] > Tiny) {
+            dlnk += d.m / theta[d.k];
+        }
+        trips.emplace_back(d.rxn, kstart + d.k, in[d.rxn] * dlnk
+                           * stickScale[d.rxn] * m_surf->size(d.k) * rn0);
+    }
+    Eigen::SparseMatrix<double> extra(nReactions(), m_kk);
+    extra.setFromTriplets(trips.begin(), trips.end());
+    return jac + extra;
+}
+
+Eigen::SparseMatrix<double> InterfaceKinetics::fwdRatesOfProgress_ddC()
+{
+    updateROP();
+    return process_ddC(m_reactantStoich, m_ropf, false);
+}
+
+Eigen::SparseMatrix<double> InterfaceKinetics::revRatesOfProgress_ddC()
+{
+    updateROP();
+    return process_ddC(m_revProductStoich, m_ropr, true);
+}
+
+Eigen::SparseMatrix<double> InterfaceKinetics::netRatesOfProgress_ddC()
+{
+    updateROP();
+    return process_ddC(m_reactantStoich, m_ropf, false)
+        - process_ddC(m_revProductStoich, m_ropr, true);
+}
+
 void InterfaceKinetics::setIOFlag(int ioFlag)
 {
     m_ioFlag = ioFlag;
@@ -945,8 +1062,9 @@ void InterfaceKinetics::applyStickingCorrection(double T, double* kf)
     }
 
     for (size_t n = 0; n < m_stickingData.size(); n++) {
-        const StickData& item = m_stickingData[n];
+        StickData& item = m_stickingData[n];
         if (item.use_motz_wise) {
+            item.dlnk_dlngamma = 1.0 / (1 - 0.5 * kf[item.index]);
             kf[item.index] /= 1 - 0.5 * kf[item.index];
         }
         kf[item.index] *= factors[n] * sqrt(T) * item.multiplier;
@@ -17,6 +17,7 @@
 #include "cantera/base/utilities.h"
 #include "cantera/base/global.h"
 #include <unordered_set>
+#include <unordered_map>
 #include <boost/algorithm/string/join.hpp>
 
 using namespace std;
@@ -93,11 +94,64 @@ void Kinetics::checkSpeciesArraySize(size_t kk) const
     }
 }
 
+namespace {
+
+//! Third-body collision efficiencies of reaction `R`, or `nullptr` if the
+//! reaction type does not involve a third body
+const ThirdBody* thirdBody(Reaction& R)
+{
+    string type = R.type();
+    if (type == "falloff-legacy" || type == "chemically-activated-legacy") {
+        return &dynamic_cast<FalloffReaction2&>(R).third_body;
+    } else if (type == "falloff" || type == "chemically-activated") {
+        return dynamic_cast<FalloffReaction3&>(R).thirdBody().get();
+    } else if (type == "three-body") {
+        return dynamic_cast<ThreeBodyReaction3&>(R).thirdBody().get();
+    } else if (type == "three-body-legacy") {
+        return &dynamic_cast<ThreeBodyReaction2&>(R).third_body;
+    }
+    return nullptr;
+}
+
+//! Check whether any species of `kin` has non-zero third-body efficiencies in
+//! both `tb1` and `tb2`. Only species listed explicitly in either reaction are
+//! checked individually; all other species share the default efficiencies.
+bool thirdBodyOverlap(const ThirdBody& tb1, const ThirdBody& tb2,
+                      const Kinetics& kin)
+{
+    size_t nListed = 0;
+    for (const auto& eff : tb1.efficiencies) {
+        if (kin.kineticsSpeciesIndex(eff.first) == npos) {
+            continue;
+        }
+        nListed++;
+        if (eff.second * tb2.efficiency(eff.first) != 0.0) {
+            return true;
+        }
+    }
+    for (const auto& eff : tb2.efficiencies) {
+        if (tb1.efficiencies.count(eff.first)
+            || kin.kineticsSpeciesIndex(eff.first) == npos) {
+            continue;
+        }
+        nListed++;
+        if (tb1.efficiency(eff.first) * eff.second != 0.0) {
+            return true;
+        }
+    }
+    return nListed < kin.nTotalSpecies()
+        && tb1.default_efficiency * tb2.default_efficiency != 0.0;
+}
+
+}
+
 std::pair<size_t, size_t> Kinetics::checkDuplicates(bool throw_err) const
 {
     //! Map of (key indicating participating species) to reaction numbers
-    std::map<size_t, std::vector<size_t> > participants;
+    std::unordered_map<size_t, std::vector<size_t>> participants;
+    participants.reserve(m_reactions.size());
     std::vector<std::map<int, double> > net_stoich;
+    net_stoich.reserve(m_reactions.size());
     std::unordered_set<size_t> unmatched_duplicates;
     for (size_t i = 0; i < m_reactions.size(); i++) {
         if (m_reactions[i]->duplicate) {
@@ -105,23 +159,32 @@ std::pair<size_t, size_t> Kinetics::checkDuplicates(bool throw_err) const
         }
     }
 
+    std::vector<size_t> species;
     for (size_t i = 0; i < m_reactions.size(); i++) {
         // Get data about this reaction
-        unsigned long int key = 0;
         Reaction& R = *m_reactions[i];
         net_stoich.emplace_back();
         std::map<int, double>& net = net_stoich.back();
+        species.clear();
         for (const auto& sp : R.reactants) {
             int k = static_cast<int>(kineticsSpeciesIndex(sp.first));
-            key += k*(k+1);
+            species.push_back(k);
             net[-1 -k] -= sp.second;
         }
         for (const auto& sp : R.products) {
             int k = static_cast<int>(kineticsSpeciesIndex(sp.first));
-            key += k*(k+1);
+            species.push_back(k);
             net[1+k] += sp.second;
         }
 
+        // The key is a hash of the sorted participating species, such that
+        // reactions with different participants rarely share the same key
+        std::sort(species.begin(), species.end());
+        size_t key = species.size();
+        for (size_t k : species) {
+            key ^= std::hash<size_t>()(k) + 0x9e3779b9 + (key << 6) + (key >> 2);
+        }
+
         // Compare this reaction to others with similar participants
         vector<size_t>& related = participants[key];
         for (size_t m : related) {
@@ -139,71 +202,11 @@ std::pair<size_t, size_t> Kinetics::checkDuplicates(bool throw_err) const
                 continue; // stoichiometries differ (not by a multiple)
             } else if (c < 0.0 && !R.reversible && !other.reversible) {
                 continue; // irreversible reactions in opposite directions
-            } else if (R.type() == "falloff-legacy" ||
-                       R.type() == "chemically-activated-legacy") {
-                ThirdBody& tb1 = dynamic_cast<FalloffReaction2&>(R).third_body;
-                ThirdBody& tb2 = dynamic_cast<FalloffReaction2&>(other).third_body;
-                bool thirdBodyOk = true;
-                for (size_t k = 0; k < nTotalSpecies(); k++) {
-                    string s = kineticsSpeciesName(k);
-                    if (tb1.efficiency(s) * tb2.efficiency(s) != 0.0) {
-                        // non-zero third body efficiencies for species `s` in
-                        // both reactions
-                        thirdBodyOk = false;
-                        break;
-                    }
-                }
-                if (thirdBodyOk) {
-                    continue; // No overlap in third body efficiencies
-                }
-            } else if (R.type() == "falloff" || R.type() == "chemically-activated") {
-                auto tb1 = dynamic_cast<FalloffReaction3&>(R).thirdBody();
-                auto tb2 = dynamic_cast<FalloffReaction3&>(other).thirdBody();
-                bool thirdBodyOk = true;
-                for (size_t k = 0; k < nTotalSpecies(); k++) {
-                    string s = kineticsSpeciesName(k);
-                    if (tb1->efficiency(s) * tb2->efficiency(s) != 0.0) {
-                        // non-zero third body efficiencies for species `s` in
-                        // both reactions
-                        thirdBodyOk = false;
-                        break;
-                    }
-                }
-                if (thirdBodyOk) {
-                    continue; // No overlap in third body efficiencies
-                }
-            } else if (R.type() == "three-body") {
-                ThirdBody& tb1 = *(dynamic_cast<ThreeBodyReaction3&>(R).thirdBody());
-                ThirdBody& tb2 = *(dynamic_cast<ThreeBodyReaction3&>(other).thirdBody());
-                bool thirdBodyOk = true;
-                for (size_t k = 0; k < nTotalSpecies(); k++) {
-                    string s = kineticsSpeciesName(k);
-                    if (tb1.efficiency(s) * tb2.efficiency(s) != 0.0) {
-                        // non-zero third body efficiencies for species `s` in
-                        // both reactions
-                        thirdBodyOk = false;
-                        break;
-                    }
-                }
-                if (thirdBodyOk) {
-                    continue; // No overlap in third body efficiencies
-                }
-            } else if (R.type() == "three-body-legacy") {
-                ThirdBody& tb1 = dynamic_cast<ThreeBodyReaction2&>(R).third_body;
-                ThirdBody& tb2 = dynamic_cast<ThreeBodyReaction2&>(other).third_body;
-                bool thirdBodyOk = true;
-                for (size_t k = 0; k < nTotalSpecies(); k++) {
-                    string s = kineticsSpeciesName(k);
-                    if (tb1.efficiency(s) * tb2.efficiency(s) != 0.0) {
-                        // non-zero third body efficiencies for species `s` in
-                        // both reactions
-                        thirdBodyOk = false;
-                        break;
-                    }
-                }
-                if (thirdBodyOk) {
-                    continue; // No overlap in third body efficiencies
-                }
+            }
+            const ThirdBody* tb1 = thirdBody(R);
+            const ThirdBody* tb2 = thirdBody(other);
+            if (tb1 && tb2 && !thirdBodyOverlap(*tb1, *tb2, *this)) {
+                continue; // No overlap in third body efficiencies
             }
             if (throw_err) {
                 throw InputFileError("Kinetics::checkDuplicates",
@@ -215,7 +218,7 @@ std::pair<size_t, size_t> Kinetics::checkDuplicates(bool throw_err) const
                 return {i,m};
             }
         }
-        participants[key].push_back(i);
+        related.push_back(i);
     }
     if (unmatched_duplicates.size()) {
         size_t i = *unmatched_duplicates.begin();
@@ -481,6 +484,40 @@ void Kinetics::getNetProductionRates(doublereal* net)
     m_reactantStoich.decrementSpecies(m_ropnet.data(), net);
 }
 
+void Kinetics::getNetProductionRates(size_t nStates, const double* T,
+                                     const double* P, const double* Y,
+                                     double* wdot)
+{
+    if (nPhases() != 1) {
+        throw NotImplementedError("Kinetics::getNetProductionRates",
+            "Batch evaluation is only supported for kinetics managers "
+            "associated with a single phase.");
+    }
+    ThermoPhase& phase = thermo(0);
+    for (size_t n = 0; n < nStates; n++) {
+        phase.setState_TPY(T[n], P[n], Y + n * m_kk);
+        getNetProductionRates(wdot + n * m_kk);
+    }
+}
+
+void Kinetics::getNetProductionRates_ddT(double* dwdot)
+{
+    vector_fp dropnet(nReactions());
+    getNetRatesOfProgress_ddT(dropnet.data());
+
+    fill(dwdot, dwdot + m_kk, 0.0);
+    m_productStoich.incrementSpecies(dropnet.data(), dwdot);
+    m_reactantStoich.decrementSpecies(dropnet.data(), dwdot);
+}
+
+Eigen::SparseMatrix<double> Kinetics::netProductionRates_ddC()
+{
+    Eigen::SparseMatrix<double> jac = netRatesOfProgress_ddC();
+    Eigen::SparseMatrix<double> stoich = m_productStoich.stoichCoeffs()
+        - m_reactantStoich.stoichCoeffs();
+    return stoich * jac;
+}
+
 void Kinetics::addPhase(ThermoPhase& thermo)
 {
     // the phase with lowest dimensionality is assumed to be the
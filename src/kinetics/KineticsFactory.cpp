@@ -12,12 +12,62 @@
 #include "cantera/kinetics/importKinetics.h"
 #include "cantera/base/xml.h"
 #include "cantera/base/stringUtils.h"
+#include <thread>
 
 using namespace std;
 
 namespace Cantera
 {
 
+namespace {
+
+//! Maximum number of threads used to create reactions, where zero indicates
+//! the number of concurrent threads supported by the hardware
+size_t maxReactionThreads = 0;
+
+//! Minimum number of reactions created by each thread
+const size_t minReactionsPerThread = 100;
+
+//! Create reactions from the definitions `nodes` using multiple threads.
+//! Exceptions raised while creating reaction `j` are stored in `errors[j]`.
+void createReactions(const vector<const AnyMap*>& nodes, const Kinetics& kin,
+                     vector<shared_ptr<Reaction>>& reactions,
+                     vector<exception_ptr>& errors)
+{
+    size_t n = nodes.size();
+    reactions.assign(n, nullptr);
+    errors.assign(n, nullptr);
+    size_t nThreads = maxReactionThreads;
+    if (nThreads == 0) {
+        nThreads = std::max<size_t>(thread::hardware_concurrency(), 1);
+    }
+    nThreads = std::max<size_t>(std::min(nThreads, n / minReactionsPerThread), 1);
+
+    // each thread creates a contiguous block of reactions
+    auto create = [&](size_t t) {
+        for (size_t j = t * n / nThreads; j < (t + 1) * n / nThreads; j++) {
+            try {
+                reactions[j] = newReaction(*nodes[j], kin);
+            } catch (...) {
+                errors[j] = current_exception();
+            }
+        }
+    };
+    vector<thread> threads;
+    for (size_t t = 1; t < nThreads; t++) {
+        threads.emplace_back([&create, t]() {
+            create(t);
+            thread_complete();
+        });
+    }
+    create(0);
+    for (auto& th : threads) {
+        th.join();
+    }
+}
+
+}
+
 KineticsFactory* KineticsFactory::s_factory = 0;
 std::mutex KineticsFactory::kinetics_mutex;
 
@@ -68,6 +118,14 @@ unique_ptr<Kinetics> newKinetics(const vector<ThermoPhase*>& phases,
     }
     kin->init();
     addReactions(*kin, phaseNode, rootNode);
+    if (phaseNode.hasKey("qss-species")) {
+        auto gasKin = dynamic_cast<GasKinetics*>(kin.get());
+        if (!gasKin) {
+            throw InputFileError("newKinetics", phaseNode["qss-species"],
+                "QSS species are only supported by the 'gas' kinetics model.");
+        }
+        gasKin->setQssSpecies(phaseNode["qss-species"].asVector<string>());
+    }
     return kin;
 }
 
@@ -81,8 +139,9 @@ unique_ptr<Kinetics> newKinetics(const std::vector<ThermoPhase*>& phases,
         extension = toLowerCopy(filename.substr(dot+1));
     }
 
-    if (extension == "yml" || extension == "yaml") {
-        AnyMap root = AnyMap::fromYamlFile(filename);
+    if (extension == "yml" || extension == "yaml" || extension == "ctb") {
+        AnyMap root = (extension == "ctb") ? AnyMap::fromBinaryFile(filename)
+                                           : AnyMap::fromYamlFile(filename);
         AnyMap& phaseNode = root["phases"].getMapWhere("name", phase_name);
         return newKinetics(phases, phaseNode, root);
     } else {
@@ -152,13 +211,18 @@ void addReactions(Kinetics& kin, const AnyMap& phaseNode, const AnyMap& rootNode
         }
     }
 
-    // Add reactions from each section
-    fmt::memory_buffer add_rxn_err;
+    // Collect the reaction definitions of all sections, together with the
+    // rule for undeclared species and whether errors are collected
+    vector<AnyMap> files; // sections in different files
+    files.reserve(sections.size());
+    vector<const AnyMap*> nodes;
+    vector<bool> skipUndeclared, collectErrors;
     for (size_t i = 0; i < sections.size(); i++) {
+        bool skip;
         if (rules[i] == "all") {
-            kin.skipUndeclaredSpecies(false);
+            skip = false;
         } else if (rules[i] == "declared-species") {
-            kin.skipUndeclaredSpecies(true);
+            skip = true;
         } else if (rules[i] == "none") {
             continue;
         } else {
@@ -166,34 +230,52 @@ void addReactions(Kinetics& kin, const AnyMap& phaseNode, const AnyMap& rootNode
                 "Unknown rule '{}' for adding species from the '{}' section.",
                 rules[i], sections[i]);
         }
+        const vector<AnyMap>* section;
+        bool collect;
         const auto& slash = boost::ifind_last(sections[i], "/");
         if (slash) {
             // specified section is in a different file
             string fileName (sections[i].begin(), slash.begin());
             string node(slash.end(), sections[i].end());
-            AnyMap reactions = AnyMap::fromYamlFile(fileName,
-                rootNode.getString("__file__", ""));
-            for (const auto& R : reactions[node].asVector<AnyMap>()) {
-                try {
-                    kin.addReaction(newReaction(R, kin), false);
-                } catch (CanteraError& err) {
-                    fmt_append(add_rxn_err, "{}", err.what());
-                }
-            }
+            files.push_back(AnyMap::fromYamlFile(fileName,
+                rootNode.getString("__file__", "")));
+            section = &files.back()[node].asVector<AnyMap>();
+            collect = true;
         } else {
             // specified section is in the current file
-            for (const auto& R : rootNode.at(sections[i]).asVector<AnyMap>()) {
-                #ifdef NDEBUG
-                    try {
-                        kin.addReaction(newReaction(R, kin), false);
-                    } catch (CanteraError& err) {
-                        fmt_append(add_rxn_err, "{}", err.what());
-                    }
-                #else
-                    kin.addReaction(newReaction(R, kin), false);
-                #endif
+            section = &rootNode.at(sections[i]).asVector<AnyMap>();
+            #ifdef NDEBUG
+                collect = true;
+            #else
+                collect = false;
+            #endif
+        }
+        for (const auto& R : *section) {
+            nodes.push_back(&R);
+            skipUndeclared.push_back(skip);
+            collectErrors.push_back(collect);
+        }
+    }
+
+    // Create reaction objects in parallel, and add them in the original order
+    vector<shared_ptr<Reaction>> reactions;
+    vector<exception_ptr> errors;
+    createReactions(nodes, kin, reactions, errors);
+    fmt::memory_buffer add_rxn_err;
+    for (size_t j = 0; j < nodes.size(); j++) {
+        kin.skipUndeclaredSpecies(skipUndeclared[j]);
+        try {
+            if (errors[j]) {
+                rethrow_exception(errors[j]);
+            }
+            kin.addReaction(reactions[j], false);
+        } catch (CanteraError& err) {
+            if (!collectErrors[j]) {
+                throw;
             }
+            fmt_append(add_rxn_err, "{}", err.what());
         }
+        reactions[j].reset();
     }
 
     kin.checkDuplicates();
@@ -204,4 +286,9 @@ void addReactions(Kinetics& kin, const AnyMap& phaseNode, const AnyMap& rootNode
     kin.resizeReactions();
 }
 
+void setReactionThreads(size_t n)
+{
+    maxReactionThreads = n;
+}
+
 }
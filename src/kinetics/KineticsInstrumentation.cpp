@@ -0,0 +1,49 @@
+//! @file KineticsInstrumentation.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/KineticsInstrumentation.h"
+#include "cantera/base/AnyMap.h"
+
+namespace Cantera
+{
+
+size_t KineticsInstrumentation::section(const std::string& name)
+{
+    for (size_t i = 0; i < m_names.size(); i++) {
+        if (m_names[i] == name) {
+            return i;
+        }
+    }
+    m_names.push_back(name);
+    m_calls.push_back(0);
+    m_hits.push_back(0);
+    m_time.push_back(0.0);
+    return m_names.size() - 1;
+}
+
+void KineticsInstrumentation::clear()
+{
+    std::fill(m_calls.begin(), m_calls.end(), 0);
+    std::fill(m_hits.begin(), m_hits.end(), 0);
+    std::fill(m_time.begin(), m_time.end(), 0.0);
+}
+
+AnyMap KineticsInstrumentation::report() const
+{
+    AnyMap out;
+    for (size_t i = 0; i < m_names.size(); i++) {
+        if (m_calls[i] == 0) {
+            continue;
+        }
+        AnyMap entry;
+        entry["calls"] = static_cast<long int>(m_calls[i]);
+        entry["cache-hits"] = static_cast<long int>(m_hits[i]);
+        entry["time"] = m_time[i];
+        out[m_names[i]] = std::move(entry);
+    }
+    return out;
+}
+
+}
@@ -0,0 +1,130 @@
+/**
+ *  @file PlogBatch.cpp
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/PlogBatch.h"
+#include "cantera/kinetics/RxnRates.h"
+#include "cantera/numerics/funcs.h"
+
+namespace Cantera
+{
+
+PlogBatch::PlogBatch() :
+    m_logP(NAN)
+{
+}
+
+void PlogBatch::clear()
+{
+    m_grids.clear();
+    m_bracket.clear();
+    m_weight.clear();
+    m_rxn.clear();
+    m_group.clear();
+    m_ranges.clear();
+    m_A.clear();
+    m_b.clear();
+    m_Ea_R.clear();
+    m_logP = NAN;
+}
+
+void PlogBatch::add(size_t rxn, const PlogRate& rate)
+{
+    vector_fp grid;
+    m_ranges.emplace_back();
+    size_t offset = m_A.size();
+    for (const auto& level : rate.pressures_) {
+        grid.push_back(level.first);
+        m_ranges.back().emplace_back(offset + level.second.first,
+                                     offset + level.second.second);
+    }
+    for (const auto& arrhenius : rate.rates_) {
+        m_A.push_back(arrhenius.preExponentialFactor());
+        m_b.push_back(arrhenius.temperatureExponent());
+        m_Ea_R.push_back(arrhenius.activationEnergy_R());
+    }
+
+    // Reactions with identical pressure grids share bracketing pressures
+    size_t group = std::find(m_grids.begin(), m_grids.end(), grid) - m_grids.begin();
+    if (group == m_grids.size()) {
+        m_grids.push_back(grid);
+        m_bracket.push_back(npos);
+        m_weight.push_back(NAN);
+    }
+    m_rxn.push_back(rxn);
+    m_group.push_back(group);
+    m_logP = NAN;
+}
+
+void PlogBatch::updatePressure(double logP)
+{
+    for (size_t g = 0; g < m_grids.size(); g++) {
+        const vector_fp& grid = m_grids[g];
+        auto iter = std::upper_bound(grid.begin(), grid.end(), logP);
+        AssertThrowMsg(iter != grid.end(), "PlogBatch::updatePressure",
+                       "Pressure out of range: {}", logP);
+        AssertThrowMsg(iter != grid.begin(), "PlogBatch::updatePressure",
+                       "Pressure out of range: {}", logP);
+        size_t j = iter - grid.begin() - 1;
+        m_bracket[g] = j;
+        m_weight[g] = (logP - grid[j]) * (1.0 / (grid[j + 1] - grid[j]));
+    }
+    m_logP = logP;
+}
+
+bool PlogBatch::getRateConstants(const PlogData& data, double* kf)
+{
+    if (data.logP != m_logP) {
+        updatePressure(data.logP);
+    }
+    size_t n = m_rxn.size();
+    double logT = data.logT;
+    double recipT = data.recipT;
+
+    // Exponents of the Arrhenius expressions at the lower and upper bracketing
+    // pressures of all reactions
+    m_work.clear();
+    for (size_t i = 0; i < n; i++) {
+        size_t j = m_bracket[m_group[i]];
+        for (size_t p = j; p < j + 2; p++) {
+            const auto& range = m_ranges[i][p];
+            for (size_t t = range.first; t < range.second; t++) {
+                m_work.push_back(m_b[t] * logT - m_Ea_R[t] * recipT);
+            }
+        }
+    }
+    vectorExp(m_work.data(), m_work.data(), m_work.size());
+
+    m_logk.resize(2 * n);
+    size_t k = 0;
+    for (size_t i = 0; i < n; i++) {
+        size_t j = m_bracket[m_group[i]];
+        for (size_t p = 0; p < 2; p++) {
+            const auto& range = m_ranges[i][j + p];
+            double sum = 1e-300; // non-zero to make log(k) finite
+            for (size_t t = range.first; t < range.second; t++) {
+                sum += m_A[t] * m_work[k++];
+            }
+            m_logk[2 * i + p] = sum;
+        }
+    }
+    vectorLog(m_logk.data(), m_logk.data(), 2 * n);
+
+    // Interpolate log(k) linearly in log(P)
+    m_work.resize(std::max(m_work.size(), n));
+    for (size_t i = 0; i < n; i++) {
+        double log_k1 = m_logk[2 * i];
+        double log_k2 = m_logk[2 * i + 1];
+        m_work[i] = log_k1 + (log_k2 - log_k1) * m_weight[m_group[i]];
+    }
+    vectorExp(m_work.data(), m_work.data(), n);
+    for (size_t i = 0; i < n; i++) {
+        kf[m_rxn[i]] = m_work[i];
+    }
+    return true;
+}
+
+}
@@ -0,0 +1,146 @@
+/**
+ *  @file RateTable.cpp
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/RateTable.h"
+#include "cantera/base/ctexceptions.h"
+#include "cantera/numerics/funcs.h"
+
+namespace Cantera
+{
+
+RateTable::RateTable() :
+    m_Tmin(0.0),
+    m_Tmax(0.0),
+    m_xmin(0.0),
+    m_dx(0.0),
+    m_nValues(0),
+    m_nPoints(0),
+    m_maxError(0.0)
+{
+}
+
+void RateTable::build(double Tmin, double Tmax, size_t nValues,
+                      const Evaluator& eval, double rtol, size_t maxPoints)
+{
+    if (Tmin <= 0 || Tmax <= Tmin) {
+        throw CanteraError("RateTable::build",
+            "Invalid temperature range [{}, {}].", Tmin, Tmax);
+    }
+    clear();
+    m_Tmin = Tmin;
+    m_Tmax = Tmax;
+    m_xmin = 1.0 / Tmax;
+    m_nValues = nValues;
+
+    // The ghost points beyond Tmax have to correspond to positive temperatures
+    size_t nPoints = 65;
+    while (2 * (1.0 / Tmin - m_xmin) / (nPoints - 1) > 0.5 * m_xmin) {
+        nPoints = 2 * nPoints - 1;
+    }
+    while (true) {
+        if (nPoints > maxPoints) {
+            size_t n = m_nPoints;
+            double err = m_maxError;
+            clear();
+            throw CanteraError("RateTable::build",
+                "Relative tolerance {} not reached with {} grid points; "
+                "maximum relative error is {}.", rtol, n, err);
+        }
+        m_nPoints = nPoints;
+        m_dx = (1.0 / Tmin - m_xmin) / (nPoints - 1);
+        fill(eval);
+        m_maxError = midpointError(eval);
+        if (m_maxError <= rtol) {
+            break;
+        }
+        nPoints = 2 * nPoints - 1;
+    }
+}
+
+void RateTable::clear()
+{
+    m_nPoints = 0;
+    m_maxError = 0.0;
+    m_data.clear();
+}
+
+void RateTable::fill(const Evaluator& eval)
+{
+    // Evaluate logarithms including two ghost points at each end of the grid
+    size_t n = m_nValues;
+    vector_fp raw((m_nPoints + 4) * n);
+    for (size_t j = 0; j < m_nPoints + 4; j++) {
+        double x = m_xmin + (j - 2.0) * m_dx;
+        eval(1.0 / x, &raw[j * n]);
+    }
+
+    // Store values and slopes (scaled by the grid spacing) for each grid
+    // point, where slopes are obtained from fourth-order central differences
+    m_data.resize(2 * m_nPoints * n);
+    for (size_t j = 0; j < m_nPoints; j++) {
+        const double* fm2 = &raw[j * n];
+        const double* fm1 = fm2 + n;
+        const double* f = fm1 + n;
+        const double* fp1 = f + n;
+        const double* fp2 = fp1 + n;
+        double* row = &m_data[2 * j * n];
+        for (size_t k = 0; k < n; k++) {
+            row[k] = f[k];
+            row[n + k] = (8.0 * (fp1[k] - fm1[k]) - fp2[k] + fm2[k]) / 12.0;
+        }
+    }
+}
+
+double RateTable::midpointError(const Evaluator& eval)
+{
+    vector_fp ref(m_nValues), interp(m_nValues);
+    double maxError = 0.0;
+    for (size_t j = 0; j < m_nPoints - 1; j++) {
+        double T = 1.0 / (m_xmin + (j + 0.5) * m_dx);
+        eval(T, ref.data());
+        interpolateLog(T, interp.data());
+        for (size_t n = 0; n < m_nValues; n++) {
+            // the error of the logarithm is the relative error of the value
+            maxError = std::max(maxError, std::abs(interp[n] - ref[n]));
+        }
+    }
+    return maxError;
+}
+
+void RateTable::interpolate(double T, double* values) const
+{
+    interpolateLog(T, values);
+    vectorExp(values, values, m_nValues);
+}
+
+void RateTable::interpolateLog(double T, double* values) const
+{
+    double s = (1.0 / T - m_xmin) / m_dx;
+    size_t i = static_cast<size_t>(std::max(s, 0.0));
+    i = std::min(i, m_nPoints - 2);
+    double t = s - i;
+    double t2 = t * t;
+    double t3 = t2 * t;
+
+    // Cubic Hermite basis functions
+    double h00 = 2 * t3 - 3 * t2 + 1;
+    double h10 = t3 - 2 * t2 + t;
+    double h01 = -2 * t3 + 3 * t2;
+    double h11 = t3 - t2;
+
+    // values and slopes at grid points i and i+1 are stored contiguously
+    size_t n = m_nValues;
+    const double* f0 = &m_data[2 * i * n];
+    const double* d0 = f0 + n;
+    const double* f1 = d0 + n;
+    const double* d1 = f1 + n;
+    for (size_t k = 0; k < n; k++) {
+        values[k] = h00 * f0[k] + h10 * d0[k] + h01 * f1[k] + h11 * d1[k];
+    }
+}
+
+}
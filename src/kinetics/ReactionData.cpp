@@ -20,6 +20,26 @@ std::pair<bool, bool> ArrheniusData::update(const ThermoPhase& bulk,
     return changed;
 }
 
+void ArrheniusData::perturbTemperature(double deltaT)
+{
+    if (m_temperature_buf > 0.) {
+        throw CanteraError("ArrheniusData::perturbTemperature",
+            "Cannot apply another perturbation as state is already perturbed.");
+    }
+    m_temperature_buf = temperature;
+    update(temperature * (1. + deltaT));
+}
+
+void ArrheniusData::restore()
+{
+    // only restore if there is a valid buffered value
+    if (m_temperature_buf < 0.) {
+        return;
+    }
+    update(m_temperature_buf);
+    m_temperature_buf = -1.;
+}
+
 void BlowersMaselData::update(double T)
 {
     temperature = T;
@@ -34,6 +54,7 @@ BlowersMaselData::BlowersMaselData()
     , density(NAN)
     , state_mf_number(-1)
     , finalized(false)
+    , m_temperature_buf(-1.)
 {
 }
 
@@ -55,12 +76,34 @@ std::pair<bool, bool> BlowersMaselData::update(const ThermoPhase& bulk,
     return changed;
 }
 
+void BlowersMaselData::perturbTemperature(double deltaT)
+{
+    if (m_temperature_buf > 0.) {
+        throw CanteraError("BlowersMaselData::perturbTemperature",
+            "Cannot apply another perturbation as state is already perturbed.");
+    }
+    m_temperature_buf = temperature;
+    update(temperature * (1. + deltaT));
+}
+
+void BlowersMaselData::restore()
+{
+    // only restore if there is a valid buffered value
+    if (m_temperature_buf < 0.) {
+        return;
+    }
+    update(m_temperature_buf);
+    m_temperature_buf = -1.;
+}
+
 std::pair<bool, bool> FalloffData::update(const ThermoPhase& bulk, const Kinetics& kin)
 {
     double rho_m = bulk.molarDensity();
     int mf = bulk.stateMFNumber();
     double T = bulk.temperature();
-    std::pair<bool, bool> changed { false, T != temperature };
+    // falloff rates cache low- and high-pressure limits, which need to be
+    // updated whenever the temperature changes
+    std::pair<bool, bool> changed { T != temperature, T != temperature };
     if (rho_m != molar_density || mf != state_mf_number) {
         molar_density = rho_m;
         state_mf_number = mf;
@@ -71,6 +114,30 @@ std::pair<bool, bool> FalloffData::update(const ThermoPhase& bulk, const Kinetic
     return changed;
 }
 
+void FalloffData::perturbThirdBodies(double deltaM)
+{
+    if (m_perturbed) {
+        throw CanteraError("FalloffData::perturbThirdBodies",
+            "Cannot apply another perturbation as state is already perturbed.");
+    }
+    m_conc_3b_buf = conc_3b;
+    for (auto& c3b : conc_3b) {
+        c3b *= 1. + deltaM;
+    }
+    m_perturbed = true;
+}
+
+void FalloffData::restore()
+{
+    ArrheniusData::restore();
+    // only restore if there is a valid buffered value
+    if (!m_perturbed) {
+        return;
+    }
+    conc_3b = m_conc_3b_buf;
+    m_perturbed = false;
+}
+
 void PlogData::update(double T)
 {
     throw CanteraError("PlogData::update",
@@ -86,6 +153,39 @@ std::pair<bool, bool> PlogData::update(const ThermoPhase& bulk, const Kinetics&
     return changed;
 }
 
+void PlogData::perturbTemperature(double deltaT)
+{
+    if (m_temperature_buf > 0. || m_pressure_buf > 0.) {
+        throw CanteraError("PlogData::perturbTemperature",
+            "Cannot apply another perturbation as state is already perturbed.");
+    }
+    m_temperature_buf = temperature;
+    update(temperature * (1. + deltaT), pressure);
+}
+
+void PlogData::perturbPressure(double deltaP)
+{
+    if (m_temperature_buf > 0. || m_pressure_buf > 0.) {
+        throw CanteraError("PlogData::perturbPressure",
+            "Cannot apply another perturbation as state is already perturbed.");
+    }
+    m_pressure_buf = pressure;
+    update(temperature, pressure * (1. + deltaP));
+}
+
+void PlogData::restore()
+{
+    // only restore if there is a valid buffered value
+    if (m_temperature_buf > 0.) {
+        update(m_temperature_buf, pressure);
+        m_temperature_buf = -1.;
+    }
+    if (m_pressure_buf > 0.) {
+        update(temperature, m_pressure_buf);
+        m_pressure_buf = -1.;
+    }
+}
+
 void ChebyshevData::update(double T)
 {
     throw CanteraError("ChebyshevData::update",
@@ -101,6 +201,39 @@ std::pair<bool, bool> ChebyshevData::update(const ThermoPhase& bulk, const Kinet
     return changed;
 }
 
+void ChebyshevData::perturbTemperature(double deltaT)
+{
+    if (m_temperature_buf > 0. || m_pressure_buf > 0.) {
+        throw CanteraError("ChebyshevData::perturbTemperature",
+            "Cannot apply another perturbation as state is already perturbed.");
+    }
+    m_temperature_buf = temperature;
+    update(temperature * (1. + deltaT), pressure);
+}
+
+void ChebyshevData::perturbPressure(double deltaP)
+{
+    if (m_temperature_buf > 0. || m_pressure_buf > 0.) {
+        throw CanteraError("ChebyshevData::perturbPressure",
+            "Cannot apply another perturbation as state is already perturbed.");
+    }
+    m_pressure_buf = pressure;
+    update(temperature, pressure * (1. + deltaP));
+}
+
+void ChebyshevData::restore()
+{
+    // only restore if there is a valid buffered value
+    if (m_temperature_buf > 0.) {
+        update(m_temperature_buf, pressure);
+        m_temperature_buf = -1.;
+    }
+    if (m_pressure_buf > 0.) {
+        update(temperature, m_pressure_buf);
+        m_pressure_buf = -1.;
+    }
+}
+
 std::pair<bool, bool> CustomFunc1Data::update(const ThermoPhase& bulk, const Kinetics& kin)
 {
     double T = bulk.temperature();
@@ -109,4 +242,24 @@ std::pair<bool, bool> CustomFunc1Data::update(const ThermoPhase& bulk, const Kin
     return changed;
 }
 
+void CustomFunc1Data::perturbTemperature(double deltaT)
+{
+    if (m_temperature_buf > 0.) {
+        throw CanteraError("CustomFunc1Data::perturbTemperature",
+            "Cannot apply another perturbation as state is already perturbed.");
+    }
+    m_temperature_buf = temperature;
+    update(temperature * (1. + deltaT));
+}
+
+void CustomFunc1Data::restore()
+{
+    // only restore if there is a valid buffered value
+    if (m_temperature_buf < 0.) {
+        return;
+    }
+    update(m_temperature_buf);
+    m_temperature_buf = -1.;
+}
+
 }
@@ -11,6 +11,7 @@
 #include "cantera/thermo/ThermoPhase.h"
 
 #include <boost/algorithm/string.hpp>
+#include <sstream>
 
 namespace ba = boost::algorithm;
 
@@ -694,6 +695,16 @@ string reactionLabel(size_t i, size_t kr, size_t nr,
 
 int ReactionPathBuilder::build(Kinetics& s, const string& element,
                                ostream& output, ReactionPathDiagram& r, bool quiet)
+{
+    s.getFwdRatesOfProgress(m_ropf.data());
+    s.getRevRatesOfProgress(m_ropr.data());
+    return build(s, element, output, r, m_ropf.data(), m_ropr.data(), quiet);
+}
+
+int ReactionPathBuilder::build(Kinetics& s, const string& element,
+                               ostream& output, ReactionPathDiagram& r,
+                               const double* fwdRates, const double* revRates,
+                               bool quiet)
 {
     map<size_t, int> warn;
     doublereal threshold = 0.0;
@@ -703,9 +714,6 @@ int ReactionPathBuilder::build(Kinetics& s, const string& element,
         return -1;
     }
 
-    s.getFwdRatesOfProgress(m_ropf.data());
-    s.getRevRatesOfProgress(m_ropr.data());
-
     // species explicitly included or excluded
     vector<string>& in_nodes = r.included();
     vector<string>& out_nodes = r.excluded();
@@ -719,8 +727,8 @@ int ReactionPathBuilder::build(Kinetics& s, const string& element,
     }
 
     for (size_t i = 0; i < m_nr; i++) {
-        double ropf = m_ropf[i];
-        double ropr = m_ropr[i];
+        double ropf = fwdRates[i];
+        double ropr = revRates[i];
 
         // loop over reactions involving element m
         if (m_elatoms(m, i) > 0) {
@@ -817,4 +825,99 @@ int ReactionPathBuilder::build(Kinetics& s, const string& element,
     return 1;
 }
 
+ReactionPathAccumulator::ReactionPathAccumulator(Kinetics& kin)
+    : m_kin(&kin)
+    , m_weight(0.0)
+{
+    std::stringstream log;
+    m_builder.init(log, kin);
+    size_t nr = kin.nReactions();
+    m_fwd.assign(nr, 0.0);
+    m_rev.assign(nr, 0.0);
+    m_ropf.resize(nr);
+    m_ropr.resize(nr);
+    m_ropf0.resize(nr);
+    m_ropr0.resize(nr);
+}
+
+void ReactionPathAccumulator::clear()
+{
+    std::fill(m_fwd.begin(), m_fwd.end(), 0.0);
+    std::fill(m_rev.begin(), m_rev.end(), 0.0);
+    m_weight = 0.0;
+}
+
+void ReactionPathAccumulator::addSample(double weight)
+{
+    m_kin->getFwdRatesOfProgress(m_ropf.data());
+    m_kin->getRevRatesOfProgress(m_ropr.data());
+    for (size_t i = 0; i < m_fwd.size(); i++) {
+        m_fwd[i] += weight * m_ropf[i];
+        m_rev[i] += weight * m_ropr[i];
+    }
+    m_weight += weight;
+}
+
+void ReactionPathAccumulator::startIntegration()
+{
+    m_kin->getFwdRatesOfProgress(m_ropf0.data());
+    m_kin->getRevRatesOfProgress(m_ropr0.data());
+}
+
+void ReactionPathAccumulator::addInterval(double dx)
+{
+    m_kin->getFwdRatesOfProgress(m_ropf.data());
+    m_kin->getRevRatesOfProgress(m_ropr.data());
+    for (size_t i = 0; i < m_fwd.size(); i++) {
+        m_fwd[i] += 0.5 * dx * (m_ropf0[i] + m_ropf[i]);
+        m_rev[i] += 0.5 * dx * (m_ropr0[i] + m_ropr[i]);
+    }
+    m_weight += dx;
+    std::swap(m_ropf0, m_ropf);
+    std::swap(m_ropr0, m_ropr);
+}
+
+void ReactionPathAccumulator::syncState(const ThermoPhase& phase)
+{
+    ThermoPhase& thermo = m_kin->thermo();
+    if (&phase == &thermo) {
+        return;
+    } else if (phase.nSpecies() != thermo.nSpecies()) {
+        throw CanteraError("ReactionPathAccumulator::syncState",
+            "Phase has {} species, but the kinetics manager has {}.",
+            phase.nSpecies(), thermo.nSpecies());
+    }
+    thermo.setState_TPY(phase.temperature(), phase.pressure(),
+                        phase.massFractions());
+}
+
+int ReactionPathAccumulator::build(const std::string& element,
+                                   std::ostream& output,
+                                   ReactionPathDiagram& r, bool quiet)
+{
+    return m_builder.build(*m_kin, element, output, r, m_fwd.data(),
+                           m_rev.data(), quiet);
+}
+
+Eigen::SparseMatrix<double> ReactionPathAccumulator::fluxMatrix(
+    const std::string& element)
+{
+    ReactionPathDiagram diagram;
+    std::stringstream log;
+    if (build(element, log, diagram, true) < 0) {
+        throw CanteraError("ReactionPathAccumulator::fluxMatrix",
+                           "Unknown element '{}'", element);
+    }
+    SparseTriplets trips;
+    for (size_t n = 0; n < diagram.nPaths(); n++) {
+        Path* path = diagram.path(n);
+        trips.emplace_back(static_cast<int>(path->begin()->number),
+                           static_cast<int>(path->end()->number), path->flow());
+    }
+    size_t nsp = m_kin->nTotalSpecies();
+    Eigen::SparseMatrix<double> flux(nsp, nsp);
+    flux.setFromTriplets(trips.begin(), trips.end());
+    return flux;
+}
+
 }
@@ -215,6 +215,23 @@ void PlogRate::setRates(const std::multimap<double, Arrhenius>& rates)
     pressures_.insert({1000.0, pressures_.rbegin()->second});
 }
 
+double PlogRate::ddPScaled(double logT, double recipT) const
+{
+    auto logRate = [&](size_t i1, size_t i2) {
+        if (i1 == i2) {
+            return rates_[i1].updateLog(logT, recipT);
+        }
+        double k = 1e-300; // non-zero to make log(k) finite
+        for (size_t i = i1; i < i2; i++) {
+            k += rates_[i].updateRC(logT, recipT);
+        }
+        return std::log(k);
+    };
+    // rate expressions at the bounding pressures are repeated beyond the
+    // pressure range, which yields a vanishing derivative
+    return (logRate(ihigh1_, ihigh2_) - logRate(ilow1_, ilow2_)) * rDeltaP_;
+}
+
 void PlogRate::validate(const std::string& equation)
 {
     fmt::memory_buffer err_reactions;
@@ -351,6 +368,35 @@ void ChebyshevRate3::setData(const Array2D& coeffs)
     }
 }
 
+double ChebyshevRate3::ddPScaled(double logT, double recipT) const
+{
+    // log10(k) = sum_t T_t(Tr) sum_p alpha_tp T_p(Pr), where derivatives of the
+    // pressure polynomials are d T_p(x) / dx = p U_{p-1}(x)
+    double Tr = (2 * recipT + TrNum_) * TrDen_;
+    double Cnm1 = Tr;
+    double Cn = 1;
+    double dlogk_dPr = 0;
+    for (size_t i = 0; i < m_coeffs.nRows(); i++) {
+        if (i) {
+            double Cnp1 = 2 * Tr * Cn - Cnm1;
+            Cnm1 = Cn;
+            Cn = Cnp1;
+        }
+        double Unm1 = 0;
+        double Un = 1;
+        double dsum = 0;
+        for (size_t j = 1; j < m_coeffs.nColumns(); j++) {
+            dsum += j * Un * m_coeffs(i, j);
+            double Unp1 = 2 * Pr_ * Un - Unm1;
+            Unm1 = Un;
+            Un = Unp1;
+        }
+        dlogk_dPr += Cn * dsum;
+    }
+    // dPr/d(log10 P) = 2 PrDen; d ln(k) / d ln(P) = d log10(k) / d log10(P)
+    return 2 * dlogk_dPr * PrDen_;
+}
+
 void ChebyshevRate3::getParameters(AnyMap& rateNode) const
 {
     rateNode["type"] = type();
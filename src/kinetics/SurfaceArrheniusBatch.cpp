@@ -0,0 +1,157 @@
+/**
+ *  @file SurfaceArrheniusBatch.cpp
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/SurfaceArrheniusBatch.h"
+#include "cantera/numerics/funcs.h"
+
+namespace Cantera
+{
+
+SurfaceArrheniusBatch::SurfaceArrheniusBatch() :
+    m_packed(false)
+{
+}
+
+void SurfaceArrheniusBatch::install(size_t rxnNumber, const SurfaceArrhenius& rate)
+{
+    m_rxn.push_back(rxnNumber);
+    m_rates.push_back(rate);
+    m_indices[rxnNumber] = m_rxn.size() - 1;
+    m_packed = false;
+}
+
+void SurfaceArrheniusBatch::replace(size_t rxnNumber, const SurfaceArrhenius& rate)
+{
+    m_rates[m_indices.at(rxnNumber)] = rate;
+    m_packed = false;
+}
+
+void SurfaceArrheniusBatch::pack()
+{
+    size_t n = m_rates.size();
+    m_A.resize(n);
+    m_b.resize(n);
+    m_E.resize(n);
+    m_covStart.assign(1, 0);
+    m_covSpecies.clear();
+    m_covA.clear();
+    m_covE.clear();
+    m_mStart.assign(1, 0);
+    m_mSpecies.clear();
+    m_mCoeff.clear();
+    m_logSpecies.clear();
+    size_t nsp = 0;
+    for (size_t i = 0; i < n; i++) {
+        const auto& rate = m_rates[i];
+        m_A[i] = rate.m_A;
+        m_b[i] = rate.m_b;
+        m_E[i] = rate.m_E;
+        for (size_t j = 0; j < rate.m_sp.size(); j++) {
+            m_covSpecies.push_back(rate.m_sp[j]);
+            m_covA.push_back(rate.m_ac[j]);
+            m_covE.push_back(rate.m_ec[j]);
+            nsp = std::max(nsp, rate.m_sp[j] + 1);
+        }
+        for (size_t j = 0; j < rate.m_msp.size(); j++) {
+            m_mSpecies.push_back(rate.m_msp[j]);
+            m_mCoeff.push_back(rate.m_mc[j]);
+            m_logSpecies.push_back(rate.m_msp[j]);
+        }
+        m_covStart.push_back(m_covSpecies.size());
+        m_mStart.push_back(m_mSpecies.size());
+    }
+    std::sort(m_logSpecies.begin(), m_logSpecies.end());
+    m_logSpecies.erase(std::unique(m_logSpecies.begin(), m_logSpecies.end()),
+                       m_logSpecies.end());
+    if (!m_logSpecies.empty()) {
+        nsp = std::max(nsp, m_logSpecies.back() + 1);
+    }
+    m_logTheta.assign(nsp, 0.0);
+
+    // Retain the current coverage corrections
+    m_acov.resize(n);
+    m_ecov.resize(n);
+    m_mcov.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        m_acov[i] = m_rates[i].m_acov;
+        m_ecov[i] = m_rates[i].m_ecov;
+        m_mcov[i] = m_rates[i].m_mcov;
+    }
+    m_logk.resize(n);
+    m_k.resize(n);
+    m_packed = true;
+}
+
+void SurfaceArrheniusBatch::update_C(const double* theta)
+{
+    if (!m_packed) {
+        pack();
+    }
+    for (size_t k : m_logSpecies) {
+        m_logTheta[k] = std::log(std::max(theta[k], Tiny));
+    }
+    size_t n = m_rxn.size();
+    for (size_t i = 0; i < n; i++) {
+        double acov = 0.0;
+        double ecov = 0.0;
+        for (size_t j = m_covStart[i]; j < m_covStart[i+1]; j++) {
+            double th = theta[m_covSpecies[j]];
+            acov += m_covA[j] * th;
+            ecov += m_covE[j] * th;
+        }
+        double mcov = 0.0;
+        for (size_t j = m_mStart[i]; j < m_mStart[i+1]; j++) {
+            mcov += m_mCoeff[j] * m_logTheta[m_mSpecies[j]];
+        }
+        m_acov[i] = acov;
+        m_ecov[i] = ecov;
+        m_mcov[i] = mcov;
+    }
+}
+
+void SurfaceArrheniusBatch::update(double T, double logT, double* values)
+{
+    if (!m_packed) {
+        pack();
+    }
+    double recipT = 1.0 / T;
+    size_t n = m_rxn.size();
+    const double ln10 = std::log(10.0);
+    for (size_t i = 0; i < n; i++) {
+        m_logk[i] = ln10 * m_acov[i] + m_b[i] * logT
+                    - (m_E[i] + m_ecov[i]) * recipT + m_mcov[i];
+    }
+    vectorExp(m_logk.data(), m_k.data(), n);
+    for (size_t i = 0; i < n; i++) {
+        values[m_rxn[i]] = m_A[i] * m_k[i];
+    }
+}
+
+double SurfaceArrheniusBatch::effectivePreExponentialFactor(size_t irxn)
+{
+    if (!m_packed) {
+        pack();
+    }
+    size_t i = m_indices.at(irxn);
+    return m_A[i] * std::exp(std::log(10.0) * m_acov[i] + m_mcov[i]);
+}
+
+double SurfaceArrheniusBatch::effectiveActivationEnergy_R(size_t irxn)
+{
+    if (!m_packed) {
+        pack();
+    }
+    size_t i = m_indices.at(irxn);
+    return m_E[i] + m_ecov[i];
+}
+
+double SurfaceArrheniusBatch::effectiveTemperatureExponent(size_t irxn)
+{
+    return m_rates[m_indices.at(irxn)].temperatureExponent();
+}
+
+}
@@ -0,0 +1,311 @@
+//! @file UncertaintyEnsemble.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/UncertaintyEnsemble.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/base/Solution.h"
+#include "cantera/base/YamlWriter.h"
+#include "cantera/base/global.h"
+#include <atomic>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <thread>
+
+using namespace std;
+
+namespace Cantera
+{
+
+//! Objects used by one worker thread
+struct UncertaintyEnsemble::Worker
+{
+    shared_ptr<Solution> sol; //!< Copy of the original Solution
+    unique_ptr<EnsembleCase> calc; //!< Calculation run for each sample
+    mutex queueMutex; //!< Protects `queue`
+    deque<size_t> queue; //!< Samples not yet run
+};
+
+UncertaintyEnsemble::UncertaintyEnsemble(
+        shared_ptr<Solution> sol,
+        function<unique_ptr<EnsembleCase>()> newCase)
+    : m_sol(sol)
+    , m_newCase(newCase)
+    , m_logNormal(false)
+    , m_nSigma(2.0)
+    , m_seed(0)
+    , m_nThreads(0)
+    , m_writeMultipliers(false)
+    , m_nFailed(0)
+{
+    if (!sol || !sol->thermo() || !sol->kinetics()) {
+        throw CanteraError("UncertaintyEnsemble::UncertaintyEnsemble",
+            "The Solution must have thermo and kinetics managers.");
+    }
+    if (sol->kinetics()->nPhases() != 1) {
+        throw NotImplementedError("UncertaintyEnsemble::UncertaintyEnsemble",
+            "Solution objects with adjacent phases are not supported.");
+    }
+    m_factors.assign(sol->kinetics()->nReactions(), 1.0);
+}
+
+UncertaintyEnsemble::~UncertaintyEnsemble()
+{
+}
+
+void UncertaintyEnsemble::setUncertaintyFactors(const vector_fp& factors)
+{
+    if (factors.size() != m_factors.size()) {
+        throw CanteraError("UncertaintyEnsemble::setUncertaintyFactors",
+            "Got {} factors for {} reactions.", factors.size(),
+            m_factors.size());
+    }
+    for (size_t i = 0; i < factors.size(); i++) {
+        setUncertaintyFactor(i, factors[i]);
+    }
+}
+
+void UncertaintyEnsemble::setUncertaintyFactor(size_t i, double factor)
+{
+    if (i >= m_factors.size()) {
+        throw IndexError("UncertaintyEnsemble::setUncertaintyFactor",
+                         "factors", i, m_factors.size() - 1);
+    }
+    if (!(factor >= 1.0)) {
+        throw CanteraError("UncertaintyEnsemble::setUncertaintyFactor",
+            "Uncertainty factor of reaction {} must be at least 1; got {}.",
+            i, factor);
+    }
+    m_factors[i] = factor;
+}
+
+void UncertaintyEnsemble::setDistribution(const string& dist, double nSigma)
+{
+    if (dist == "log-uniform") {
+        m_logNormal = false;
+    } else if (dist == "log-normal") {
+        if (nSigma <= 0.0) {
+            throw CanteraError("UncertaintyEnsemble::setDistribution",
+                "Number of standard deviations must be positive; got {}.",
+                nSigma);
+        }
+        m_logNormal = true;
+        m_nSigma = nSigma;
+    } else {
+        throw CanteraError("UncertaintyEnsemble::setDistribution",
+            "Unknown distribution '{}'.", dist);
+    }
+}
+
+void UncertaintyEnsemble::setThreads(size_t n)
+{
+    if (n != m_nThreads) {
+        m_nThreads = n;
+        m_workers.clear();
+    }
+}
+
+void UncertaintyEnsemble::setOutputFile(const string& filename,
+                                        bool includeMultipliers)
+{
+    m_filename = filename;
+    m_writeMultipliers = includeMultipliers;
+}
+
+void UncertaintyEnsemble::sampleMultipliers(size_t sample, double* mult) const
+{
+    // Seed a separate generator for each sample, such that samples do not
+    // depend on the order in which they are generated
+    uint64_t seed = m_seed;
+    uint64_t index = sample;
+    seed_seq seq{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32),
+                 static_cast<uint32_t>(index), static_cast<uint32_t>(index >> 32)};
+    mt19937_64 gen(seq);
+    uniform_real_distribution<double> uniform(-1.0, 1.0);
+    normal_distribution<double> normal(0.0, 1.0 / m_nSigma);
+    for (size_t i = 0; i < m_factors.size(); i++) {
+        // draw a value for every reaction, such that changing the factor of
+        // one reaction does not change the multipliers of other reactions
+        double x = m_logNormal ? normal(gen) : uniform(gen);
+        mult[i] = exp(x * log(m_factors[i]));
+    }
+}
+
+void UncertaintyEnsemble::setupWorkers()
+{
+    size_t nThreads = m_nThreads;
+    if (nThreads == 0) {
+        nThreads = std::max<size_t>(thread::hardware_concurrency(), 1);
+    }
+
+    // Serialize the Solution once and create a copy for each worker
+    YamlWriter writer;
+    writer.setPrecision(17);
+    writer.addPhase(m_sol);
+    AnyMap root = AnyMap::fromYamlString(writer.toYamlString());
+    AnyMap& phaseNode = root["phases"].getMapWhere("name", m_sol->name());
+
+    vector<unique_ptr<Worker>> workers;
+    vector<string> outputNames;
+    for (size_t w = 0; w < nThreads; w++) {
+        unique_ptr<Worker> worker(new Worker());
+        worker->sol = newSolution(phaseNode, root);
+        worker->calc = m_newCase();
+        if (w == 0) {
+            outputNames = worker->calc->outputNames();
+        } else if (worker->calc->outputNames() != outputNames) {
+            throw CanteraError("UncertaintyEnsemble::setupWorkers",
+                "Calculations of different workers have different outputs.");
+        }
+        worker->calc->setup(worker->sol);
+        workers.push_back(std::move(worker));
+    }
+    m_workers = std::move(workers);
+    m_outputNames = outputNames;
+}
+
+bool UncertaintyEnsemble::nextSample(size_t w, size_t& sample)
+{
+    size_t nWorkers = m_workers.size();
+    for (size_t n = 0; n < nWorkers; n++) {
+        Worker& worker = *m_workers[(w + n) % nWorkers];
+        lock_guard<mutex> lock(worker.queueMutex);
+        if (worker.queue.empty()) {
+            continue;
+        } else if (n == 0) {
+            sample = worker.queue.front();
+            worker.queue.pop_front();
+        } else {
+            // take samples from the back of the queue of another worker
+            sample = worker.queue.back();
+            worker.queue.pop_back();
+        }
+        return true;
+    }
+    return false;
+}
+
+void UncertaintyEnsemble::run(size_t nSamples)
+{
+    size_t nReactions = m_sol->kinetics()->nReactions();
+    if (nReactions != m_factors.size()) {
+        throw CanteraError("UncertaintyEnsemble::run", "Number of reactions "
+            "changed from {} to {}.", m_factors.size(), nReactions);
+    }
+    if (m_workers.empty()) {
+        setupWorkers();
+    }
+    size_t nOutputs = m_outputNames.size();
+
+    // Nominal state and multipliers of all samples
+    vector_fp state;
+    m_sol->thermo()->saveState(state);
+    vector_fp nominal(nReactions);
+    for (size_t i = 0; i < nReactions; i++) {
+        nominal[i] = m_sol->kinetics()->multiplier(i);
+    }
+
+    ofstream out;
+    if (!m_filename.empty()) {
+        out.open(m_filename);
+        if (!out) {
+            throw CanteraError("UncertaintyEnsemble::run",
+                "Could not open file '{}' for writing.", m_filename);
+        }
+        out << "sample";
+        for (const auto& name : m_outputNames) {
+            out << "," << name;
+        }
+        if (m_writeMultipliers) {
+            for (size_t i = 0; i < nReactions; i++) {
+                out << ",multiplier-" << i;
+            }
+        }
+        out << "\n";
+    }
+
+    m_results.resize(nSamples, nOutputs, NAN);
+    m_nFailed = 0;
+    size_t nWorkers = m_workers.size();
+    for (size_t w = 0; w < nWorkers; w++) {
+        auto& queue = m_workers[w]->queue;
+        queue.clear();
+        for (size_t n = w * nSamples / nWorkers;
+             n < (w + 1) * nSamples / nWorkers; n++) {
+            queue.push_back(n);
+        }
+    }
+
+    mutex resultsMutex; // protects the results, output file and `error`
+    atomic<bool> abort(false);
+    exception_ptr error;
+    auto work = [&](size_t w) {
+        Worker& worker = *m_workers[w];
+        Kinetics& kin = *worker.sol->kinetics();
+        vector_fp mult(nReactions), outputs(nOutputs);
+        size_t n;
+        while (!abort && nextSample(w, n)) {
+            try {
+                sampleMultipliers(n, mult.data());
+                for (size_t i = 0; i < nReactions; i++) {
+                    kin.setMultiplier(i, nominal[i] * mult[i]);
+                }
+                worker.sol->thermo()->restoreState(state);
+                bool ok = true;
+                try {
+                    worker.calc->run(outputs.data());
+                } catch (CanteraError&) {
+                    ok = false;
+                    std::fill(outputs.begin(), outputs.end(), NAN);
+                }
+
+                lock_guard<mutex> lock(resultsMutex);
+                if (!ok) {
+                    m_nFailed++;
+                }
+                for (size_t j = 0; j < nOutputs; j++) {
+                    m_results(n, j) = outputs[j];
+                }
+                if (out.is_open()) {
+                    string row = fmt::format("{}", n);
+                    for (double v : outputs) {
+                        row += fmt::format(",{}", v);
+                    }
+                    if (m_writeMultipliers) {
+                        for (double m : mult) {
+                            row += fmt::format(",{}", m);
+                        }
+                    }
+                    out << row << "\n";
+                }
+            } catch (...) {
+                lock_guard<mutex> lock(resultsMutex);
+                if (!error) {
+                    error = current_exception();
+                }
+                abort = true;
+            }
+        }
+    };
+
+    vector<thread> threads;
+    for (size_t w = 1; w < nWorkers; w++) {
+        threads.emplace_back([&work, w]() {
+            work(w);
+            thread_complete();
+        });
+    }
+    work(0);
+    for (auto& th : threads) {
+        th.join();
+    }
+    if (error) {
+        rethrow_exception(error);
+    }
+}
+
+}
@@ -33,6 +33,8 @@ solveSP::solveSP(ImplicitSurfChem* surfChemPtr, int bulkFunc) :
     m_rtol(1.0E-4),
     m_maxstep(1000),
     m_maxTotSpecies(0),
+    m_linearSolverType("auto"),
+    m_sparse(false),
     m_ioflag(0)
 {
     m_numSurfPhases = 0;
@@ -99,6 +101,25 @@ solveSP::solveSP(ImplicitSurfChem* surfChemPtr, int bulkFunc) :
         }
     }
 
+    // Equations corresponding to the kinetic species of each kinetics object
+    m_kinSpecEqn.resize(m_numSurfPhases);
+    for (size_t isp = 0; isp < m_numSurfPhases; isp++) {
+        InterfaceKinetics* kin = m_objects[m_indexKinObjSurfPhase[isp]];
+        m_kinSpecEqn[isp].assign(kin->nTotalSpecies(), npos);
+        for (size_t iph = 0; iph < kin->nPhases(); iph++) {
+            for (size_t jsp = 0; jsp < m_numSurfPhases; jsp++) {
+                if (&kin->thermo(iph) != m_ptrsSurfPhase[jsp]) {
+                    continue;
+                }
+                size_t kstart = kin->kineticsSpeciesIndex(0, iph);
+                for (size_t k = 0; k < m_nSpeciesSurfPhase[jsp]; k++) {
+                    m_kinSpecEqn[isp][kstart + k] =
+                        m_eqnIndexStartSolnPhase[jsp] + k;
+                }
+            }
+        }
+    }
+
     // Dimension solution vector
     size_t dim1 = std::max<size_t>(1, m_neq);
     m_CSolnSP.resize(dim1, 0.0);
@@ -110,6 +131,18 @@ solveSP::solveSP(ImplicitSurfChem* surfChemPtr, int bulkFunc) :
     m_Jac.resize(dim1, dim1, 0.0);
 }
 
+const size_t solveSP::s_sparseMinSize;
+constexpr double solveSP::s_sparseMaxDensity;
+
+void solveSP::setLinearSolverType(const std::string& type)
+{
+    if (type != "auto" && type != "dense" && type != "sparse") {
+        throw CanteraError("solveSP::setLinearSolverType",
+                           "Unknown linear solver type '{}'", type);
+    }
+    m_linearSolverType = type;
+}
+
 int solveSP::solveSurfProb(int ifunc, doublereal time_scale, doublereal TKelvin,
                            doublereal PGas, doublereal reltol, doublereal abstol)
 {
@@ -214,14 +247,14 @@ int solveSP::solveSurfProb(int ifunc, doublereal time_scale, doublereal TKelvin,
         // the first iteration.
         if (iter%4 == 1) {
             calcWeights(m_wtSpecies.data(), m_wtResid.data(),
-                        m_Jac, m_CSolnSP.data(), abstol, reltol);
+                        m_CSolnSP.data(), abstol, reltol);
         }
 
         // Find the weighted norm of the residual
         double resid_norm = calcWeightedNorm(m_wtResid.data(), m_resid.data(), m_neq);
 
         // Solve Linear system.  The solution is in m_resid
-        solve(m_Jac, m_resid.data());
+        solveLinearSystem(m_resid.data());
 
         // Calculate the Damping factor needed to keep all unknowns between 0
         // and 1, and not allow too large a change (factor of 2) in any unknown.
@@ -335,6 +368,32 @@ void solveSP::evalSurfLarge(const doublereal* CSolnSP)
     }
 }
 
+void solveSP::getJacobian(DenseMatrix& jac, bool finiteDifference)
+{
+    size_t loc = 0;
+    for (size_t n = 0; n < m_numSurfPhases; n++) {
+        m_ptrsSurfPhase[n]->getConcentrations(m_CSolnSP.data() + loc);
+        loc += m_nSpeciesSurfPhase[n];
+    }
+    m_CSolnSPOld = m_CSolnSP;
+    evalSurfLarge(m_CSolnSP.data());
+    jac.resize(m_neq, m_neq);
+    jac.zero();
+    resjac_eval(jac, m_resid.data(), m_CSolnSP.data(), m_CSolnSPOld.data(),
+                false, 1.0e6, finiteDifference);
+    if (m_sparse) {
+        for (int j = 0; j < m_sparseJac.outerSize(); j++) {
+            for (Eigen::SparseMatrix<double>::InnerIterator it(m_sparseJac, j);
+                 it; ++it) {
+                jac(it.row(), it.col()) = it.value();
+            }
+        }
+    }
+    // restore the state, which is modified by the finite difference
+    // evaluation
+    updateState(m_CSolnSP.data());
+}
+
 void solveSP::fun_eval(doublereal* resid, const doublereal* CSoln,
                        const doublereal* CSolnOld, const bool do_time,
                        const doublereal deltaT)
@@ -445,12 +504,82 @@ void solveSP::fun_eval(doublereal* resid, const doublereal* CSoln,
 void solveSP::resjac_eval(DenseMatrix& jac,
                           doublereal resid[], doublereal CSoln[],
                           const doublereal CSolnOld[], const bool do_time,
-                          const doublereal deltaT)
+                          const doublereal deltaT, bool finiteDifference)
 {
     size_t kColIndex = 0;
     // Calculate the residual
     fun_eval(resid, CSoln, CSolnOld, do_time, deltaT);
-    // Now we will look over the columns perturbing each unknown.
+    if (!finiteDifference
+        && (m_bulkFunc != BULK_DEPOSITION || m_numBulkPhasesSS == 0)) {
+        // The kinetics objects are at the state given by CSoln, which allows
+        // for the Jacobian to be evaluated analytically
+        m_jacTrips.clear();
+        for (size_t isp = 0; isp < m_numSurfPhases; isp++) {
+            size_t nsp = m_nSpeciesSurfPhase[isp];
+            InterfaceKinetics* kinPtr = m_objects[isp];
+            size_t surfIndex = kinPtr->surfacePhaseIndex();
+            size_t kstart = kinPtr->kineticsSpeciesIndex(0, surfIndex);
+            size_t kins = m_eqnIndexStartSolnPhase[isp];
+            // The equation for the largest species is replaced by the
+            // site conservation equation
+            size_t kspecial = kins + m_spSurfLarge[isp];
+            const auto& eqn = m_kinSpecEqn[isp];
+            Eigen::SparseMatrix<double> dwdot = kinPtr->netProductionRates_ddC();
+            for (int j = 0; j < dwdot.outerSize(); j++) {
+                size_t col = eqn[j];
+                if (col == npos) {
+                    continue;
+                }
+                for (Eigen::SparseMatrix<double>::InnerIterator it(dwdot, j);
+                     it; ++it) {
+                    size_t k = it.row();
+                    if (k >= kstart && k < kstart + nsp
+                        && kins + k - kstart != kspecial) {
+                        m_jacTrips.emplace_back(static_cast<int>(kins + k - kstart),
+                                                static_cast<int>(col), -it.value());
+                    }
+                }
+            }
+            for (size_t k = 0; k < nsp; k++) {
+                if (kins + k == kspecial) {
+                    continue;
+                } else if (do_time) {
+                    m_jacTrips.emplace_back(static_cast<int>(kins + k),
+                                            static_cast<int>(kins + k),
+                                            1.0 / deltaT);
+                } else {
+                    // make sure that the diagonal is part of the pattern
+                    m_jacTrips.emplace_back(static_cast<int>(kins + k),
+                                            static_cast<int>(kins + k), 0.0);
+                }
+            }
+            for (size_t k = 0; k < nsp; k++) {
+                m_jacTrips.emplace_back(static_cast<int>(kspecial),
+                                        static_cast<int>(kins + k), -1.0);
+            }
+        }
+
+        if (m_linearSolverType == "auto") {
+            m_sparse = (m_neq >= s_sparseMinSize && m_jacTrips.size()
+                        <= s_sparseMaxDensity * m_neq * m_neq);
+        } else {
+            m_sparse = (m_linearSolverType == "sparse");
+        }
+        if (m_sparse) {
+            // repeated elements are summed by setFromTriplets
+            m_sparseJac.resize(m_neq, m_neq);
+            m_sparseJac.setFromTriplets(m_jacTrips.begin(), m_jacTrips.end());
+        } else {
+            jac.zero();
+            for (const auto& trip : m_jacTrips) {
+                jac(trip.row(), trip.col()) += trip.value();
+            }
+        }
+        return;
+    }
+
+    // Otherwise, look over the columns perturbing each unknown.
+    m_sparse = false;
     for (size_t jsp = 0; jsp < m_numSurfPhases; jsp++) {
         size_t nsp = m_nSpeciesSurfPhase[jsp];
         double sd = m_ptrsSurfPhase[jsp]->siteDensity();
@@ -556,7 +685,7 @@ static doublereal calcWeightedNorm(const doublereal wtX[], const doublereal dx[]
 }
 
 void solveSP::calcWeights(doublereal wtSpecies[], doublereal wtResid[],
-                          const Array2D& Jac, const doublereal CSoln[],
+                          const doublereal CSoln[],
                           const doublereal abstol, const doublereal reltol)
 {
     // First calculate the weighting factor for the concentrations of the
@@ -580,14 +709,45 @@ void solveSP::calcWeights(doublereal wtSpecies[], doublereal wtResid[],
     // Now do the residual Weights. Since we have the Jacobian, we will use it
     // to generate a number based on the what a significant change in a solution
     // variable does to each residual. This is a row sum scale operation.
+    if (m_sparse) {
+        std::fill(wtResid, wtResid + m_neq, 0.0);
+        for (int j = 0; j < m_sparseJac.outerSize(); j++) {
+            for (Eigen::SparseMatrix<double>::InnerIterator it(m_sparseJac, j);
+                 it; ++it) {
+                wtResid[it.row()] += fabs(it.value() * wtSpecies[j]);
+            }
+        }
+        return;
+    }
     for (size_t k = 0; k < m_neq; k++) {
         wtResid[k] = 0.0;
         for (size_t jcol = 0; jcol < m_neq; jcol++) {
-            wtResid[k] += fabs(Jac(k,jcol) * wtSpecies[jcol]);
+            wtResid[k] += fabs(m_Jac(k,jcol) * wtSpecies[jcol]);
         }
     }
 }
 
+void solveSP::solveLinearSystem(double* b)
+{
+    if (!m_sparse) {
+        solve(m_Jac, b);
+        return;
+    }
+    m_sparseSolver.compute(m_sparseJac);
+    if (m_sparseSolver.info() != Eigen::Success) {
+        throw CanteraError("solveSP::solveLinearSystem",
+            "Sparse LU factorization of the Jacobian failed:\n{}",
+            m_sparseSolver.lastErrorMessage());
+    }
+    Eigen::Map<Eigen::VectorXd> x(b, m_neq);
+    Eigen::VectorXd rhs = x;
+    x = m_sparseSolver.solve(rhs);
+    if (m_sparseSolver.info() != Eigen::Success) {
+        throw CanteraError("solveSP::solveLinearSystem",
+                           "Sparse solution of the linear system failed");
+    }
+}
+
 doublereal solveSP::calc_t(doublereal netProdRateSolnSP[],
                           doublereal XMolSolnSP[],
                           int* label, int* label_old,
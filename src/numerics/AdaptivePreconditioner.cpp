@@ -0,0 +1,107 @@
+//! @file AdaptivePreconditioner.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/numerics/AdaptivePreconditioner.h"
+#include "cantera/base/global.h"
+#include <sstream>
+
+using namespace std;
+
+namespace Cantera
+{
+
+AdaptivePreconditioner::AdaptivePreconditioner()
+    : m_threshold(0.0)
+    , m_prune_precon(false)
+    , m_drop_tol(0.0)
+    , m_fill_factor(0)
+    , m_dim(0)
+{
+    setIlutDropTol(1e-10);
+    setIlutFillFactor(10);
+}
+
+void AdaptivePreconditioner::setValue(size_t row, size_t col, double value)
+{
+    m_jac_trips.emplace_back(static_cast<int>(row), static_cast<int>(col), value);
+}
+
+void AdaptivePreconditioner::initialize(size_t networkSize)
+{
+    m_dim = networkSize;
+    m_jac_trips.clear();
+    m_precon_matrix.resize(m_dim, m_dim);
+    // initial guess at the number of nonzero elements
+    m_jac_trips.reserve(3 * m_dim);
+    m_identity.resize(m_dim, m_dim);
+    m_identity.setIdentity();
+    m_identity.makeCompressed();
+}
+
+void AdaptivePreconditioner::setup()
+{
+    // make into preconditioner as P = (I - gamma * J_bar)
+    updatePreconditioner();
+}
+
+void AdaptivePreconditioner::updatePreconditioner()
+{
+    // assemble the Jacobian; repeated elements are summed
+    m_precon_matrix.setFromTriplets(m_jac_trips.begin(), m_jac_trips.end());
+    m_precon_matrix = m_identity - m_gamma * m_precon_matrix;
+    // prune by threshold if desired
+    if (m_prune_precon) {
+        prunePreconditioner();
+    }
+    m_precon_matrix.makeCompressed();
+    // compute preconditioner
+    m_solver.compute(m_precon_matrix);
+    if (m_solver.info() != Eigen::Success) {
+        throw CanteraError("AdaptivePreconditioner::updatePreconditioner",
+                           "error code: {}", static_cast<int>(m_solver.info()));
+    }
+}
+
+void AdaptivePreconditioner::prunePreconditioner()
+{
+    double threshold = m_threshold;
+    m_precon_matrix.prune([threshold](Eigen::Index row, Eigen::Index col,
+                                      double value) {
+        return row == col || std::abs(value) >= threshold;
+    });
+}
+
+void AdaptivePreconditioner::solve(const size_t stateSize, double* rhs_vector,
+                                   double* output)
+{
+    // creating vectors in the form of Ax=b
+    Eigen::Map<Eigen::VectorXd> bVector(rhs_vector, stateSize);
+    Eigen::Map<Eigen::VectorXd> xVector(output, stateSize);
+    // solve for xVector
+    xVector = m_solver.solve(bVector);
+    if (m_solver.info() != Eigen::Success) {
+        throw CanteraError("AdaptivePreconditioner::solve",
+                           "error code: {}", static_cast<int>(m_solver.info()));
+    }
+}
+
+void AdaptivePreconditioner::printPreconditioner()
+{
+    std::stringstream ss;
+    Eigen::IOFormat HeavyFmt(Eigen::FullPrecision, 0, ", ", ";\n", "[", "]", "[", "]");
+    ss << Eigen::MatrixXd(m_precon_matrix).format(HeavyFmt);
+    writelog(ss.str());
+    writelogendl();
+}
+
+void AdaptivePreconditioner::printJacobian()
+{
+    std::stringstream ss;
+    ss << Eigen::MatrixXd(jacobian());
+    writelog(ss.str());
+    writelogendl();
+}
+
+}
@@ -64,6 +64,37 @@ extern "C" {
         return f->eval_nothrow(t, NV_DATA_S(y), NV_DATA_S(ydot));
     }
 
+#if CT_SUNDIALS_VERSION >= 30
+    //! Function called by CVodes to set up the preconditioner. If *jok* is
+    //! false, the Jacobian approximation held by the preconditioner is
+    //! re-evaluated; otherwise only the value of gamma is updated.
+    //! @ingroup odeGroup
+    static int cvodes_prec_setup(realtype t, N_Vector y, N_Vector ydot,
+                                 booleantype jok, booleantype* jcurPtr,
+                                 realtype gamma, void* f_data)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        if (!jok) {
+            *jcurPtr = true; // Jacobian data was recomputed
+            return f->preconditioner_setup_nothrow(t, NV_DATA_S(y), gamma);
+        } else {
+            *jcurPtr = false; // Jacobian data was not recomputed
+            return f->update_preconditioner_nothrow(gamma);
+        }
+    }
+
+    //! Function called by CVodes to solve the preconditioned linear system
+    //! P z = r. Only left preconditioning is used, such that *lr* is always 1.
+    //! @ingroup odeGroup
+    static int cvodes_prec_solve(realtype t, N_Vector y, N_Vector ydot,
+                                 N_Vector r, N_Vector z, realtype gamma,
+                                 realtype delta, int lr, void* f_data)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        return f->preconditioner_solve_nothrow(NV_DATA_S(r), NV_DATA_S(z));
+    }
+#endif
+
     //! Function called by CVodes when an error is encountered instead of
     //! writing to stdout. Here, save the error message provided by CVodes so
     //! that it can be included in the subsequently raised CanteraError.
@@ -178,6 +209,17 @@ void CVodesIntegrator::setProblemType(int probtype)
     m_type = probtype;
 }
 
+void CVodesIntegrator::setPreconditioner(shared_ptr<PreconditionerBase> preconditioner)
+{
+    if (preconditioner &&
+        preconditioner->preconditionerSide() != PreconditionerType::LEFT_PRECONDITION &&
+        preconditioner->preconditionerSide() != PreconditionerType::NO_PRECONDITION) {
+        throw CanteraError("CVodesIntegrator::setPreconditioner",
+                           "Only left preconditioning is supported.");
+    }
+    m_preconditioner = preconditioner;
+}
+
 void CVodesIntegrator::setMethod(MethodType t)
 {
     if (t == BDF_Method) {
@@ -391,14 +433,26 @@ void CVodesIntegrator::applyOptions()
     } else if (m_type == DIAG) {
         CVDiag(m_cvode_mem);
     } else if (m_type == GMRES) {
+        bool precondition = m_preconditioner &&
+            m_preconditioner->preconditionerSide() != PreconditionerType::NO_PRECONDITION;
         #if CT_SUNDIALS_VERSION >= 30
+            int prectype = precondition ? PREC_LEFT : PREC_NONE;
+            SUNLinSolFree((SUNLinearSolver) m_linsol);
             # if CT_SUNDIALS_VERSION >= 40
-                m_linsol = SUNLinSol_SPGMR(m_y, PREC_NONE, 0);
+                m_linsol = SUNLinSol_SPGMR(m_y, prectype, 0);
             # else
-                m_linsol = SUNSPGMR(m_y, PREC_NONE, 0);
+                m_linsol = SUNSPGMR(m_y, prectype, 0);
             #endif
             CVSpilsSetLinearSolver(m_cvode_mem, (SUNLinearSolver) m_linsol);
+            if (precondition) {
+                CVSpilsSetPreconditioner(m_cvode_mem, cvodes_prec_setup,
+                                         cvodes_prec_solve);
+            }
         #else
+            if (precondition) {
+                throw CanteraError("CVodesIntegrator::applyOptions",
+                    "Preconditioning requires Sundials 3.0 or newer");
+            }
             CVSpgmr(m_cvode_mem, PREC_NONE, 0);
         #endif
     } else if (m_type == BAND + NOJAC) {
@@ -9,10 +9,11 @@ FuncEval::FuncEval()
 {
 }
 
-int FuncEval::eval_nothrow(double t, double* y, double* ydot)
+template <class F>
+int FuncEval::callNoThrow(const std::string& method, F func)
 {
     try {
-        eval(t, y, ydot, m_sens_params.data());
+        func();
     } catch (CanteraError& err) {
         if (suppressErrors()) {
             m_errors.push_back(err.what());
@@ -24,14 +25,14 @@ int FuncEval::eval_nothrow(double t, double* y, double* ydot)
         if (suppressErrors()) {
             m_errors.push_back(err.what());
         } else {
-            writelog("FuncEval::eval_nothrow: unhandled exception:\n");
+            writelog("FuncEval::{}: unhandled exception:\n", method);
             writelog(err.what());
             writelogendl();
         }
         return -1; // unrecoverable error
     } catch (...) {
-        std::string msg = "FuncEval::eval_nothrow: unhandled exception"
-            " of unknown type\n";
+        std::string msg = fmt::format("FuncEval::{}: unhandled exception"
+            " of unknown type\n", method);
         if (suppressErrors()) {
             m_errors.push_back(msg);
         } else {
@@ -42,6 +43,34 @@ int FuncEval::eval_nothrow(double t, double* y, double* ydot)
     return 0; // successful evaluation
 }
 
+int FuncEval::eval_nothrow(double t, double* y, double* ydot)
+{
+    return callNoThrow("eval_nothrow", [&]() {
+        eval(t, y, ydot, m_sens_params.data());
+    });
+}
+
+int FuncEval::preconditioner_setup_nothrow(double t, double* y, double gamma)
+{
+    return callNoThrow("preconditioner_setup_nothrow", [&]() {
+        preconditionerSetup(t, y, gamma);
+    });
+}
+
+int FuncEval::preconditioner_solve_nothrow(double* rhs, double* output)
+{
+    return callNoThrow("preconditioner_solve_nothrow", [&]() {
+        preconditionerSolve(rhs, output);
+    });
+}
+
+int FuncEval::update_preconditioner_nothrow(double gamma)
+{
+    return callNoThrow("update_preconditioner_nothrow", [&]() {
+        updatePreconditioner(gamma);
+    });
+}
+
 std::string FuncEval::getErrors() const {
     std::stringstream errs;
     for (const auto& err : m_errors) {
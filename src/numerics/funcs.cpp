@@ -5,6 +5,12 @@
 
 #include "cantera/numerics/funcs.h"
 
+#include <cfloat>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 using namespace std;
 
 namespace Cantera
@@ -27,4 +33,293 @@ doublereal linearInterp(doublereal x, const vector_fp& xpts,
     return ff;
 }
 
+namespace {
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+// Coefficients of the rational approximation of exp(r) for |r| <= ln(2)/2,
+// from the Cephes Mathematical Library
+const double expP0 = 1.26177193074810590878e-4;
+const double expP1 = 3.02994407707441961300e-2;
+const double expP2 = 9.99999999999999999910e-1;
+const double expQ0 = 3.00198505138664455042e-6;
+const double expQ1 = 2.52448340349684104192e-3;
+const double expQ2 = 2.27265548208155028766e-1;
+const double expQ3 = 2.00000000000000000009e0;
+// ln(2) split into a part that is exact in floating point and a remainder
+const double expC1 = 6.93145751953125e-1;
+const double expC2 = 1.42860682030941723212e-6;
+const double maxLog = 7.09782712893383996843e2;
+const double minLog = -7.08396418532264106224e2;
+// 2^52 + 1023; adding this to an integer-valued double places the biased
+// exponent in the lowest bits of the mantissa
+const double expMagic = 4503599627370496.0 + 1023.0;
+const double log2e = 1.4426950408889634074;
+
+// Coefficients of the rational approximation of log(1+x) for
+// sqrt(1/2) - 1 <= x < sqrt(2) - 1, from the Cephes Mathematical Library
+const double logP0 = 1.01875663804580931796e-4;
+const double logP1 = 4.97494994976747001425e-1;
+const double logP2 = 4.70579119878881725854e0;
+const double logP3 = 1.44989225341610930846e1;
+const double logP4 = 1.79368678507819816313e1;
+const double logP5 = 7.70838733755885391666e0;
+const double logQ0 = 1.12873587189167450590e1;
+const double logQ1 = 4.52279145837532221105e1;
+const double logQ2 = 8.29875266912776603211e1;
+const double logQ3 = 7.11544750618563894466e1;
+const double logQ4 = 2.31251620126765340583e1;
+// ln(2) split into a part that is exact in floating point and a remainder
+const double logC1 = 0.693359375;
+const double logC2 = -2.121944400546905827679e-4;
+const double sqrtHalf = 0.70710678118654752440;
+#endif
+
+#if defined(__AVX512F__)
+const size_t simdWidth = 8;
+
+inline __m512d pow2_simd(__m512d n)
+{
+    __m512i bits = _mm512_castpd_si512(_mm512_add_pd(n, _mm512_set1_pd(expMagic)));
+    return _mm512_castsi512_pd(_mm512_slli_epi64(bits, 52));
+}
+
+//! Evaluate exp(x) for arguments that give normal or infinite results
+inline __m512d exp_simd(__m512d x)
+{
+    __m512d xc = _mm512_min_pd(_mm512_max_pd(x, _mm512_set1_pd(minLog)),
+                               _mm512_set1_pd(maxLog));
+    __m512d n = _mm512_roundscale_pd(_mm512_mul_pd(xc, _mm512_set1_pd(log2e)),
+                                     _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m512d r = _mm512_sub_pd(xc, _mm512_mul_pd(n, _mm512_set1_pd(expC1)));
+    r = _mm512_sub_pd(r, _mm512_mul_pd(n, _mm512_set1_pd(expC2)));
+    __m512d rr = _mm512_mul_pd(r, r);
+    __m512d px = _mm512_add_pd(_mm512_mul_pd(_mm512_set1_pd(expP0), rr),
+                               _mm512_set1_pd(expP1));
+    px = _mm512_add_pd(_mm512_mul_pd(px, rr), _mm512_set1_pd(expP2));
+    px = _mm512_mul_pd(px, r);
+    __m512d qx = _mm512_add_pd(_mm512_mul_pd(_mm512_set1_pd(expQ0), rr),
+                               _mm512_set1_pd(expQ1));
+    qx = _mm512_add_pd(_mm512_mul_pd(qx, rr), _mm512_set1_pd(expQ2));
+    qx = _mm512_add_pd(_mm512_mul_pd(qx, rr), _mm512_set1_pd(expQ3));
+    __m512d y = _mm512_div_pd(px, _mm512_sub_pd(qx, px));
+    y = _mm512_add_pd(_mm512_set1_pd(1.0), _mm512_add_pd(y, y));
+    // scale by 2^n in two steps to keep both factors within the normal range
+    __m512d a = _mm512_roundscale_pd(_mm512_mul_pd(n, _mm512_set1_pd(0.5)),
+                                     _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    y = _mm512_mul_pd(_mm512_mul_pd(y, pow2_simd(a)), pow2_simd(_mm512_sub_pd(n, a)));
+    y = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(x, _mm512_set1_pd(maxLog), _CMP_GT_OQ),
+                             y, _mm512_set1_pd(INFINITY));
+    return _mm512_mask_blend_pd(_mm512_cmp_pd_mask(x, x, _CMP_UNORD_Q), y, x);
+}
+
+inline bool exp_block(const double* x, double* y)
+{
+    __m512d xx = _mm512_loadu_pd(x);
+    if (_mm512_cmp_pd_mask(xx, _mm512_set1_pd(minLog), _CMP_LT_OQ)) {
+        return false;
+    }
+    _mm512_storeu_pd(y, exp_simd(xx));
+    return true;
+}
+
+//! Evaluate log(x) for normal, finite and positive arguments
+inline __m512d log_simd(__m512d x)
+{
+    // x = m * 2^e with 0.5 <= m < 1
+    __m512d m = _mm512_getmant_pd(x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+    __m512d e = _mm512_add_pd(_mm512_getexp_pd(x), _mm512_set1_pd(1.0));
+    // shift m to the interval [sqrt(1/2), sqrt(2)) and subtract 1
+    __mmask8 small = _mm512_cmp_pd_mask(m, _mm512_set1_pd(sqrtHalf), _CMP_LT_OQ);
+    e = _mm512_mask_sub_pd(e, small, e, _mm512_set1_pd(1.0));
+    m = _mm512_mask_add_pd(m, small, m, m);
+    __m512d r = _mm512_sub_pd(m, _mm512_set1_pd(1.0));
+    __m512d z = _mm512_mul_pd(r, r);
+    __m512d px = _mm512_fmadd_pd(_mm512_set1_pd(logP0), r, _mm512_set1_pd(logP1));
+    px = _mm512_fmadd_pd(px, r, _mm512_set1_pd(logP2));
+    px = _mm512_fmadd_pd(px, r, _mm512_set1_pd(logP3));
+    px = _mm512_fmadd_pd(px, r, _mm512_set1_pd(logP4));
+    px = _mm512_fmadd_pd(px, r, _mm512_set1_pd(logP5));
+    __m512d qx = _mm512_add_pd(r, _mm512_set1_pd(logQ0));
+    qx = _mm512_fmadd_pd(qx, r, _mm512_set1_pd(logQ1));
+    qx = _mm512_fmadd_pd(qx, r, _mm512_set1_pd(logQ2));
+    qx = _mm512_fmadd_pd(qx, r, _mm512_set1_pd(logQ3));
+    qx = _mm512_fmadd_pd(qx, r, _mm512_set1_pd(logQ4));
+    __m512d y = _mm512_mul_pd(_mm512_mul_pd(r, z), _mm512_div_pd(px, qx));
+    y = _mm512_fmadd_pd(e, _mm512_set1_pd(logC2), y);
+    y = _mm512_fnmadd_pd(_mm512_set1_pd(0.5), z, y);
+    return _mm512_fmadd_pd(e, _mm512_set1_pd(logC1), _mm512_add_pd(r, y));
+}
+
+//! Return `true` if all elements are normal, finite and positive numbers
+inline bool log_valid(__m512d x)
+{
+    __mmask8 valid = _mm512_cmp_pd_mask(x, _mm512_set1_pd(DBL_MIN), _CMP_GE_OQ)
+        & _mm512_cmp_pd_mask(x, _mm512_set1_pd(DBL_MAX), _CMP_LE_OQ);
+    return valid == 0xff;
+}
+
+inline bool log_block(const double* x, double* y)
+{
+    __m512d xx = _mm512_loadu_pd(x);
+    if (!log_valid(xx)) {
+        return false;
+    }
+    _mm512_storeu_pd(y, log_simd(xx));
+    return true;
+}
+
+#elif defined(__AVX2__)
+const size_t simdWidth = 4;
+
+inline __m256d pow2_simd(__m256d n)
+{
+    __m256i bits = _mm256_castpd_si256(_mm256_add_pd(n, _mm256_set1_pd(expMagic)));
+    return _mm256_castsi256_pd(_mm256_slli_epi64(bits, 52));
+}
+
+//! Evaluate exp(x) for arguments that give normal or infinite results
+inline __m256d exp_simd(__m256d x)
+{
+    __m256d xc = _mm256_min_pd(_mm256_max_pd(x, _mm256_set1_pd(minLog)),
+                               _mm256_set1_pd(maxLog));
+    __m256d n = _mm256_round_pd(_mm256_mul_pd(xc, _mm256_set1_pd(log2e)),
+                                _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256d r = _mm256_sub_pd(xc, _mm256_mul_pd(n, _mm256_set1_pd(expC1)));
+    r = _mm256_sub_pd(r, _mm256_mul_pd(n, _mm256_set1_pd(expC2)));
+    __m256d rr = _mm256_mul_pd(r, r);
+    __m256d px = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(expP0), rr),
+                               _mm256_set1_pd(expP1));
+    px = _mm256_add_pd(_mm256_mul_pd(px, rr), _mm256_set1_pd(expP2));
+    px = _mm256_mul_pd(px, r);
+    __m256d qx = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(expQ0), rr),
+                               _mm256_set1_pd(expQ1));
+    qx = _mm256_add_pd(_mm256_mul_pd(qx, rr), _mm256_set1_pd(expQ2));
+    qx = _mm256_add_pd(_mm256_mul_pd(qx, rr), _mm256_set1_pd(expQ3));
+    __m256d y = _mm256_div_pd(px, _mm256_sub_pd(qx, px));
+    y = _mm256_add_pd(_mm256_set1_pd(1.0), _mm256_add_pd(y, y));
+    // scale by 2^n in two steps to keep both factors within the normal range
+    __m256d a = _mm256_floor_pd(_mm256_mul_pd(n, _mm256_set1_pd(0.5)));
+    y = _mm256_mul_pd(_mm256_mul_pd(y, pow2_simd(a)), pow2_simd(_mm256_sub_pd(n, a)));
+    y = _mm256_blendv_pd(y, _mm256_set1_pd(INFINITY),
+                         _mm256_cmp_pd(x, _mm256_set1_pd(maxLog), _CMP_GT_OQ));
+    return _mm256_blendv_pd(y, x, _mm256_cmp_pd(x, x, _CMP_UNORD_Q));
+}
+
+inline bool exp_block(const double* x, double* y)
+{
+    __m256d xx = _mm256_loadu_pd(x);
+    if (_mm256_movemask_pd(_mm256_cmp_pd(xx, _mm256_set1_pd(minLog), _CMP_LT_OQ))) {
+        return false;
+    }
+    _mm256_storeu_pd(y, exp_simd(xx));
+    return true;
+}
+
+//! Evaluate log(x) for normal, finite and positive arguments
+inline __m256d log_simd(__m256d x)
+{
+    // x = m * 2^e with 0.5 <= m < 1, where the biased exponent is converted
+    // to floating point using the same technique as in pow2_simd
+    __m256i bits = _mm256_castpd_si256(x);
+    __m256i biased = _mm256_srli_epi64(bits, 52);
+    __m256d e = _mm256_sub_pd(
+        _mm256_castsi256_pd(_mm256_or_si256(biased,
+            _mm256_castpd_si256(_mm256_set1_pd(4503599627370496.0)))),
+        _mm256_set1_pd(4503599627370496.0 + 1022.0));
+    __m256d m = _mm256_castsi256_pd(_mm256_or_si256(
+        _mm256_and_si256(bits, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL)),
+        _mm256_set1_epi64x(0x3FE0000000000000LL)));
+    // shift m to the interval [sqrt(1/2), sqrt(2)) and subtract 1
+    __m256d small = _mm256_cmp_pd(m, _mm256_set1_pd(sqrtHalf), _CMP_LT_OQ);
+    e = _mm256_sub_pd(e, _mm256_and_pd(small, _mm256_set1_pd(1.0)));
+    m = _mm256_add_pd(m, _mm256_and_pd(small, m));
+    __m256d r = _mm256_sub_pd(m, _mm256_set1_pd(1.0));
+    __m256d z = _mm256_mul_pd(r, r);
+    __m256d px = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(logP0), r),
+                               _mm256_set1_pd(logP1));
+    px = _mm256_add_pd(_mm256_mul_pd(px, r), _mm256_set1_pd(logP2));
+    px = _mm256_add_pd(_mm256_mul_pd(px, r), _mm256_set1_pd(logP3));
+    px = _mm256_add_pd(_mm256_mul_pd(px, r), _mm256_set1_pd(logP4));
+    px = _mm256_add_pd(_mm256_mul_pd(px, r), _mm256_set1_pd(logP5));
+    __m256d qx = _mm256_add_pd(r, _mm256_set1_pd(logQ0));
+    qx = _mm256_add_pd(_mm256_mul_pd(qx, r), _mm256_set1_pd(logQ1));
+    qx = _mm256_add_pd(_mm256_mul_pd(qx, r), _mm256_set1_pd(logQ2));
+    qx = _mm256_add_pd(_mm256_mul_pd(qx, r), _mm256_set1_pd(logQ3));
+    qx = _mm256_add_pd(_mm256_mul_pd(qx, r), _mm256_set1_pd(logQ4));
+    __m256d y = _mm256_mul_pd(_mm256_mul_pd(r, z), _mm256_div_pd(px, qx));
+    y = _mm256_add_pd(y, _mm256_mul_pd(e, _mm256_set1_pd(logC2)));
+    y = _mm256_sub_pd(y, _mm256_mul_pd(_mm256_set1_pd(0.5), z));
+    return _mm256_add_pd(_mm256_add_pd(r, y),
+                         _mm256_mul_pd(e, _mm256_set1_pd(logC1)));
+}
+
+//! Return `true` if all elements are normal, finite and positive numbers
+inline bool log_valid(__m256d x)
+{
+    __m256d valid = _mm256_and_pd(
+        _mm256_cmp_pd(x, _mm256_set1_pd(DBL_MIN), _CMP_GE_OQ),
+        _mm256_cmp_pd(x, _mm256_set1_pd(DBL_MAX), _CMP_LE_OQ));
+    return _mm256_movemask_pd(valid) == 0xf;
+}
+
+inline bool log_block(const double* x, double* y)
+{
+    __m256d xx = _mm256_loadu_pd(x);
+    if (!log_valid(xx)) {
+        return false;
+    }
+    _mm256_storeu_pd(y, log_simd(xx));
+    return true;
+}
+
+#else
+const size_t simdWidth = 1;
+
+inline bool exp_block(const double* x, double* y)
+{
+    *y = std::exp(*x);
+    return true;
+}
+
+inline bool log_block(const double* x, double* y)
+{
+    *y = std::log(*x);
+    return true;
+}
+#endif
+
+}
+
+void vectorExp(const double* x, double* y, size_t n)
+{
+    size_t i = 0;
+    for (; i + simdWidth <= n; i += simdWidth) {
+        if (!exp_block(x + i, y + i)) {
+            // results that are subnormal or zero
+            for (size_t j = i; j < i + simdWidth; j++) {
+                y[j] = std::exp(x[j]);
+            }
+        }
+    }
+    for (; i < n; i++) {
+        y[i] = std::exp(x[i]);
+    }
+}
+
+void vectorLog(const double* x, double* y, size_t n)
+{
+    size_t i = 0;
+    for (; i + simdWidth <= n; i += simdWidth) {
+        if (!log_block(x + i, y + i)) {
+            // zero, negative, subnormal, infinite or NaN arguments
+            for (size_t j = i; j < i + simdWidth; j++) {
+                y[j] = std::log(x[j]);
+            }
+        }
+    }
+    for (; i < n; i++) {
+        y[i] = std::log(x[i]);
+    }
+}
+
 }
@@ -0,0 +1,74 @@
+//! @file FlameSampling.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/oneD/FlameSampling.h"
+#include "cantera/oneD/Sim1D.h"
+#include "cantera/oneD/StFlow.h"
+#include "cantera/kinetics/DirectedRelationGraph.h"
+#include "cantera/kinetics/ReactionPath.h"
+#include "cantera/thermo/ThermoPhase.h"
+
+namespace Cantera
+{
+
+namespace {
+
+//! Return the flow domain `domain` of `sim`
+StFlow& flowDomain(Sim1D& sim, size_t domain, const std::string& procedure)
+{
+    StFlow* flow = dynamic_cast<StFlow*>(&sim.domain(domain));
+    if (!flow) {
+        throw CanteraError(procedure, "Domain {} is not a flow domain.", domain);
+    }
+    return *flow;
+}
+
+//! Set the state of the phase of `flow` to that of grid point `j`
+void setPointState(Sim1D& sim, size_t domain, StFlow& flow, size_t j,
+                   vector_fp& Y)
+{
+    for (size_t k = 0; k < Y.size(); k++) {
+        Y[k] = sim.value(domain, c_offset_Y + k, j);
+    }
+    flow.phase().setState_TPY(sim.value(domain, c_offset_T, j),
+                              flow.pressure(), Y.data());
+}
+
+}
+
+void sampleFlame(DirectedRelationGraph& drg, Sim1D& sim, size_t domain)
+{
+    StFlow& flow = flowDomain(sim, domain, "sampleFlame");
+    ThermoPhase& phase = flow.phase();
+    vector_fp state;
+    phase.saveState(state);
+    vector_fp Y(phase.nSpecies());
+    for (size_t j = 0; j < flow.nPoints(); j++) {
+        setPointState(sim, domain, flow, j, Y);
+        drg.addSample(phase);
+    }
+    phase.restoreState(state);
+}
+
+void integrateFlame(ReactionPathAccumulator& acc, Sim1D& sim, size_t domain)
+{
+    StFlow& flow = flowDomain(sim, domain, "integrateFlame");
+    ThermoPhase& phase = flow.phase();
+    vector_fp state;
+    phase.saveState(state);
+    vector_fp Y(phase.nSpecies());
+    for (size_t j = 0; j < flow.nPoints(); j++) {
+        setPointState(sim, domain, flow, j, Y);
+        acc.syncState(phase);
+        if (j == 0) {
+            acc.startIntegration();
+        } else {
+            acc.addInterval(flow.grid(j) - flow.grid(j - 1));
+        }
+    }
+    phase.restoreState(state);
+}
+
+}
@@ -132,8 +132,9 @@ ThermoPhase* newPhase(const std::string& infile, std::string id)
         id = "";
     }
 
-    if (extension == "yml" || extension == "yaml") {
-        AnyMap root = AnyMap::fromYamlFile(infile);
+    if (extension == "yml" || extension == "yaml" || extension == "ctb") {
+        AnyMap root = (extension == "ctb") ? AnyMap::fromBinaryFile(infile)
+                                           : AnyMap::fromYamlFile(infile);
         AnyMap& phase = root["phases"].getMapWhere("name", id);
         unique_ptr<ThermoPhase> t(newThermoPhase(phase["thermo"].asString()));
         setupPhase(*t, phase, root);
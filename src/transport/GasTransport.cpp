@@ -368,8 +368,67 @@ void GasTransport::setupCollisionParameters()
     }
 }
 
+AnyMap GasTransport::fittedProperties() const
+{
+    AnyMap fits;
+    fits["model"] = transportType();
+    fits["CK-mode"] = CKMode();
+    fits["species"] = m_thermo->speciesNames();
+    fits["viscosity"] = m_visccoeffs;
+    fits["conductivity"] = m_condcoeffs;
+    fits["diffusivity"] = m_diffcoeffs;
+    fits["omega22"] = m_omega22_poly;
+    fits["astar"] = m_astar_poly;
+    fits["bstar"] = m_bstar_poly;
+    fits["cstar"] = m_cstar_poly;
+    std::vector<std::vector<long int>> poly(m_nsp), actualT(m_nsp);
+    for (size_t i = 0; i < m_nsp; i++) {
+        poly[i].assign(m_poly[i].begin(), m_poly[i].end());
+        actualT[i].assign(m_star_poly_uses_actualT[i].begin(),
+                          m_star_poly_uses_actualT[i].end());
+    }
+    fits["poly-index"] = poly;
+    fits["poly-uses-actual-T"] = actualT;
+    return fits;
+}
+
+bool GasTransport::restoreFittedProperties()
+{
+    const AnyMap& input = m_thermo->input();
+    if (!input.hasKey("__transport-fits__")) {
+        return false;
+    }
+    for (const auto& fits : input["__transport-fits__"].asVector<AnyMap>()) {
+        if (fits["model"] != transportType()
+            || fits["CK-mode"].asBool() != CKMode()
+            || fits["species"].asVector<std::string>() != m_thermo->speciesNames())
+        {
+            continue;
+        }
+        auto poly = fits["poly-index"].asVector<std::vector<long int>>(m_nsp);
+        auto actualT = fits["poly-uses-actual-T"].asVector<std::vector<long int>>(m_nsp);
+        for (size_t i = 0; i < m_nsp; i++) {
+            m_poly[i].assign(poly[i].begin(), poly[i].end());
+            m_star_poly_uses_actualT[i].assign(actualT[i].begin(), actualT[i].end());
+        }
+        m_visccoeffs = fits["viscosity"].asVector<vector_fp>(m_nsp);
+        m_condcoeffs = fits["conductivity"].asVector<vector_fp>(m_nsp);
+        m_diffcoeffs = fits["diffusivity"].asVector<vector_fp>(m_nsp * (m_nsp + 1) / 2);
+        m_omega22_poly = fits["omega22"].asVector<vector_fp>();
+        m_astar_poly = fits["astar"].asVector<vector_fp>();
+        m_bstar_poly = fits["bstar"].asVector<vector_fp>();
+        m_cstar_poly = fits["cstar"].asVector<vector_fp>();
+        return true;
+    }
+    return false;
+}
+
 void GasTransport::setupCollisionIntegral()
 {
+    if (restoreFittedProperties()) {
+        debuglog("*** using stored property fits ***\n", m_log_level);
+        return;
+    }
     double tstar_min = 1.e8, tstar_max = 0.0;
     for (size_t i = 0; i < m_nsp; i++) {
         for (size_t j = i; j < m_nsp; j++) {
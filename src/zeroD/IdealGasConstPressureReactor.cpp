@@ -6,8 +6,9 @@
 #include "cantera/zeroD/IdealGasConstPressureReactor.h"
 #include "cantera/zeroD/FlowDevice.h"
 #include "cantera/zeroD/ReactorNet.h"
-#include "cantera/kinetics/Kinetics.h"
-#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/zeroD/ReactorSurface.h"
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/thermo/SurfPhase.h"
 
 using namespace std;
 
@@ -39,30 +40,54 @@ void IdealGasConstPressureReactor::getState(double* y)
     // set the second component to the temperature
     y[1] = m_thermo->temperature();
 
-    // set components y+2 ... y+K+1 to the mass fractions Y_k of each species
-    m_thermo->getMassFractions(y+2);
+    // set the following components to the mass fractions Y_k of each species
+    // that is not a quasi-steady-state species
+    m_thermo->getMassFractions(m_Y.data());
+    for (size_t j = 0; j < m_stateSpecies.size(); j++) {
+        y[j+2] = m_Y[m_stateSpecies[j]];
+    }
 
     // set the remaining components to the surface species
     // coverages on the walls
-    getSurfaceInitialConditions(y + m_nsp + 2);
+    getSurfaceInitialConditions(y + m_stateSpecies.size() + 2);
 }
 
 void IdealGasConstPressureReactor::initialize(doublereal t0)
 {
     ConstPressureReactor::initialize(t0);
     m_hk.resize(m_nsp, 0.0);
+    m_cpk.resize(m_nsp, 0.0);
+    m_Y.resize(m_nsp, 0.0);
+
+    // quasi-steady-state species are excluded from the state vector
+    auto gasKin = dynamic_cast<GasKinetics*>(m_kin);
+    m_stateSpecies.clear();
+    m_stateIndex.assign(m_nsp, npos);
+    for (size_t k = 0; k < m_nsp; k++) {
+        if (!gasKin || !gasKin->isQssSpecies(k)) {
+            m_stateIndex[k] = m_stateSpecies.size();
+            m_stateSpecies.push_back(k);
+        }
+    }
+    m_nv -= m_nsp - m_stateSpecies.size();
 }
 
 void IdealGasConstPressureReactor::updateState(doublereal* y)
 {
     // The components of y are [0] the total mass, [1] the temperature,
-    // [2...K+2) are the mass fractions of each species, and [K+2...] are the
-    // coverages of surface species on each wall.
+    // [2...K+2) are the mass fractions of each species that is not a
+    // quasi-steady-state species, and [K+2...] are the coverages of surface
+    // species on each wall. Mass fractions of quasi-steady-state species are
+    // set to zero.
     m_mass = y[0];
-    m_thermo->setMassFractions_NoNorm(y+2);
+    std::fill(m_Y.begin(), m_Y.end(), 0.0);
+    for (size_t j = 0; j < m_stateSpecies.size(); j++) {
+        m_Y[m_stateSpecies[j]] = y[j+2];
+    }
+    m_thermo->setMassFractions_NoNorm(m_Y.data());
     m_thermo->setState_TP(y[1], m_pressure);
     m_vol = m_mass / m_thermo->density();
-    updateSurfaceState(y + m_nsp + 2);
+    updateSurfaceState(y + m_stateSpecies.size() + 2);
     updateConnected(false);
 }
 
@@ -77,7 +102,7 @@ void IdealGasConstPressureReactor::evalEqs(doublereal time, doublereal* y,
     evalWalls(time);
 
     m_thermo->restoreState(m_state);
-    double mdot_surf = evalSurfaces(time, ydot + m_nsp + 2);
+    double mdot_surf = evalSurfaces(time, ydot + m_stateSpecies.size() + 2);
     dmdt += mdot_surf;
 
     m_thermo->getPartialMolarEnthalpies(&m_hk[0]);
@@ -95,10 +120,14 @@ void IdealGasConstPressureReactor::evalEqs(doublereal time, doublereal* y,
         // heat release from gas phase and surface reactions
         mcpdTdt -= m_wdot[n] * m_hk[n] * m_vol;
         mcpdTdt -= m_sdot[n] * m_hk[n];
+    }
+
+    for (size_t j = 0; j < m_stateSpecies.size(); j++) {
+        size_t n = m_stateSpecies[j];
         // production in gas phase and from surfaces
-        dYdt[n] = (m_wdot[n] * m_vol + m_sdot[n]) * mw[n] / m_mass;
+        dYdt[j] = (m_wdot[n] * m_vol + m_sdot[n]) * mw[n] / m_mass;
         // dilution by net surface mass flux
-        dYdt[n] -= Y[n] * mdot_surf / m_mass;
+        dYdt[j] -= Y[n] * mdot_surf / m_mass;
     }
 
     // add terms for outlets
@@ -114,7 +143,9 @@ void IdealGasConstPressureReactor::evalEqs(doublereal time, doublereal* y,
         for (size_t n = 0; n < m_nsp; n++) {
             double mdot_spec = inlet->outletSpeciesMassFlowRate(n);
             // flow of species into system and dilution by other species
-            dYdt[n] += (mdot_spec - mdot * Y[n]) / m_mass;
+            if (m_stateIndex[n] != npos) {
+                dYdt[m_stateIndex[n]] += (mdot_spec - mdot * Y[n]) / m_mass;
+            }
             mcpdTdt -= m_hk[n] / mw[n] * mdot_spec;
         }
     }
@@ -129,10 +160,95 @@ void IdealGasConstPressureReactor::evalEqs(doublereal time, doublereal* y,
     resetSensitivity(params);
 }
 
+void IdealGasConstPressureReactor::getJacobianElements(SparseTriplets& trips,
+                                                       size_t offset)
+{
+    if (!m_chem) {
+        return;
+    }
+    // The components of y are [0] the total mass, [1] the temperature and
+    // [2...K+2) the mass fractions of each species that is not a
+    // quasi-steady-state species
+    m_thermo->restoreState(m_state);
+    double T = m_thermo->temperature();
+    double rho = m_thermo->density();
+    double cp = m_thermo->cp_mass();
+    const vector_fp& mw = m_thermo->molecularWeights();
+    m_kin->getNetProductionRates(m_wdot.data());
+    Eigen::SparseMatrix<double> dwdC = m_kin->netProductionRates_ddC();
+
+    // derivatives with respect to mass fractions at constant T and P, with
+    // dC_k/dY_j ~= rho/W_k delta_kj
+    for (int j = 0; j < dwdC.outerSize(); j++) {
+        if (m_stateIndex[j] == npos) {
+            continue;
+        }
+        for (Eigen::SparseMatrix<double>::InnerIterator it(dwdC, j); it; ++it) {
+            size_t k = it.row();
+            if (m_stateIndex[k] == npos) {
+                continue;
+            }
+            trips.emplace_back(static_cast<int>(offset + m_stateIndex[k] + 2),
+                               static_cast<int>(offset + m_stateIndex[j] + 2),
+                               it.value() * mw[k] / mw[j]);
+        }
+    }
+
+    // derivatives of net production rates with respect to temperature at
+    // constant pressure, where dC_k/dT = -C_k/T
+    vector_fp dwdT(m_nsp), conc(m_nsp);
+    m_kin->getNetProductionRates_ddT(dwdT.data());
+    m_thermo->getConcentrations(conc.data());
+    Eigen::VectorXd dwdC_C = dwdC * Eigen::Map<Eigen::VectorXd>(conc.data(), m_nsp);
+    for (size_t k = 0; k < m_nsp; k++) {
+        dwdT[k] -= dwdC_C[k] / T;
+        if (m_stateIndex[k] == npos) {
+            continue;
+        }
+        // dY_k/dt = wdot_k * W_k / rho, with d(1/rho)/dT = 1/(rho*T)
+        trips.emplace_back(static_cast<int>(offset + m_stateIndex[k] + 2),
+                           static_cast<int>(offset + 1),
+                           (dwdT[k] + m_wdot[k] / T) * mw[k] / rho);
+    }
+
+    if (m_energy) {
+        // dT/dt = -sum(h_k * wdot_k) / (rho * cp)
+        m_thermo->getPartialMolarEnthalpies(m_hk.data());
+        m_thermo->getPartialMolarCp(m_cpk.data());
+        Eigen::VectorXd dHdC = dwdC.transpose() *
+            Eigen::Map<Eigen::VectorXd>(m_hk.data(), m_nsp);
+        double qdot = 0.0;
+        double dqdT = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            qdot -= m_hk[k] * m_wdot[k];
+            dqdT -= m_hk[k] * dwdT[k] + m_cpk[k] * m_wdot[k];
+        }
+        double Tdot = qdot / (rho * cp);
+        for (size_t j = 0; j < m_stateSpecies.size(); j++) {
+            size_t k = m_stateSpecies[j];
+            // includes the change of the mixture heat capacity
+            trips.emplace_back(static_cast<int>(offset + 1),
+                               static_cast<int>(offset + j + 2),
+                               -(dHdC[k] + Tdot * m_cpk[k]) / (mw[k] * cp));
+        }
+        // temperature derivative of the mixture heat capacity
+        double dT = 1e-6 * T;
+        m_thermo->setState_TP(T + dT, m_pressure);
+        double dcpdT = (m_thermo->cp_mass() - cp) / dT;
+        m_thermo->restoreState(m_state);
+        trips.emplace_back(static_cast<int>(offset + 1),
+                           static_cast<int>(offset + 1),
+                           (dqdT + qdot / T) / (rho * cp) - Tdot * dcpdT / cp);
+    }
+}
+
 size_t IdealGasConstPressureReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
-    if (k != npos) {
+    if (k != npos && k < m_stateIndex.size()) {
+        // quasi-steady-state species are not part of the state vector
+        return (m_stateIndex[k] == npos) ? npos : m_stateIndex[k] + 2;
+    } else if (k != npos) {
         return k + 2;
     } else if (nm == "mass") {
         return 0;
@@ -146,6 +262,22 @@ size_t IdealGasConstPressureReactor::componentIndex(const string& nm) const
 std::string IdealGasConstPressureReactor::componentName(size_t k) {
     if (k == 1) {
         return "temperature";
+    } else if (k >= 2 && k < neq() && m_stateSpecies.size() < m_nsp) {
+        k -= 2;
+        if (k < m_stateSpecies.size()) {
+            return m_thermo->speciesName(m_stateSpecies[k]);
+        }
+        k -= m_stateSpecies.size();
+        for (auto& S : m_surfaces) {
+            ThermoPhase* th = S->thermo();
+            if (k < th->nSpecies()) {
+                return th->speciesName(k);
+            } else {
+                k -= th->nSpecies();
+            }
+        }
+        throw CanteraError("IdealGasConstPressureReactor::componentName",
+                           "Index is out of bounds.");
     } else {
         return ConstPressureReactor::componentName(k);
     }
@@ -55,6 +55,7 @@ void IdealGasReactor::initialize(doublereal t0)
 {
     Reactor::initialize(t0);
     m_uk.resize(m_nsp, 0.0);
+    m_cpk.resize(m_nsp, 0.0);
 }
 
 void IdealGasReactor::updateState(doublereal* y)
@@ -138,6 +139,74 @@ void IdealGasReactor::evalEqs(doublereal time, doublereal* y,
     resetSensitivity(params);
 }
 
+void IdealGasReactor::getJacobianElements(SparseTriplets& trips, size_t offset)
+{
+    if (!m_chem) {
+        return;
+    }
+    // The components of y are [0] the total mass, [1] the total volume,
+    // [2] the temperature and [3...K+3) the mass fractions of each species
+    m_thermo->restoreState(m_state);
+    double rho = m_thermo->density();
+    double cv = m_thermo->cv_mass();
+    const vector_fp& mw = m_thermo->molecularWeights();
+    m_kin->getNetProductionRates(m_wdot.data());
+    Eigen::SparseMatrix<double> dwdC = m_kin->netProductionRates_ddC();
+
+    // derivatives with respect to mass fractions at constant density, with
+    // dC_k/dY_j = rho/W_k delta_kj
+    for (int j = 0; j < dwdC.outerSize(); j++) {
+        for (Eigen::SparseMatrix<double>::InnerIterator it(dwdC, j); it; ++it) {
+            size_t k = it.row();
+            trips.emplace_back(static_cast<int>(offset + k + 3),
+                               static_cast<int>(offset + j + 3),
+                               it.value() * mw[k] / mw[j]);
+        }
+    }
+
+    // derivatives with respect to temperature at constant density
+    vector_fp dwdT(m_nsp);
+    m_kin->getNetProductionRates_ddT(dwdT.data());
+    for (size_t k = 0; k < m_nsp; k++) {
+        trips.emplace_back(static_cast<int>(offset + k + 3),
+                           static_cast<int>(offset + 2),
+                           dwdT[k] * mw[k] / rho);
+    }
+
+    if (m_energy) {
+        // dT/dt = -sum(u_k * wdot_k) / (rho * cv)
+        m_thermo->getPartialMolarIntEnergies(m_uk.data());
+        m_thermo->getPartialMolarCp(m_cpk.data());
+        Eigen::VectorXd dUdC = dwdC.transpose() *
+            Eigen::Map<Eigen::VectorXd>(m_uk.data(), m_nsp);
+        double qdot = 0.0;
+        double dqdT = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            // partial molar heat capacities at constant volume of ideal gas
+            // species are cp_k - R
+            m_cpk[k] -= GasConstant;
+            qdot -= m_uk[k] * m_wdot[k];
+            dqdT -= m_uk[k] * dwdT[k] + m_cpk[k] * m_wdot[k];
+        }
+        double Tdot = qdot / (rho * cv);
+        for (size_t k = 0; k < m_nsp; k++) {
+            // includes the change of the mixture heat capacity
+            trips.emplace_back(static_cast<int>(offset + 2),
+                               static_cast<int>(offset + k + 3),
+                               -(dUdC[k] + Tdot * m_cpk[k]) / (mw[k] * cv));
+        }
+        // temperature derivative of the mixture heat capacity
+        double T = m_thermo->temperature();
+        double dT = 1e-6 * T;
+        m_thermo->setTemperature(T + dT);
+        double dcvdT = (m_thermo->cv_mass() - cv) / dT;
+        m_thermo->restoreState(m_state);
+        trips.emplace_back(static_cast<int>(offset + 2),
+                           static_cast<int>(offset + 2),
+                           dqdT / (rho * cv) - Tdot * dcvdT / cv);
+    }
+}
+
 size_t IdealGasReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
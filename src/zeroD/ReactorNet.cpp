@@ -75,6 +75,14 @@ void ReactorNet::setSensitivityTolerances(double rtol, double atol)
     m_init = false;
 }
 
+void ReactorNet::setPreconditioner(shared_ptr<PreconditionerBase> preconditioner)
+{
+    m_precon = preconditioner;
+    m_integ->setPreconditioner(preconditioner);
+    m_integ->setProblemType(preconditioner ? GMRES : DENSE + NOJAC);
+    m_init = false;
+}
+
 void ReactorNet::initialize()
 {
     m_nv = 0;
@@ -99,6 +107,15 @@ void ReactorNet::initialize()
             throw CanteraError("ReactorNet::initialize",
                                "FlowReactors must be used alone.");
         }
+        if (m_precon && !r.preconditionerSupported()) {
+            throw CanteraError("ReactorNet::initialize",
+                "Preconditioning is not supported for reactor type '{}'.",
+                r.type());
+        }
+    }
+    if (m_precon) {
+        m_precon->initialize(m_nv);
+        m_precon->setAbsoluteTolerance(m_atols);
     }
 
     m_ydot.resize(m_nv,0.0);
@@ -315,6 +332,45 @@ void ReactorNet::getState(double* y)
     }
 }
 
+void ReactorNet::preconditionerSetup(double t, double* y, double gamma)
+{
+    if (!m_precon) {
+        throw CanteraError("ReactorNet::preconditionerSetup",
+                           "No preconditioner has been set.");
+    }
+    // update the state of all reactors to correspond to y
+    updateState(y);
+    m_precon->reset();
+    m_precon->setGamma(gamma);
+    m_jac_trips.clear();
+    for (size_t n = 0; n < m_reactors.size(); n++) {
+        m_reactors[n]->getJacobianElements(m_jac_trips, m_start[n]);
+    }
+    for (const auto& trip : m_jac_trips) {
+        m_precon->setValue(trip.row(), trip.col(), trip.value());
+    }
+    m_precon->setup();
+}
+
+void ReactorNet::updatePreconditioner(double gamma)
+{
+    if (!m_precon) {
+        throw CanteraError("ReactorNet::updatePreconditioner",
+                           "No preconditioner has been set.");
+    }
+    m_precon->setGamma(gamma);
+    m_precon->updatePreconditioner();
+}
+
+void ReactorNet::preconditionerSolve(double* rhs, double* output)
+{
+    if (!m_precon) {
+        throw CanteraError("ReactorNet::preconditionerSolve",
+                           "No preconditioner has been set.");
+    }
+    m_precon->solve(m_nv, rhs, output);
+}
+
 void ReactorNet::getDerivative(int k, double* dky)
 {
     double* cvode_dky = m_integ->derivative(m_time, k);
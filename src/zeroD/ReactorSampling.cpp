@@ -0,0 +1,70 @@
+//! @file ReactorSampling.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/zeroD/ReactorSampling.h"
+#include "cantera/zeroD/ReactorNet.h"
+#include "cantera/zeroD/IdealGasConstPressureReactor.h"
+#include "cantera/kinetics/DirectedRelationGraph.h"
+#include "cantera/kinetics/ReactionPath.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/base/Solution.h"
+
+namespace Cantera
+{
+
+void sampleReactor(DirectedRelationGraph& drg, ReactorNet& net,
+                   ReactorBase& reactor, double tEnd)
+{
+    while (net.time() < tEnd) {
+        net.step();
+        reactor.restoreState();
+        drg.addSample(reactor.contents());
+    }
+}
+
+double ignitionDelay(shared_ptr<Solution> soln, double T, double P,
+                     const std::string& X, double tEnd)
+{
+    soln->thermo()->setState_TPX(T, P, X);
+    IdealGasConstPressureReactor reactor;
+    reactor.insert(soln);
+    ReactorNet net;
+    net.addReactor(reactor);
+    double tPrev = 0.0;
+    double TPrev = T;
+    double maxSlope = 0.0;
+    double tIgn = NAN;
+    while (net.time() < tEnd) {
+        double t = net.step();
+        double slope = (reactor.temperature() - TPrev) / (t - tPrev);
+        if (slope > maxSlope) {
+            maxSlope = slope;
+            tIgn = t;
+        }
+        tPrev = t;
+        TPrev = reactor.temperature();
+    }
+    return tIgn;
+}
+
+void integrateReactor(ReactionPathAccumulator& acc, ReactorNet& net,
+                      ReactorBase& reactor, double tEnd)
+{
+    reactor.restoreState();
+    acc.syncState(reactor.contents());
+    acc.startIntegration();
+    while (net.time() < tEnd) {
+        double t0 = net.time();
+        if (net.step() > tEnd) {
+            // interpolate the solution at the end of the integration interval
+            net.advance(tEnd);
+        }
+        reactor.restoreState();
+        acc.syncState(reactor.contents());
+        acc.addInterval(net.time() - t0);
+    }
+}
+
+}
@@ -0,0 +1,69 @@
+#include "gtest/gtest.h"
+#include "cantera/clib/ct.h"
+#include "cantera/base/ct_defs.h"
+#include "cantera/base/global.h"
+
+using namespace Cantera;
+
+TEST(ct, getNetProductionRatesBatch)
+{
+    int thermo = thermo_newFromFile("gri30.yaml", "gri30");
+    ASSERT_GE(thermo, 0);
+    int kin = kin_newFromFile("gri30.yaml", "", thermo, -1, -1, -1, -1);
+    ASSERT_GE(kin, 0);
+    size_t nsp = thermo_nSpecies(thermo);
+
+    vector_fp T{900.0, 1500.0, 1500.0};
+    vector_fp P{OneAtm, 2 * OneAtm, 0.5 * OneAtm};
+    const char* X[] = {"CH4:1.0, O2:2.0, N2:7.52, H:0.01",
+                       "H2:1.0, O2:0.5, H2O:0.3, O:0.01",
+                       "CH4:0.5, H2:0.5, O2:1.0, OH:0.02"};
+    vector_fp Y(T.size() * nsp);
+    for (size_t n = 0; n < T.size(); n++) {
+        ASSERT_EQ(thermo_setMoleFractionsByName(thermo, X[n]), 0);
+        ASSERT_EQ(thermo_getMassFractions(thermo, nsp, &Y[n * nsp]), 0);
+    }
+
+    vector_fp wdot(T.size() * nsp);
+    ASSERT_EQ(kin_getNetProductionRatesBatch(kin, T.size(), T.data(),
+        P.data(), Y.data(), wdot.data()), 0);
+
+    vector_fp wdot_ref(nsp), cdot(nsp), ddot(nsp);
+    for (size_t n = 0; n < T.size(); n++) {
+        thermo_setMassFractions(thermo, nsp, &Y[n * nsp], 1);
+        thermo_setTemperature(thermo, T[n]);
+        thermo_setPressure(thermo, P[n]);
+        ASSERT_EQ(kin_getNetProductionRates(kin, nsp, wdot_ref.data()), 0);
+        ASSERT_EQ(kin_getCreationRates(kin, nsp, cdot.data()), 0);
+        ASSERT_EQ(kin_getDestructionRates(kin, nsp, ddot.data()), 0);
+        for (size_t k = 0; k < nsp; k++) {
+            // states are evaluated simultaneously, up to round-off errors
+            EXPECT_NEAR(wdot[n * nsp + k], wdot_ref[k],
+                        1e-12 * (cdot[k] + ddot[k]) + 1e-300);
+        }
+    }
+}
+
+TEST(ct, getNetProductionRatesBatchInterface)
+{
+    int gas = thermo_newFromFile("ptcombust.yaml", "gas");
+    int surf = thermo_newFromFile("ptcombust.yaml", "Pt_surf");
+    int kin = kin_newFromFile("ptcombust.yaml", "Pt_surf", surf, gas, -1, -1, -1);
+    ASSERT_GE(kin, 0);
+    double T = 900.0;
+    double P = OneAtm;
+    vector_fp Y(kin_nSpecies(kin)), wdot(Y.size());
+    // Errors are reported through the return value
+    EXPECT_EQ(kin_getNetProductionRatesBatch(kin, 1, &T, &P, Y.data(),
+                                             wdot.data()), -1);
+}
+
+int main(int argc, char** argv)
+{
+    printf("Running main() from test_clib.cpp\n");
+    testing::InitGoogleTest(&argc, argv);
+    make_deprecation_warnings_fatal();
+    int result = RUN_ALL_TESTS();
+    ct_appdelete();
+    return result;
+}
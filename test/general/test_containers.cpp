@@ -454,3 +454,69 @@ TEST(AnyMap, definedKeyOrdering)
     EXPECT_LT(loc["one"], loc["half"]);
     EXPECT_LT(loc["zero"], loc["half"]);
 }
+
+TEST(AnyMap, binaryRoundTrip)
+{
+    AnyMap m = AnyMap::fromYamlString(
+        "units: {length: cm, activation-energy: cal/mol}\n"
+        "name: test\n"
+        "flag: true\n"
+        "count: 42\n"
+        "value: 3.5\n"
+        "empty:\n"
+        "items:\n"
+        "- units: {quantity: mol}\n"
+        "- {name: a, A: 1.0e+13, Ea: 1000.0, tags: [x, y]}\n"
+        "- {name: b, A: 2.0e+13, data: [[1, 2], [3.5, 4]]}\n"
+        "mixed: [1, two, 3.0, {four: 4}]\n"
+        "bools: [[true, false], [false]]\n"
+        "ints: [1, 2, 3]\n"
+        "names: [[a, b], [c]]\n");
+    std::string data = m.toBinaryString();
+    AnyMap m2 = AnyMap::fromBinaryString(data);
+    EXPECT_TRUE(m2["empty"].is<void>());
+    // values without content can't be compared
+    m.erase("empty");
+    m2.erase("empty");
+    EXPECT_EQ(m2, m);
+    EXPECT_EQ(m2.toYamlString(), m.toYamlString());
+    EXPECT_TRUE(m2["bools"].is<std::vector<std::vector<bool>>>());
+    EXPECT_EQ(m2["mixed"].asVector<AnyValue>()[3]["four"].asInt(), 4);
+
+    // Units declarations are applied to the restored map
+    auto& items = m2["items"].asVector<AnyMap>();
+    ASSERT_EQ(items.size(), 2u);
+    EXPECT_DOUBLE_EQ(items[0].units().convertActivationEnergy(items[0]["Ea"], "J/kmol"),
+                     1000.0 * 4184.0);
+    EXPECT_DOUBLE_EQ(items[1].convert("A", "m^3/kmol/s"), 2.0e+13 * 1e-3);
+    EXPECT_DOUBLE_EQ(items[0].units().convertTo(1.0, "kmol"), 1e-3);
+
+    // Invalid data
+    EXPECT_THROW(AnyMap::fromBinaryString("name: test"), CanteraError);
+    EXPECT_THROW(AnyMap::fromBinaryString(data.substr(0, data.size() / 2)),
+                 CanteraError);
+    EXPECT_THROW(AnyMap::fromBinaryString(data + "x"), CanteraError);
+}
+
+TEST(AnyMap, binaryIntegers)
+{
+    // Integers are stored as 64-bit values, independent of the size of 'long'
+    AnyMap m;
+    m["ints"] = std::vector<long int>{1, -2};
+    m["nested"] = std::vector<std::vector<long int>>{{3}, {4, 5}};
+    std::string data = m.toBinaryString();
+    m["ints"] = std::vector<long int>{1, -2, 7};
+    m["nested"] = std::vector<std::vector<long int>>{{3}, {4, 5, 6}};
+    std::string data2 = m.toBinaryString();
+    EXPECT_EQ(data2.size() - data.size(), 2 * sizeof(int64_t));
+    AnyMap m2 = AnyMap::fromBinaryString(data2);
+    EXPECT_EQ(m2["ints"].asVector<long int>()[1], -2);
+    EXPECT_EQ(m2["nested"].asVector<std::vector<long int>>()[1][2], 6);
+
+    // An invalid number of entries fails without allocating memory for them.
+    // The number of entries follows the header and the line and column numbers.
+    size_t offset = 8 + sizeof(uint32_t) + sizeof(double) + 2 * sizeof(int32_t);
+    uint64_t n = std::numeric_limits<uint64_t>::max() / 2;
+    data.replace(offset, sizeof(n), reinterpret_cast<const char*>(&n), sizeof(n));
+    EXPECT_THROW(AnyMap::fromBinaryString(data), CanteraError);
+}
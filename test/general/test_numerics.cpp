@@ -1,5 +1,8 @@
 #include "gtest/gtest.h"
 #include "cantera/numerics/polyfit.h"
+#include "cantera/numerics/funcs.h"
+
+#include <cfloat>
 
 using namespace Cantera;
 
@@ -91,3 +94,77 @@ TEST(Polyfit, weighted)
         }
     }
 }
+
+TEST(VectorExp, accuracy)
+{
+    vector_fp x;
+    for (int i = -745; i <= 745; i++) {
+        x.push_back(0.937 * i);
+    }
+    x.push_back(-1e-12);
+    x.push_back(800.0);
+    x.push_back(-800.0);
+    vector_fp y(x.size());
+    vectorExp(x.data(), y.data(), x.size());
+    EXPECT_TRUE(std::isinf(y[x.size() - 2]));
+    EXPECT_EQ(y[x.size() - 1], 0.0);
+    for (size_t i = 0; i < x.size() - 2; i++) {
+        double ref = std::exp(x[i]);
+        EXPECT_NEAR(y[i], ref, 1e-14 * ref) << x[i];
+    }
+}
+
+TEST(VectorExp, subnormal)
+{
+    // results below DBL_MIN are the same as those of std::exp
+    vector_fp x;
+    for (int i = 0; i <= 100; i++) {
+        x.push_back(-750.0 + 0.5 * i);
+    }
+    vector_fp y(x.size());
+    vectorExp(x.data(), y.data(), x.size());
+    for (size_t i = 0; i < x.size(); i++) {
+        double ref = std::exp(x[i]);
+        if (ref < DBL_MIN) {
+            EXPECT_EQ(y[i], ref) << x[i];
+        } else {
+            EXPECT_NEAR(y[i], ref, 1e-14 * ref) << x[i];
+        }
+    }
+}
+
+TEST(VectorLog, accuracy)
+{
+    vector_fp x;
+    for (int i = -700; i <= 700; i++) {
+        x.push_back(std::pow(10.0, 0.437 * i));
+    }
+    for (int i = 0; i < 100; i++) {
+        x.push_back(0.7 + 0.0071 * i);
+    }
+    x.push_back(1.0);
+    x.push_back(0.0);
+    x.push_back(-1.0);
+    x.push_back(1e-310);
+    vector_fp y(x.size());
+    vectorLog(x.data(), y.data(), x.size());
+    size_t n = x.size();
+    EXPECT_EQ(y[n - 4], 0.0);
+    EXPECT_TRUE(std::isinf(y[n - 3]));
+    EXPECT_TRUE(std::isnan(y[n - 2]));
+    EXPECT_DOUBLE_EQ(y[n - 1], std::log(1e-310));
+    for (size_t i = 0; i < n - 4; i++) {
+        double ref = std::log(x[i]);
+        EXPECT_NEAR(y[i], ref, 4e-16 * std::max(std::abs(ref), 1.0)) << x[i];
+    }
+}
+
+TEST(VectorExp, in_place)
+{
+    vector_fp x{-3.0, -1.5, 0.0, 0.5, 2.0, 10.0, 100.0};
+    vector_fp y(x);
+    vectorExp(y.data(), y.data(), y.size());
+    for (size_t i = 0; i < x.size(); i++) {
+        EXPECT_NEAR(y[i], std::exp(x[i]), 1e-14 * std::exp(x[i]));
+    }
+}
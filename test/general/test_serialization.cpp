@@ -8,6 +8,8 @@
 #include "cantera/base/Solution.h"
 #include "cantera/kinetics.h"
 #include "cantera/transport/TransportData.h"
+#include "cantera/transport/TransportBase.h"
+#include <fstream>
 
 using namespace Cantera;
 using namespace YAML;
@@ -447,3 +449,97 @@ TEST(YamlWriter, customHeader)
               "Copy of H2O2 mechanism");
     ASSERT_EQ(soln->header()["spam"].asString(), "eggs");
 }
+
+TEST(compileMechanism, gasTransport)
+{
+    compileMechanism("gri30.yaml", "compiled-gri30.ctb", {"multicomponent"});
+    for (std::string model : {"", "multicomponent"}) {
+        auto original = newSolution("gri30.yaml", "gri30", model);
+        auto compiled = newSolution("compiled-gri30.ctb", "gri30", model);
+        ASSERT_EQ(compiled->kinetics()->nReactions(),
+                  original->kinetics()->nReactions());
+        auto tran1 = original->transport();
+        auto tran2 = compiled->transport();
+        EXPECT_EQ(tran2->transportType(), tran1->transportType());
+        // Stored fits are identical to the ones created from the YAML file
+        vector_fp c1(5), c2(5);
+        for (size_t k : {0, 13, 52}) {
+            tran1->getViscosityPolynomial(k, c1.data());
+            tran2->getViscosityPolynomial(k, c2.data());
+            EXPECT_EQ(c1, c2);
+            tran1->getBinDiffusivityPolynomial(k, 3, c1.data());
+            tran2->getBinDiffusivityPolynomial(k, 3, c2.data());
+            EXPECT_EQ(c1, c2);
+        }
+        for (auto soln : {original, compiled}) {
+            soln->thermo()->setState_TPX(1500, OneAtm, "CH4:1, O2:2, N2:7.52, OH:0.01");
+        }
+        size_t nsp = original->thermo()->nSpecies();
+        vector_fp wdot1(nsp), wdot2(nsp);
+        original->kinetics()->getNetProductionRates(wdot1.data());
+        compiled->kinetics()->getNetProductionRates(wdot2.data());
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_DOUBLE_EQ(wdot1[k], wdot2[k]);
+        }
+        EXPECT_DOUBLE_EQ(tran1->viscosity(), tran2->viscosity());
+        EXPECT_DOUBLE_EQ(tran1->thermalConductivity(),
+                         tran2->thermalConductivity());
+    }
+
+    // Phase definitions written from a compiled mechanism do not contain the
+    // stored fits
+    auto compiled = newSolution("compiled-gri30.ctb", "gri30");
+    EXPECT_FALSE(compiled->thermo()->parameters(true).hasKey("__transport-fits__"));
+    EXPECT_TRUE(compiled->thermo()->input().hasKey("__transport-fits__"));
+}
+
+TEST(compileMechanism, staleSource)
+{
+    auto original = newSolution("h2o2.yaml", "", "None");
+    YamlWriter writer;
+    writer.addPhase(original);
+    writer.toYamlFile("generated-h2o2-source.yaml");
+    compileMechanism("generated-h2o2-source.yaml", "compiled-h2o2.ctb");
+    auto compiled = newSolution("compiled-h2o2.ctb", "", "None");
+    EXPECT_EQ(compiled->kinetics()->nReactions(),
+              original->kinetics()->nReactions());
+    EXPECT_EQ(compiled->thermo()->speciesNames(),
+              original->thermo()->speciesNames());
+
+    // Modifying the source invalidates the compiled file
+    std::ofstream out("generated-h2o2-source.yaml", std::ios::app);
+    out << "\ndescription: modified\n";
+    out.close();
+    EXPECT_THROW(newSolution("compiled-h2o2.ctb", "", "None"), CanteraError);
+}
+
+TEST(compileMechanism, staleImport)
+{
+    // A phase importing its species and reactions from another file, which is
+    // found relative to the source
+    auto original = newSolution("h2o2.yaml", "", "None");
+    YamlWriter writer;
+    writer.addPhase(original);
+    writer.toYamlFile("generated-h2o2-imported.yaml");
+    std::ofstream src("generated-h2o2-importer.yaml");
+    src << "phases:\n"
+           "- name: gas\n"
+           "  thermo: ideal-gas\n"
+           "  elements: [O, H, N, Ar]\n"
+           "  species: [{generated-h2o2-imported.yaml/species: all}]\n"
+           "  kinetics: gas\n"
+           "  reactions: [generated-h2o2-imported.yaml/reactions]\n"
+           "  state: {T: 300.0, P: 1 atm}\n";
+    src.close();
+    compileMechanism("generated-h2o2-importer.yaml", "compiled-h2o2-importer.ctb");
+    auto compiled = newSolution("compiled-h2o2-importer.ctb", "", "None");
+    EXPECT_EQ(compiled->kinetics()->nReactions(),
+              original->kinetics()->nReactions());
+
+    // Modifying the imported file invalidates the compiled file
+    std::ofstream out("generated-h2o2-imported.yaml", std::ios::app);
+    out << "\ndescription: modified\n";
+    out.close();
+    EXPECT_THROW(newSolution("compiled-h2o2-importer.ctb", "", "None"),
+                 CanteraError);
+}
@@ -0,0 +1,192 @@
+// Kinetics manager generated by Cantera 2.6.0a3 for a mechanism with
+// 10 species and 29 reactions. Do not edit.
+
+#include "cantera/kinetics/GeneratedKinetics.h"
+#include "cantera/kinetics/KineticsFactory.h"
+
+namespace Cantera
+{
+
+class H2O2GeneratedKinetics : public GeneratedKinetics
+{
+public:
+    H2O2GeneratedKinetics(ThermoPhase* thermo=0) : GeneratedKinetics(thermo) {}
+
+protected:
+    virtual uint64_t generatedHash() const override {
+        return 17806688700898509341ull;
+    }
+
+    virtual void evalArrheniusRates(double logT, double recipT,
+                                    double* kf) const override {
+        kf[0] = 120000000000.00002 * std::exp(-logT);
+        kf[1] = 500000000000.00012 * std::exp(-logT);
+        kf[2] = 38.700000000000003 * std::exp(2.7000000000000002 * logT - 3150.1542797022735 * recipT);
+        kf[3] = 20000000000.000004;
+        kf[4] = 9630.0 * std::exp(2.0 * logT - 2012.8781339950629 * recipT);
+        kf[5] = 2800000000000.0005 * std::exp(-0.85999999999999999 * logT);
+        kf[6] = 20800000000000.004 * std::exp(-1.24 * logT);
+        kf[7] = 11260000000000.002 * std::exp(-0.76000000000000001 * logT);
+        kf[8] = 26000000000000.004 * std::exp(-1.24 * logT);
+        kf[9] = 700000000000.00012 * std::exp(-0.80000000000000004 * logT);
+        kf[10] = 26500000000000.004 * std::exp(-0.67069999999999996 * logT - 8575.364070352467 * recipT);
+        kf[11] = 1000000000000.0002 * std::exp(-logT);
+        kf[12] = 90000000000.000015 * std::exp(-0.59999999999999998 * logT);
+        kf[13] = 60000000000000.008 * std::exp(-1.25 * logT);
+        kf[14] = 22000000000000004.0 * std::exp(-2.0 * logT);
+        kf[15] = 3970000000.0000005 * std::exp(-337.66030697767184 * recipT);
+        kf[16] = 44800000000.000008 * std::exp(-537.43846177668183 * recipT);
+        kf[17] = 84000000000.000015 * std::exp(-319.54440377171625 * recipT);
+        kf[18] = 12100.000000000002 * std::exp(2.0 * logT - 2616.741574193582 * recipT);
+        kf[19] = 10000000000.000002 * std::exp(-1811.5903205955567 * recipT);
+        kf[20] = 216000.00000000003 * std::exp(1.51 * logT - 1726.0429999007665 * recipT);
+        kf[22] = 35.700000000000003 * std::exp(2.3999999999999999 * logT + 1061.7932156823956 * recipT);
+        kf[23] = 14500000000.000002 * std::exp(251.60976674938286 * recipT);
+        kf[24] = 2000000000.0000002 * std::exp(-214.87474080397297 * recipT);
+        kf[25] = 1700000000000000.2 * std::exp(-14799.686480198701 * recipT);
+        kf[26] = 130000000.00000001 * std::exp(820.24783960298817 * recipT);
+        kf[27] = 420000000000.00006 * std::exp(-6038.6344019851886 * recipT);
+        kf[28] = 5000000000000.001 * std::exp(-8720.794515533611 * recipT);
+    }
+
+    virtual void evalThirdBodyConcentrations(const double* conc, double ctot,
+                                             double* concm) const override {
+        concm[0] = ctot - 0.17000000000000004 * conc[8] + 1.3999999999999999 * conc[0] + 14.4 * conc[5];
+        concm[1] = ctot - 0.30000000000000004 * conc[8] + conc[0] + 5.0 * conc[5];
+        concm[5] = ctot - conc[8] - conc[5] - conc[9] - conc[3];
+        concm[6] = conc[3];
+        concm[7] = conc[5];
+        concm[8] = conc[9];
+        concm[9] = conc[8];
+        concm[11] = ctot - 0.37 * conc[8] - conc[0] - conc[5];
+        concm[12] = conc[0];
+        concm[13] = conc[5];
+        concm[14] = ctot - 0.62 * conc[8] - 0.27000000000000002 * conc[0] + 2.6499999999999999 * conc[5];
+        concm[21] = ctot - 0.30000000000000004 * conc[8] + conc[0] + 5.0 * conc[5];
+    }
+
+    virtual void evalEquilibriumConstants(const double* g0_RT,
+                                          double logStandConc,
+                                          double* rkc) const override {
+        rkc[0] = std::min(std::exp(-2.0 * g0_RT[2] + g0_RT[3] + logStandConc), BigNumber);
+        rkc[1] = std::min(std::exp(-g0_RT[1] - g0_RT[2] + g0_RT[4] + logStandConc), BigNumber);
+        rkc[2] = std::min(std::exp(-g0_RT[0] + g0_RT[1] - g0_RT[2] + g0_RT[4]), BigNumber);
+        rkc[3] = std::min(std::exp(-g0_RT[2] + g0_RT[3] + g0_RT[4] - g0_RT[6]), BigNumber);
+        rkc[4] = std::min(std::exp(-g0_RT[2] + g0_RT[4] + g0_RT[6] - g0_RT[7]), BigNumber);
+        rkc[5] = std::min(std::exp(-g0_RT[1] - g0_RT[3] + g0_RT[6] + logStandConc), BigNumber);
+        rkc[6] = std::min(std::exp(-g0_RT[1] - g0_RT[3] + g0_RT[6] + logStandConc), BigNumber);
+        rkc[7] = std::min(std::exp(-g0_RT[1] - g0_RT[3] + g0_RT[6] + logStandConc), BigNumber);
+        rkc[8] = std::min(std::exp(-g0_RT[1] - g0_RT[3] + g0_RT[6] + logStandConc), BigNumber);
+        rkc[9] = std::min(std::exp(-g0_RT[1] - g0_RT[3] + g0_RT[6] + logStandConc), BigNumber);
+        rkc[10] = std::min(std::exp(-g0_RT[1] + g0_RT[2] - g0_RT[3] + g0_RT[4]), BigNumber);
+        rkc[11] = std::min(std::exp(g0_RT[0] - 2.0 * g0_RT[1] + logStandConc), BigNumber);
+        rkc[12] = std::min(std::exp(g0_RT[0] - 2.0 * g0_RT[1] + logStandConc), BigNumber);
+        rkc[13] = std::min(std::exp(g0_RT[0] - 2.0 * g0_RT[1] + logStandConc), BigNumber);
+        rkc[14] = std::min(std::exp(-g0_RT[1] - g0_RT[4] + g0_RT[5] + logStandConc), BigNumber);
+        rkc[15] = std::min(std::exp(-g0_RT[1] + g0_RT[2] + g0_RT[5] - g0_RT[6]), BigNumber);
+        rkc[16] = std::min(std::exp(g0_RT[0] - g0_RT[1] + g0_RT[3] - g0_RT[6]), BigNumber);
+        rkc[17] = std::min(std::exp(-g0_RT[1] + 2.0 * g0_RT[4] - g0_RT[6]), BigNumber);
+        rkc[18] = std::min(std::exp(g0_RT[0] - g0_RT[1] + g0_RT[6] - g0_RT[7]), BigNumber);
+        rkc[19] = std::min(std::exp(-g0_RT[1] + g0_RT[4] + g0_RT[5] - g0_RT[7]), BigNumber);
+        rkc[20] = std::min(std::exp(-g0_RT[0] + g0_RT[1] - g0_RT[4] + g0_RT[5]), BigNumber);
+        rkc[21] = std::min(std::exp(-2.0 * g0_RT[4] + g0_RT[7] + logStandConc), BigNumber);
+        rkc[22] = std::min(std::exp(g0_RT[2] - 2.0 * g0_RT[4] + g0_RT[5]), BigNumber);
+        rkc[23] = std::min(std::exp(g0_RT[3] - g0_RT[4] + g0_RT[5] - g0_RT[6]), BigNumber);
+        rkc[24] = std::min(std::exp(-g0_RT[4] + g0_RT[5] + g0_RT[6] - g0_RT[7]), BigNumber);
+        rkc[25] = std::min(std::exp(-g0_RT[4] + g0_RT[5] + g0_RT[6] - g0_RT[7]), BigNumber);
+        rkc[26] = std::min(std::exp(g0_RT[3] - 2.0 * g0_RT[6] + g0_RT[7]), BigNumber);
+        rkc[27] = std::min(std::exp(g0_RT[3] - 2.0 * g0_RT[6] + g0_RT[7]), BigNumber);
+        rkc[28] = std::min(std::exp(g0_RT[3] - g0_RT[4] + g0_RT[5] - g0_RT[6]), BigNumber);
+    }
+
+    virtual void evalRatesOfProgress(const double* c, const double* concm,
+                                     double* ropf, double* ropr) const override {
+        ropf[0] *= concm[0] * c[2] * c[2];
+        ropr[0] *= concm[0] * c[3];
+        ropf[1] *= concm[1] * c[1] * c[2];
+        ropr[1] *= concm[1] * c[4];
+        ropf[2] *= c[0] * c[2];
+        ropr[2] *= c[1] * c[4];
+        ropf[3] *= c[2] * c[6];
+        ropr[3] *= c[3] * c[4];
+        ropf[4] *= c[2] * c[7];
+        ropr[4] *= c[4] * c[6];
+        ropf[5] *= concm[5] * c[1] * c[3];
+        ropr[5] *= concm[5] * c[6];
+        ropf[6] *= concm[6] * c[1] * c[3];
+        ropr[6] *= concm[6] * c[6];
+        ropf[7] *= concm[7] * c[1] * c[3];
+        ropr[7] *= concm[7] * c[6];
+        ropf[8] *= concm[8] * c[1] * c[3];
+        ropr[8] *= concm[8] * c[6];
+        ropf[9] *= concm[9] * c[1] * c[3];
+        ropr[9] *= concm[9] * c[6];
+        ropf[10] *= c[1] * c[3];
+        ropr[10] *= c[2] * c[4];
+        ropf[11] *= concm[11] * c[1] * c[1];
+        ropr[11] *= concm[11] * c[0];
+        ropf[12] *= concm[12] * c[1] * c[1];
+        ropr[12] *= concm[12] * c[0];
+        ropf[13] *= concm[13] * c[1] * c[1];
+        ropr[13] *= concm[13] * c[0];
+        ropf[14] *= concm[14] * c[1] * c[4];
+        ropr[14] *= concm[14] * c[5];
+        ropf[15] *= c[1] * c[6];
+        ropr[15] *= c[2] * c[5];
+        ropf[16] *= c[1] * c[6];
+        ropr[16] *= c[0] * c[3];
+        ropf[17] *= c[1] * c[6];
+        ropr[17] *= c[4] * c[4];
+        ropf[18] *= c[1] * c[7];
+        ropr[18] *= c[0] * c[6];
+        ropf[19] *= c[1] * c[7];
+        ropr[19] *= c[4] * c[5];
+        ropf[20] *= c[0] * c[4];
+        ropr[20] *= c[1] * c[5];
+        ropf[21] *= c[4] * c[4];
+        ropr[21] *= c[7];
+        ropf[22] *= c[4] * c[4];
+        ropr[22] *= c[2] * c[5];
+        ropf[23] *= c[4] * c[6];
+        ropr[23] *= c[3] * c[5];
+        ropf[24] *= c[4] * c[7];
+        ropr[24] *= c[5] * c[6];
+        ropf[25] *= c[4] * c[7];
+        ropr[25] *= c[5] * c[6];
+        ropf[26] *= c[6] * c[6];
+        ropr[26] *= c[3] * c[7];
+        ropf[27] *= c[6] * c[6];
+        ropr[27] *= c[3] * c[7];
+        ropf[28] *= c[4] * c[6];
+        ropr[28] *= c[3] * c[5];
+    }
+
+    virtual void evalNetProductionRates(const double* ropnet,
+                                        double* wdot) const override {
+        wdot[0] = -ropnet[2] + ropnet[11] + ropnet[12] + ropnet[13] + ropnet[16] + ropnet[18] - ropnet[20];
+        wdot[1] = -ropnet[1] + ropnet[2] - ropnet[5] - ropnet[6] - ropnet[7] - ropnet[8] - ropnet[9] - ropnet[10] - 2.0 * ropnet[11] - 2.0 * ropnet[12] - 2.0 * ropnet[13] - ropnet[14] - ropnet[15] - ropnet[16] - ropnet[17] - ropnet[18] - ropnet[19] + ropnet[20];
+        wdot[2] = -2.0 * ropnet[0] - ropnet[1] - ropnet[2] - ropnet[3] - ropnet[4] + ropnet[10] + ropnet[15] + ropnet[22];
+        wdot[3] = ropnet[0] + ropnet[3] - ropnet[5] - ropnet[6] - ropnet[7] - ropnet[8] - ropnet[9] - ropnet[10] + ropnet[16] + ropnet[23] + ropnet[26] + ropnet[27] + ropnet[28];
+        wdot[4] = ropnet[1] + ropnet[2] + ropnet[3] + ropnet[4] + ropnet[10] - ropnet[14] + 2.0 * ropnet[17] + ropnet[19] - ropnet[20] - 2.0 * ropnet[21] - 2.0 * ropnet[22] - ropnet[23] - ropnet[24] - ropnet[25] - ropnet[28];
+        wdot[5] = ropnet[14] + ropnet[15] + ropnet[19] + ropnet[20] + ropnet[22] + ropnet[23] + ropnet[24] + ropnet[25] + ropnet[28];
+        wdot[6] = -ropnet[3] + ropnet[4] + ropnet[5] + ropnet[6] + ropnet[7] + ropnet[8] + ropnet[9] - ropnet[15] - ropnet[16] - ropnet[17] + ropnet[18] - ropnet[23] + ropnet[24] + ropnet[25] - 2.0 * ropnet[26] - 2.0 * ropnet[27] - ropnet[28];
+        wdot[7] = -ropnet[4] - ropnet[18] - ropnet[19] + ropnet[21] - ropnet[24] - ropnet[25] + ropnet[26] + ropnet[27];
+        wdot[8] = 0.0;
+        wdot[9] = 0.0;
+    }
+};
+
+namespace {
+
+//! Register the generated class with the KineticsFactory when loaded
+struct H2O2GeneratedKineticsRegistration
+{
+    H2O2GeneratedKineticsRegistration() {
+        KineticsFactory::factory()->reg("h2o2-generated",
+            []() { return new H2O2GeneratedKinetics(); });
+    }
+} s_H2O2GeneratedKineticsRegistration;
+
+}
+
+}
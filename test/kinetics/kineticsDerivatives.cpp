@@ -0,0 +1,590 @@
+#include "gtest/gtest.h"
+#include "cantera/base/Solution.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/kinetics/ReactionFactory.h"
+#include "cantera/kinetics/Arrhenius.h"
+#include "cantera/kinetics/ImplicitSurfChem.h"
+#include "cantera/kinetics/solveSP.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/thermo/SurfPhase.h"
+
+using namespace Cantera;
+
+class KineticsDerivatives : public testing::Test
+{
+public:
+    void setup(const std::string& infile, const std::string& X) {
+        sol = newSolution(infile, "", "None");
+        gas = sol->thermo();
+        kin = sol->kinetics();
+        nr = kin->nReactions();
+        nk = gas->nSpecies();
+        // ensure that all species are present so central differences are valid
+        gas->setMoleFractionsByName(X);
+        vector_fp moleFractions(nk);
+        gas->getMoleFractions(moleFractions.data());
+        for (auto& x : moleFractions) {
+            x += 1e-4;
+        }
+        gas->setState_TPX(1200, 2 * OneAtm, moleFractions.data());
+    }
+
+    //! Compare analytic derivatives with respect to concentrations against
+    //! central finite differences of net rates of progress
+    void checkConcentrationDerivatives(double rtol) {
+        Eigen::SparseMatrix<double> jac = kin->netRatesOfProgress_ddC();
+        ASSERT_EQ(jac.rows(), static_cast<int>(nr));
+        ASSERT_EQ(jac.cols(), static_cast<int>(nk));
+        Eigen::MatrixXd dense = jac;
+
+        vector_fp conc(nk), ropf(nr), ropr(nr), ropp(nr), ropm(nr);
+        gas->getConcentrations(conc.data());
+        kin->getFwdRatesOfProgress(ropf.data());
+        kin->getRevRatesOfProgress(ropr.data());
+        for (size_t k = 0; k < nk; k++) {
+            double c0 = conc[k];
+            double dc = 1e-6 * c0;
+            conc[k] = c0 + dc;
+            gas->setConcentrations(conc.data());
+            kin->getNetRatesOfProgress(ropp.data());
+            conc[k] = c0 - dc;
+            gas->setConcentrations(conc.data());
+            kin->getNetRatesOfProgress(ropm.data());
+            conc[k] = c0;
+            gas->setConcentrations(conc.data());
+            for (size_t i = 0; i < nr; i++) {
+                double fd = (ropp[i] - ropm[i]) / (2 * dc);
+                // allow for round-off in the finite difference approximation
+                double noise = 1e-12 * (std::abs(ropf[i]) + std::abs(ropr[i])) / dc;
+                EXPECT_NEAR(dense(i, k), fd, rtol * std::abs(fd) + noise)
+                    << "reaction " << i << ", species " << k;
+            }
+        }
+    }
+
+    //! Compare temperature derivatives against central finite differences at
+    //! constant concentrations
+    void checkTemperatureDerivatives(double rtol) {
+        vector_fp drop(nr), ropf(nr), ropr(nr), ropp(nr), ropm(nr);
+        vector_fp dwdot(nk), wdotp(nk), wdotm(nk);
+        kin->getFwdRatesOfProgress(ropf.data());
+        kin->getRevRatesOfProgress(ropr.data());
+        kin->getNetRatesOfProgress_ddT(drop.data());
+        kin->getNetProductionRates_ddT(dwdot.data());
+
+        double T = gas->temperature();
+        double dT = 1e-5 * T;
+        gas->setTemperature(T + dT);
+        kin->getNetRatesOfProgress(ropp.data());
+        kin->getNetProductionRates(wdotp.data());
+        gas->setTemperature(T - dT);
+        kin->getNetRatesOfProgress(ropm.data());
+        kin->getNetProductionRates(wdotm.data());
+        gas->setTemperature(T);
+        for (size_t i = 0; i < nr; i++) {
+            double fd = (ropp[i] - ropm[i]) / (2 * dT);
+            // forward and reverse contributions may cancel
+            double noise = 1e-9 * (std::abs(ropf[i]) + std::abs(ropr[i])) / T;
+            EXPECT_NEAR(drop[i], fd, rtol * std::abs(fd) + noise)
+                << "reaction " << i;
+        }
+        double wmax = 0.0;
+        for (size_t k = 0; k < nk; k++) {
+            wmax = std::max(wmax, std::abs((wdotp[k] - wdotm[k]) / (2 * dT)));
+        }
+        for (size_t k = 0; k < nk; k++) {
+            double fd = (wdotp[k] - wdotm[k]) / (2 * dT);
+            EXPECT_NEAR(dwdot[k], fd, rtol * wmax) << "species " << k;
+        }
+    }
+
+protected:
+    shared_ptr<Solution> sol;
+    shared_ptr<ThermoPhase> gas;
+    shared_ptr<Kinetics> kin;
+    size_t nr, nk;
+};
+
+TEST_F(KineticsDerivatives, gri30)
+{
+    setup("gri30.yaml",
+          "CH4:0.1, O2:0.2, H2O:0.1, CO2:0.05, H:0.01, O:0.01, OH:0.02, "
+          "HO2:0.001, CH3:0.005, CO:0.02, H2:0.02, N2:0.4, AR:0.05, CH2O:0.003");
+    checkConcentrationDerivatives(1e-4);
+    checkTemperatureDerivatives(1e-4);
+}
+
+TEST_F(KineticsDerivatives, pdep)
+{
+    setup("pdep-test.yaml",
+          "H:0.1, R1A:0.1, R1B:0.1, R2:0.1, R3:0.1, R4:0.1, R5:0.1, R6:0.1, "
+          "R7:0.1, P1:0.02, P2A:0.02, P3A:0.02, P4:0.02, P5A:0.02, P6A:0.02, "
+          "P7A:0.02");
+    checkConcentrationDerivatives(1e-4);
+    checkTemperatureDerivatives(1e-4);
+}
+
+TEST_F(KineticsDerivatives, netProductionRates)
+{
+    setup("h2o2.yaml", "H2:0.2, O2:0.3, H2O:0.1, H:0.02, O:0.03, OH:0.05, AR:0.3");
+    Eigen::SparseMatrix<double> jac = kin->netProductionRates_ddC();
+    ASSERT_EQ(jac.rows(), static_cast<int>(nk));
+    ASSERT_EQ(jac.cols(), static_cast<int>(nk));
+    Eigen::MatrixXd dense = jac;
+
+    vector_fp conc(nk), wdot0(nk), wdotp(nk), wdotm(nk);
+    gas->getConcentrations(conc.data());
+    kin->getNetProductionRates(wdot0.data());
+    double wmax = 0.0;
+    for (size_t k = 0; k < nk; k++) {
+        wmax = std::max(wmax, std::abs(wdot0[k]));
+    }
+    for (size_t j = 0; j < nk; j++) {
+        double c0 = conc[j];
+        double dc = 1e-6 * c0;
+        conc[j] = c0 + dc;
+        gas->setConcentrations(conc.data());
+        kin->getNetProductionRates(wdotp.data());
+        conc[j] = c0 - dc;
+        gas->setConcentrations(conc.data());
+        kin->getNetProductionRates(wdotm.data());
+        conc[j] = c0;
+        gas->setConcentrations(conc.data());
+        for (size_t k = 0; k < nk; k++) {
+            double fd = (wdotp[k] - wdotm[k]) / (2 * dc);
+            EXPECT_NEAR(dense(k, j), fd, 1e-4 * std::abs(fd) + 1e-12 * wmax / dc);
+        }
+    }
+
+    // Neglecting third-body terms removes fully populated rows
+    AnyMap settings;
+    settings["skip-third-bodies"] = true;
+    kin->setDerivativeSettings(settings);
+    Eigen::SparseMatrix<double> jac2 = kin->netRatesOfProgress_ddC();
+    settings["skip-third-bodies"] = false;
+    kin->setDerivativeSettings(settings);
+    EXPECT_GT(kin->netRatesOfProgress_ddC().nonZeros(), jac2.nonZeros());
+
+    AnyMap current;
+    kin->getDerivativeSettings(current);
+    EXPECT_FALSE(current["skip-third-bodies"].asBool());
+}
+
+TEST_F(KineticsDerivatives, falloffTypes)
+{
+    setup("h2o2.yaml", "H2:0.2, O2:0.3, H2O:0.1, H:0.02, O:0.03, OH:0.05, "
+          "HO2:0.01, H2O2:0.01, AR:0.28");
+    std::vector<std::string> reactions = {
+        "{equation: H + O2 (+M) <=> HO2 (+M), type: falloff,"
+        " low-P-rate-constant: {A: 6.366e+20, b: -1.72, Ea: 524.8},"
+        " high-P-rate-constant: {A: 4.65e+12, b: 0.44, Ea: 0.0},"
+        " SRI: {A: 1.1, B: 700.0, C: 1234.0, D: 56.0, E: 0.7}}",
+        "{equation: 2 OH (+M) <=> H2O2 (+M), type: falloff,"
+        " low-P-rate-constant: {A: 2.3e+18, b: -0.9, Ea: -1700.0},"
+        " high-P-rate-constant: {A: 7.4e+13, b: -0.37, Ea: 0.0},"
+        " Tsang: {A: 0.95, B: -1.0e-04}}",
+        "{equation: O + OH (+M) <=> HO2 (+M), type: chemically-activated,"
+        " low-P-rate-constant: {A: 2.82e+12, b: 0.3, Ea: 1500.0},"
+        " high-P-rate-constant: {A: 6.83e+09, b: 0.7, Ea: 900.0},"
+        " Troe: {A: 0.56, T3: 93.0, T1: 1200.0, T2: 4900.0}}",
+        "{equation: H + OH (+M) <=> H2O (+M), type: falloff,"
+        " low-P-rate-constant: {A: 4.0e+22, b: -2.0, Ea: 0.0},"
+        " high-P-rate-constant: {A: 1.0e+14, b: 0.0, Ea: 0.0}}",
+    };
+    for (auto& yaml : reactions) {
+        AnyMap rxn = AnyMap::fromYamlString(yaml);
+        kin->addReaction(newReaction(rxn, *kin));
+    }
+    nr = kin->nReactions();
+    checkTemperatureDerivatives(1e-6);
+}
+
+TEST_F(KineticsDerivatives, absentCollider)
+{
+    // The only collider of 'H + O2 + N2 <=> HO2 + N2' is absent, such that its
+    // effective third-body concentration vanishes
+    setup("h2o2.yaml", "H2:0.2, O2:0.3, H2O:0.1, H:0.02, O:0.03, OH:0.05, AR:0.3");
+    size_t kN2 = gas->speciesIndex("N2");
+    gas->setState_TPY(1200, 2 * OneAtm, "H2:0.2, O2:0.3, H2O:0.1, H:0.02, "
+                      "O:0.03, OH:0.05, HO2:0.01, H2O2:0.01, AR:0.3");
+    Eigen::SparseMatrix<double> jac = kin->netRatesOfProgress_ddC();
+
+    // forward differences, as the concentration of N2 cannot be decreased
+    vector_fp conc(nk), ropf(nr), ropr(nr), rop0(nr), rop1(nr);
+    gas->getConcentrations(conc.data());
+    kin->getFwdRatesOfProgress(ropf.data());
+    kin->getRevRatesOfProgress(ropr.data());
+    kin->getNetRatesOfProgress(rop0.data());
+    double dc = 1e-8 * gas->molarDensity();
+    conc[kN2] = dc;
+    gas->setConcentrations(conc.data());
+    kin->getNetRatesOfProgress(rop1.data());
+    double fdmax = 0.0;
+    for (size_t i = 0; i < nr; i++) {
+        double fd = (rop1[i] - rop0[i]) / dc;
+        double noise = 1e-12 * (std::abs(ropf[i]) + std::abs(ropr[i])) / dc;
+        EXPECT_NEAR(jac.coeff(i, kN2), fd, 1e-5 * std::abs(fd) + noise)
+            << kin->reactionString(i);
+        fdmax = std::max(fdmax, std::abs(fd));
+    }
+    EXPECT_GT(fdmax, 0.0);
+}
+
+TEST_F(KineticsDerivatives, BlowersMaselRate)
+{
+    BlowersMaselRate rate(3.87e1, 2.7, 2.6e7, 4.0e8);
+    double T = 1200.;
+    double dT = 1e-6 * T;
+    for (double dH : {-2e8, -1e7, 3e7, 2e8}) {
+        // derivatives are evaluated at constant enthalpy of reaction
+        rate.setDeltaH(dH);
+        double fd = (rate.eval(T + dT) - rate.eval(T - dT)) / (2 * dT);
+        EXPECT_NEAR(rate.ddT(T), fd, 1e-7 * std::abs(fd)) << dH;
+    }
+}
+
+TEST_F(KineticsDerivatives, legacy)
+{
+    setup("h2o2.yaml", "H2:0.2, O2:0.3, H2O:0.1, H:0.02, O:0.03, OH:0.05, "
+          "HO2:0.01, H2O2:0.01, AR:0.28");
+    std::vector<std::string> reactions = {
+        "{equation: H + O2 <=> O + OH, type: elementary-legacy,"
+        " rate-constant: [3.52e+13, -0.7, 17069.79]}",
+        "{equation: 2 O + M <=> O2 + M, type: three-body-legacy,"
+        " rate-constant: {A: 1.2e+17, b: -1.0, Ea: 0.0},"
+        " efficiencies: {AR: 0.83, H2: 2.4, H2O: 15.4}}",
+        "{equation: 2 OH (+M) <=> H2O2 (+M), type: falloff-legacy,"
+        " low-P-rate-constant: {A: 2.3e+18, b: -0.9, Ea: -1700.0},"
+        " high-P-rate-constant: {A: 7.4e+13, b: -0.37, Ea: 0.0},"
+        " Troe: {A: 0.7346, T3: 94.0, T1: 1756.0, T2: 5182.0},"
+        " efficiencies: {AR: 0.7, H2: 2.0, H2O: 6.0}}",
+        "{equation: H + O2 (+M) <=> HO2 (+M), type: falloff-legacy,"
+        " low-P-rate-constant: {A: 6.366e+20, b: -1.72, Ea: 524.8},"
+        " high-P-rate-constant: {A: 4.65e+12, b: 0.44, Ea: 0.0},"
+        " SRI: {A: 1.1, B: 700.0, C: 1234.0, D: 56.0, E: 0.7}}",
+        "{equation: O + OH (+M) <=> HO2 (+M), type: chemically-activated-legacy,"
+        " low-P-rate-constant: {A: 2.82e+12, b: 0.3, Ea: 1500.0},"
+        " high-P-rate-constant: {A: 6.83e+09, b: 0.7, Ea: 900.0},"
+        " Troe: {A: 0.56, T3: 93.0, T1: 1200.0, T2: 4900.0}}",
+        "{equation: H2 + O2 <=> 2 OH, type: pressure-dependent-Arrhenius-legacy,"
+        " rate-constants: [{P: 0.1 atm, A: 1.2e+13, b: 0.5, Ea: 11000.0},"
+        " {P: 1.0 atm, A: 4.9e+14, b: 0.1, Ea: 15000.0},"
+        " {P: 1.0 atm, A: 1.2e+10, b: 1.2, Ea: 9000.0},"
+        " {P: 10.0 atm, A: 3.2e+15, b: -0.2, Ea: 16000.0}]}",
+        "{equation: HO2 <=> OH + O, type: Chebyshev-legacy,"
+        " temperature-range: [290.0, 3000.0],"
+        " pressure-range: [0.0098692326671601 atm, 98.692326671601 atm],"
+        " data: [[8.2883, -1.1397, -0.12059, 0.016034],"
+        " [1.9764, 1.0037, 7.2865e-03, -0.030432],"
+        " [0.3177, 0.26889, 0.094806, -7.6385e-03]]}",
+    };
+    for (auto& yaml : reactions) {
+        AnyMap rxn = AnyMap::fromYamlString(yaml);
+        kin->addReaction(newReaction(rxn, *kin));
+    }
+    nr = kin->nReactions();
+
+    // Temperature derivatives are available for legacy reaction types, while
+    // derivatives with respect to concentrations are not
+    checkTemperatureDerivatives(1e-6);
+    EXPECT_THROW(kin->netRatesOfProgress_ddC(), NotImplementedError);
+}
+
+TEST_F(KineticsDerivatives, legacyFalloffLast)
+{
+    // work arrays for legacy falloff reactions need to be sized correctly
+    // when a falloff reaction is the last reaction added
+    setup("h2o2.yaml", "H2:0.2, O2:0.3, H2O:0.1, H:0.02, O:0.03, OH:0.05, "
+          "HO2:0.01, H2O2:0.01, AR:0.28");
+    AnyMap rxn = AnyMap::fromYamlString(
+        "{equation: 2 OH (+M) <=> H2O2 (+M), type: falloff-legacy,"
+        " low-P-rate-constant: {A: 2.3e+18, b: -0.9, Ea: -1700.0},"
+        " high-P-rate-constant: {A: 7.4e+13, b: -0.37, Ea: 0.0},"
+        " Troe: {A: 0.7346, T3: 94.0, T1: 1756.0, T2: 5182.0},"
+        " efficiencies: {AR: 0.7, H2: 2.0, H2O: 6.0}}");
+    kin->addReaction(newReaction(rxn, *kin));
+    nr = kin->nReactions();
+    vector_fp drop(nr);
+    kin->getFwdRatesOfProgress_ddT(drop.data());
+    EXPECT_NE(drop[nr - 1], 0.0);
+    checkTemperatureDerivatives(1e-6);
+}
+
+TEST(InterfaceKineticsDerivatives, coverageDependence)
+{
+    auto gas = newSolution("ptcombust.yaml", "gas", "None");
+    auto surf = newSolution("ptcombust.yaml", "Pt_surf", "None", {gas});
+    auto& kin = *surf->kinetics();
+    std::vector<std::string> reactions = {
+        "{equation: H(S) + O(S) <=> OH(S) + PT(S),"
+        " rate-constant: {A: 3.7e+19, b: 0.5, Ea: 1.15e+07},"
+        " coverage-dependencies: {O(S): {a: 0.5, m: 1.2, E: -6.0e+06},"
+        " H(S): {a: -0.2, m: 0.0, E: 1.0e+06}}}",
+        "{equation: O2 + 2 PT(S) => 2 O(S),"
+        " sticking-coefficient: {A: 0.3, b: 0, Ea: 0}, Motz-Wise: true,"
+        " coverage-dependencies: {O(S): {a: 0.3, m: -0.5, E: 5.0e+06}}}",
+        "{equation: CO(S) + O(S) => CO2 + 2 PT(S), type: Blowers-Masel,"
+        " rate-constant: {A: 3.7e+19, b: 0, Ea0: 1.05e+08, w: 1.0e+09},"
+        " coverage-dependencies: {CO(S): {a: 0.1, m: 0.5, E: -3.3e+07}}}",
+    };
+    for (auto& yaml : reactions) {
+        AnyMap rxn = AnyMap::fromYamlString(yaml);
+        kin.addReaction(newReaction(rxn, kin));
+    }
+    size_t nr = kin.nReactions();
+    size_t nk = kin.nTotalSpecies();
+
+    auto surfPhase = std::dynamic_pointer_cast<SurfPhase>(surf->thermo());
+    auto gasPhase = gas->thermo();
+    // ensure that all species are present so central differences are valid
+    gasPhase->setMoleFractionsByName("H2:0.1, O2:0.2, CO:0.1, CO2:0.05, "
+        "H2O:0.1, OH:0.01, H:0.01, O:0.01, CH4:0.1, AR:0.32");
+    vector_fp X(gasPhase->nSpecies());
+    gasPhase->getMoleFractions(X.data());
+    for (auto& x : X) {
+        x += 1e-4;
+    }
+    gasPhase->setState_TPX(900, OneAtm, X.data());
+    surfPhase->setState_TP(900, OneAtm);
+    vector_fp theta(surfPhase->nSpecies(), 1e-3);
+    theta[surfPhase->speciesIndex("PT(S)")] = 0.3;
+    theta[surfPhase->speciesIndex("H(S)")] = 0.1;
+    theta[surfPhase->speciesIndex("O(S)")] = 0.2;
+    theta[surfPhase->speciesIndex("OH(S)")] = 0.05;
+    theta[surfPhase->speciesIndex("CO(S)")] = 0.25;
+    surfPhase->setCoverages(theta.data());
+
+    Eigen::SparseMatrix<double> jac = kin.netRatesOfProgress_ddC();
+    ASSERT_EQ(jac.rows(), static_cast<int>(nr));
+    ASSERT_EQ(jac.cols(), static_cast<int>(nk));
+    Eigen::MatrixXd dense = jac;
+
+    vector_fp ropf(nr), ropr(nr), ropp(nr), ropm(nr);
+    kin.getFwdRatesOfProgress(ropf.data());
+    kin.getRevRatesOfProgress(ropr.data());
+    for (size_t n = 0; n < kin.nPhases(); n++) {
+        ThermoPhase& phase = kin.thermo(n);
+        vector_fp conc(phase.nSpecies());
+        phase.getConcentrations(conc.data());
+        for (size_t k = 0; k < phase.nSpecies(); k++) {
+            double c0 = conc[k];
+            double dc = 1e-6 * c0;
+            conc[k] = c0 + dc;
+            phase.setConcentrations(conc.data());
+            kin.getNetRatesOfProgress(ropp.data());
+            conc[k] = c0 - dc;
+            phase.setConcentrations(conc.data());
+            kin.getNetRatesOfProgress(ropm.data());
+            conc[k] = c0;
+            phase.setConcentrations(conc.data());
+            size_t kk = kin.kineticsSpeciesIndex(k, n);
+            for (size_t i = 0; i < nr; i++) {
+                double fd = (ropp[i] - ropm[i]) / (2 * dc);
+                double noise = 1e-12 * (std::abs(ropf[i]) + std::abs(ropr[i])) / dc;
+                EXPECT_NEAR(dense(i, kk), fd, 1e-5 * std::abs(fd) + noise)
+                    << "reaction " << i << ", species " << kin.kineticsSpeciesName(kk);
+            }
+        }
+    }
+
+    // Derivatives of net production rates are consistent
+    Eigen::MatrixXd dwdot = kin.netProductionRates_ddC();
+    Eigen::MatrixXd stoich = kin.productStoichCoeffs() - kin.reactantStoichCoeffs();
+    EXPECT_NEAR((dwdot - stoich * dense).norm(), 0.0, 1e-12 * dwdot.norm());
+}
+
+//! Two surface phases with a species occupying two sites on the same gas
+class SurfaceProblem : public testing::Test
+{
+public:
+    SurfaceProblem() {
+        gas = newSolution("surface-multisite.yaml", "gas", "None");
+        for (size_t n = 0; n < 2; n++) {
+            surf.push_back(newSolution("surface-multisite.yaml", "Pt-surf",
+                                       "None", {gas}));
+            kin.push_back(dynamic_cast<InterfaceKinetics*>(
+                surf.back()->kinetics().get()));
+        }
+        gas->thermo()->setState_TP(800, OneAtm);
+        for (auto& s : surf) {
+            s->thermo()->setState_TP(800, OneAtm);
+        }
+        std::dynamic_pointer_cast<SurfPhase>(surf[1]->thermo())->setCoveragesByName(
+            "PT(S):0.3, H(S):0.2, O(S):0.1, O2(S):0.2, OH(S):0.1, H2O(S):0.1");
+    }
+
+    //! Check that the net production rates of all surface species vanish
+    void checkSteadyState() {
+        for (auto k : kin) {
+            size_t nsp = k->nTotalSpecies();
+            vector_fp wdot(nsp), cdot(nsp), ddot(nsp);
+            k->getNetProductionRates(wdot.data());
+            k->getCreationRates(cdot.data());
+            k->getDestructionRates(ddot.data());
+            size_t ns = k->surfacePhaseIndex();
+            for (size_t j = 0; j < k->thermo(ns).nSpecies(); j++) {
+                size_t kk = k->kineticsSpeciesIndex(j, ns);
+                EXPECT_NEAR(wdot[kk], 0.0, 1e-5 * (cdot[kk] + ddot[kk]))
+                    << k->kineticsSpeciesName(kk);
+            }
+        }
+    }
+
+    shared_ptr<Solution> gas;
+    std::vector<shared_ptr<Solution>> surf;
+    std::vector<InterfaceKinetics*> kin;
+};
+
+TEST_F(SurfaceProblem, analyticJacobian)
+{
+    ImplicitSurfChem integ(kin);
+    solveSP solver(&integ);
+    DenseMatrix jac, fd;
+    solver.getJacobian(jac);
+    solver.getJacobian(fd, true);
+    ASSERT_EQ(jac.nRows(), integ.neq());
+    ASSERT_EQ(fd.nRows(), integ.neq());
+    for (size_t i = 0; i < jac.nRows(); i++) {
+        double scale = 0.0;
+        for (size_t j = 0; j < jac.nColumns(); j++) {
+            scale = std::max(scale, std::abs(fd(i, j)));
+        }
+        EXPECT_GT(scale, 0.0) << i;
+        for (size_t j = 0; j < jac.nColumns(); j++) {
+            EXPECT_NEAR(jac(i, j), fd(i, j), 1e-5 * scale) << i << ", " << j;
+        }
+    }
+}
+
+TEST_F(SurfaceProblem, solveSurfProb)
+{
+    ImplicitSurfChem integ(kin);
+    solveSP solver(&integ);
+    solver.setLinearSolverType("dense");
+    ASSERT_EQ(solver.solveSurfProb(SFLUX_INITIALIZE, 1.0, 800, OneAtm,
+                                   1e-8, 1e-20), 1);
+    EXPECT_FALSE(solver.usingSparseSolver());
+    checkSteadyState();
+}
+
+TEST_F(SurfaceProblem, sparseLinearSolver)
+{
+    // enough surface phases for the automatic selection of the sparse solver
+    while (kin.size() * surf[0]->thermo()->nSpecies() < solveSP::s_sparseMinSize) {
+        surf.push_back(newSolution("surface-multisite.yaml", "Pt-surf", "None",
+                                   {gas}));
+        surf.back()->thermo()->setState_TP(800, OneAtm);
+        kin.push_back(dynamic_cast<InterfaceKinetics*>(
+            surf.back()->kinetics().get()));
+    }
+    ImplicitSurfChem integ(kin);
+    size_t nv = integ.neq();
+    vector_fp theta0(nv), theta(nv), thetaRef(nv);
+    integ.getState(theta0.data());
+
+    for (std::string type : {"dense", "sparse", "auto"}) {
+        size_t loc = 0;
+        for (auto& s : surf) {
+            auto phase = std::dynamic_pointer_cast<SurfPhase>(s->thermo());
+            phase->setCoverages(theta0.data() + loc);
+            loc += phase->nSpecies();
+        }
+        solveSP solver(&integ);
+        solver.setLinearSolverType(type);
+        ASSERT_EQ(solver.solveSurfProb(SFLUX_INITIALIZE, 1.0, 800, OneAtm,
+                                       1e-8, 1e-20), 1);
+        EXPECT_EQ(solver.usingSparseSolver(), type != "dense") << type;
+        checkSteadyState();
+        if (type == "dense") {
+            integ.getState(thetaRef.data());
+            continue;
+        }
+        integ.getState(theta.data());
+        for (size_t k = 0; k < nv; k++) {
+            EXPECT_NEAR(theta[k], thetaRef[k], 1e-8 * thetaRef[k] + 1e-14)
+                << type << ", " << k;
+        }
+    }
+}
+
+TEST(ImplicitSurfChem, evalSeveralSurfaces)
+{
+    // Two independent surface phases on the same gas
+    auto gas = newSolution("ptcombust.yaml", "gas", "None");
+    auto surf1 = newSolution("ptcombust.yaml", "Pt_surf", "None", {gas});
+    auto surf2 = newSolution("ptcombust.yaml", "Pt_surf", "None", {gas});
+    gas->thermo()->setState_TPX(900, OneAtm, "CH4:0.095, O2:0.21, AR:0.79");
+    std::vector<InterfaceKinetics*> kin;
+    for (auto& surf : {surf1, surf2}) {
+        surf->thermo()->setState_TP(900, OneAtm);
+        kin.push_back(dynamic_cast<InterfaceKinetics*>(surf->kinetics().get()));
+    }
+    auto phase2 = std::dynamic_pointer_cast<SurfPhase>(surf2->thermo());
+    phase2->setCoveragesByName("PT(S):0.5, O(S):0.3, CO(S):0.1, H(S):0.1");
+
+    ImplicitSurfChem integ(kin);
+    vector_fp y(integ.neq()), ydot(integ.neq());
+    integ.getState(y.data());
+    integ.eval(0.0, y.data(), ydot.data(), nullptr);
+
+    size_t loc = 0;
+    for (auto k : kin) {
+        auto& phase = dynamic_cast<SurfPhase&>(k->thermo(k->surfacePhaseIndex()));
+        size_t nsp = phase.nSpecies();
+        size_t kstart = k->kineticsSpeciesIndex(0, k->surfacePhaseIndex());
+        vector_fp wdot(k->nTotalSpecies());
+        k->getNetProductionRates(wdot.data());
+        double sum = 0.0;
+        double scale = 0.0;
+        for (size_t j = 0; j < nsp; j++) {
+            sum += ydot[loc + j];
+            scale += std::abs(ydot[loc + j]);
+            if (j > 0) {
+                EXPECT_NEAR(ydot[loc + j],
+                            wdot[kstart + j] * phase.size(j) / phase.siteDensity(),
+                            1e-12 * scale);
+            }
+        }
+        // the coverages of each surface phase sum to one
+        EXPECT_GT(scale, 0.0);
+        EXPECT_NEAR(sum, 0.0, 1e-12 * scale);
+        loc += nsp;
+    }
+}
+
+TEST(ImplicitSurfChem, sparseLinearSolver)
+{
+    auto gas = newSolution("ptcombust.yaml", "gas", "None");
+    auto surf = newSolution("ptcombust.yaml", "Pt_surf", "None", {gas});
+    auto surfPhase = std::dynamic_pointer_cast<SurfPhase>(surf->thermo());
+    auto kin = dynamic_cast<InterfaceKinetics*>(surf->kinetics().get());
+    gas->thermo()->setState_TPX(900, OneAtm, "CH4:0.095, O2:0.21, AR:0.79");
+    surfPhase->setState_TP(900, OneAtm);
+    size_t nsp = surfPhase->nSpecies();
+    vector_fp theta0(nsp), theta(nsp), thetaRef(nsp);
+    surfPhase->getCoverages(theta0.data());
+
+    for (bool transient : {false, true}) {
+        for (std::string type : {"dense", "sparse"}) {
+            surfPhase->setCoverages(theta0.data());
+            ImplicitSurfChem integ({kin});
+            integ.setLinearSolverType(type);
+            EXPECT_EQ(integ.linearSolverType(), type);
+            if (transient) {
+                integ.integrate(0.0, 1e-4);
+                EXPECT_EQ(integ.usingSparseSolver(), type == "sparse");
+            } else {
+                integ.solvePseudoSteadyStateProblem();
+            }
+            surfPhase->getCoverages(type == "dense" ? thetaRef.data() : theta.data());
+        }
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(theta[k], thetaRef[k], 1e-5 * thetaRef[k] + 1e-12)
+                << surfPhase->speciesName(k);
+        }
+    }
+
+    ImplicitSurfChem integ({kin});
+    EXPECT_EQ(integ.linearSolverType(), "auto");
+    EXPECT_THROW(integ.setLinearSolverType("banded"), CanteraError);
+}
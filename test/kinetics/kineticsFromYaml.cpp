@@ -2,6 +2,7 @@
 #include "cantera/base/Units.h"
 #include "cantera/base/Solution.h"
 #include "cantera/kinetics/GasKinetics.h"
+#include "cantera/kinetics/SurfaceArrheniusBatch.h"
 #include "cantera/thermo/SurfPhase.h"
 #include "cantera/kinetics/KineticsFactory.h"
 #include "cantera/kinetics/ReactionFactory.h"
@@ -335,6 +336,49 @@ TEST(Kinetics, EfficienciesFromYaml)
     EXPECT_EQ(kin->nReactions(), (size_t) 1);
 }
 
+TEST(Kinetics, ThirdBodyConcentrations)
+{
+    // Default and explicit efficiencies for the MultiRate path and for legacy
+    // three-body and falloff reactions, which share one efficiency matrix
+    AnyMap root = AnyMap::fromYamlString(
+        "phases: [{name: gas, thermo: ideal-gas, kinetics: gas,"
+        "  species: [{h2o2.yaml/species: all}]}]\n"
+        "reactions:\n"
+        "- {equation: 2 O + M <=> O2 + M, type: three-body,"
+        "  rate-constant: [1.2e+11, -1.0, 0.0],"
+        "  efficiencies: {AR: 0.83, H2O: 15.4}}\n"
+        "- {equation: 2 O + M <=> O2 + M, type: three-body-legacy,"
+        "  rate-constant: [1.2e+11, -1.0, 0.0], default-efficiency: 0.5,"
+        "  efficiencies: {AR: 0.7, H2: 2.4}}\n"
+        "- {equation: 2 OH (+M) <=> H2O2 (+M), type: falloff,"
+        "  high-P-rate-constant: [7.4e+10, -0.37, 0.0],"
+        "  low-P-rate-constant: [2.3e+12, -0.9, -1700.0],"
+        "  default-efficiency: 0.0, efficiencies: {H2O: 6.0}}\n"
+        "- {equation: 2 OH (+M) <=> H2O2 (+M), type: falloff-legacy,"
+        "  high-P-rate-constant: [7.4e+10, -0.37, 0.0],"
+        "  low-P-rate-constant: [2.3e+12, -0.9, -1700.0],"
+        "  efficiencies: {AR: 0.7, H2O: 6.0}}\n"
+        "- {equation: H + O2 <=> O + OH, rate-constant: [3.5e+12, -0.4, 16599.0]}");
+    auto sol = newSolution(root["phases"].getMapWhere("name", "gas"), root);
+    auto& gas = *sol->thermo();
+    auto& kin = dynamic_cast<GasKinetics&>(*sol->kinetics());
+    gas.setState_TPX(1200.0, OneAtm, "H2:2, O2:1, AR:3, H2O:0.5, H:0.01, OH:0.02");
+
+    vector_fp ropf(kin.nReactions());
+    kin.getFwdRatesOfProgress(ropf.data());
+    vector_fp concm(kin.nReactions());
+    kin.getThirdBodyConcentrations(concm.data());
+
+    double ctot = gas.molarDensity();
+    double cAR = gas.concentration(gas.speciesIndex("AR"));
+    double cH2 = gas.concentration(gas.speciesIndex("H2"));
+    double cH2O = gas.concentration(gas.speciesIndex("H2O"));
+    EXPECT_NEAR(concm[0], ctot - 0.17 * cAR + 14.4 * cH2O, 1e-12 * ctot);
+    EXPECT_NEAR(concm[1], 0.5 * ctot + 0.2 * cAR + 1.9 * cH2, 1e-12 * ctot);
+    EXPECT_NEAR(concm[2], 6.0 * cH2O, 1e-12 * ctot);
+    EXPECT_NEAR(concm[3], ctot - 0.3 * cAR + 5.0 * cH2O, 1e-12 * ctot);
+}
+
 TEST(Kinetics, InterfaceKineticsFromYaml)
 {
     shared_ptr<ThermoPhase> gas(newPhase("surface-phases.yaml", "gas"));
@@ -400,6 +444,712 @@ TEST(Kinetics, ElectrochemFromYaml)
     EXPECT_NEAR(ropr[0], 0.045559670, 1e-8);
 }
 
+//! Compare batched net production rates to those of single states, where
+//! results differ by round-off errors of the simultaneous evaluation
+static void checkNetProductionRatesBatch(Solution& sol, const vector_fp& T,
+                                         const vector_fp& P, const vector_fp& Y)
+{
+    auto& gas = *sol.thermo();
+    auto& kin = *sol.kinetics();
+    size_t nsp = gas.nSpecies();
+    vector_fp wdot(T.size() * nsp);
+    kin.getNetProductionRates(T.size(), T.data(), P.data(), Y.data(), wdot.data());
+    EXPECT_DOUBLE_EQ(gas.temperature(), T.back());
+
+    vector_fp wdot_ref(nsp), cdot(nsp), ddot(nsp);
+    for (size_t n = 0; n < T.size(); n++) {
+        gas.setState_TPY(T[n], P[n], &Y[n * nsp]);
+        kin.getNetProductionRates(wdot_ref.data());
+        kin.getCreationRates(cdot.data());
+        kin.getDestructionRates(ddot.data());
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(wdot[n * nsp + k], wdot_ref[k],
+                        1e-12 * (cdot[k] + ddot[k]) + 1e-300)
+                << "state " << n << ", species " << k;
+        }
+    }
+}
+
+TEST(Kinetics, NetProductionRatesBatch)
+{
+    auto sol = newSolution("gri30.yaml", "", "None");
+    auto& gas = *sol->thermo();
+    size_t nsp = gas.nSpecies();
+    std::vector<std::string> X{"CH4:1.0, O2:2.0, N2:7.52, H:0.01, OH:0.02",
+                               "H2:1.0, O2:0.5, H2O:0.3, O:0.01",
+                               "CH4:0.5, H2:0.5, O2:1.0, OH:0.02, CO:0.1"};
+    // more states than fit into a single block, with repeated temperatures
+    vector_fp T, P;
+    for (size_t n = 0; n < 75; n++) {
+        T.push_back(800.0 + 20.0 * (n / 2));
+        P.push_back(OneAtm * (0.5 + 0.3 * (n % 7)));
+    }
+    vector_fp Y(T.size() * nsp);
+    for (size_t n = 0; n < T.size(); n++) {
+        gas.setState_TPX(T[n], P[n], X[n % X.size()]);
+        gas.getMassFractions(&Y[n * nsp]);
+    }
+    checkNetProductionRatesBatch(*sol, T, P, Y);
+
+    // batch consisting of a single state
+    checkNetProductionRatesBatch(*sol, {1500.0}, {OneAtm},
+                                 vector_fp(&Y[nsp], &Y[2 * nsp]));
+
+    // reactions with multipliers of zero are evaluated for each state
+    sol->kinetics()->setMultiplier(5, 0.0);
+    checkNetProductionRatesBatch(*sol, T, P, Y);
+}
+
+TEST(Kinetics, NetProductionRatesBatchInterface)
+{
+    auto gas = newSolution("ptcombust.yaml", "gas");
+    auto surf = newSolution("ptcombust.yaml", "Pt_surf", "", {gas});
+    double T = 900.0;
+    vector_fp Y(surf->kinetics()->nTotalSpecies());
+    vector_fp wdot(Y.size());
+    EXPECT_THROW(surf->kinetics()->getNetProductionRates(1, &T, &OneAtm,
+        Y.data(), wdot.data()), NotImplementedError);
+}
+
+TEST(Kinetics, BatchedFalloffRates)
+{
+    // Mechanisms with Troe, SRI and chemically activated reactions
+    for (auto name : {"gri30.yaml", "kineticsfromscratch.yaml"}) {
+        auto sol = newSolution(name, "", "None");
+        auto& kin = *sol->kinetics();
+        size_t nr = kin.nReactions();
+        vector_fp kf(nr), concm(nr);
+        for (double T : {300., 1000., 1000., 2500.}) {
+            sol->thermo()->setState_TPX(T, 3 * OneAtm, "H2:1.0, O2:0.5, AR:2.0");
+            kin.getFwdRateConstants(kf.data());
+            kin.getThirdBodyConcentrations(concm.data());
+            size_t nFalloff = 0;
+            for (size_t i = 0; i < nr; i++) {
+                auto rate = std::dynamic_pointer_cast<FalloffRate>(
+                    kin.reaction(i)->rate());
+                if (!rate || (rate->type() != "Troe" && rate->type() != "SRI")) {
+                    continue;
+                }
+                nFalloff++;
+                double klow = rate->lowRate().eval(T);
+                double khigh = rate->highRate().eval(T);
+                double pr = concm[i] * klow / (khigh + SmallNumber);
+                double F = rate->evalF(T, concm[i]);
+                double k = rate->chemicallyActivated() ?
+                    klow * F / (1 + pr) : khigh * pr * F / (1 + pr);
+                EXPECT_NEAR(kf[i], k, 1e-13 * k) << name << ", " << i;
+            }
+            EXPECT_GT(nFalloff, 0u);
+        }
+    }
+}
+
+TEST(Kinetics, BatchedPlogRates)
+{
+    auto sol = newSolution("pdep-test.yaml");
+    auto& kin = *sol->kinetics();
+    // Reaction sharing the pressure grid of the first reaction
+    AnyMap rxn = AnyMap::fromYamlString(
+        "{equation: H + R2 <=> P2A + P2B, type: pressure-dependent-Arrhenius,"
+        " rate-constants: [{P: 0.01 atm, A: 1.2e+13, b: 0.5, Ea: 1.1e+04},"
+        " {P: 1.0 atm, A: 4.9e+14, b: 0.1, Ea: 1.5e+04},"
+        " {P: 10.0 atm, A: 3.2e+15, b: -0.2, Ea: 1.6e+04},"
+        " {P: 100.0 atm, A: 5.9e+15, b: -0.4, Ea: 1.7e+04}]}");
+    kin.addReaction(newReaction(rxn, kin));
+    size_t nr = kin.nReactions();
+    vector_fp kf(nr);
+    for (double P : {1e-3 * OneAtm, 0.5 * OneAtm, OneAtm, 37. * OneAtm, 1e3 * OneAtm}) {
+        for (double T : {500., 1500.}) {
+            sol->thermo()->setState_TP(T, P);
+            kin.getFwdRateConstants(kf.data());
+            double logP = std::log(P);
+            for (size_t i = 0; i < nr; i++) {
+                auto rate = std::dynamic_pointer_cast<PlogRate>(
+                    kin.reaction(i)->rate());
+                if (!rate) {
+                    continue;
+                }
+                rate->update_C(&logP);
+                double k = rate->updateRC(std::log(T), 1.0 / T);
+                EXPECT_NEAR(kf[i], k, 1e-13 * std::abs(k)) << P << ", " << i;
+            }
+        }
+    }
+}
+
+TEST(Kinetics, BatchedChebyshevRates)
+{
+    auto sol = newSolution("pdep-test.yaml");
+    auto& kin = *sol->kinetics();
+    size_t nr = kin.nReactions();
+    ChebyshevBatch batch;
+    for (size_t i = 0; i < nr; i++) {
+        auto rate = std::dynamic_pointer_cast<ChebyshevRate3>(
+            kin.reaction(i)->rate());
+        if (rate) {
+            batch.add(i, *rate);
+        }
+    }
+    // Reactions 5 and 7 share their dimensions and ranges
+    EXPECT_EQ(batch.nGroups(), (size_t) 2);
+
+    vector_fp kf(nr);
+    for (double P : {0.02 * OneAtm, OneAtm, 37. * OneAtm}) {
+        for (double T : {500., 1500.}) {
+            sol->thermo()->setState_TP(T, P);
+            kin.getFwdRateConstants(kf.data());
+            double log10P = std::log10(P);
+            for (size_t i = 0; i < nr; i++) {
+                auto rate = std::dynamic_pointer_cast<ChebyshevRate3>(
+                    kin.reaction(i)->rate());
+                if (!rate) {
+                    continue;
+                }
+                rate->update_C(&log10P);
+                double k = rate->updateRC(0., 1.0 / T);
+                EXPECT_NEAR(kf[i], k, 1e-12 * k) << P << ", " << i;
+            }
+        }
+    }
+}
+
+TEST(Kinetics, BatchedSurfaceArrheniusRates)
+{
+    std::vector<SurfaceArrhenius> rates;
+    rates.emplace_back(3.7e20, 0.0, 8100.0);
+    rates.back().addCoverageDependence(1, 0.0, 0.0, -720.0);
+    rates.emplace_back(4.4e7, 0.5, 2000.0);
+    rates.emplace_back(1.2e18, -1.0, 25000.0);
+    rates.back().addCoverageDependence(2, 0.3, 1.5, -3000.0);
+    rates.back().addCoverageDependence(0, -0.2, 0.0, 1200.0);
+    rates.emplace_back(5.0e12, 0.0, 12000.0);
+    rates.back().addCoverageDependence(2, 0.0, -0.5, 0.0);
+    rates.back().addCoverageDependence(3, 0.1, 1.0, 400.0);
+
+    // Skip reaction 3 to check that rate constants are written to the
+    // locations of the reaction indices
+    std::vector<size_t> rxn = {0, 1, 2, 4};
+    SurfaceArrheniusBatch batch;
+    for (size_t i = 0; i < rates.size(); i++) {
+        batch.install(rxn[i], rates[i]);
+    }
+    EXPECT_EQ(batch.nReactions(), (size_t) 4);
+
+    vector_fp theta = {0.6, 0.25, 0.15, 0.0};
+    double T = 900.0;
+    vector_fp kf(5, -1.0);
+    batch.update_C(theta.data());
+    batch.update(T, std::log(T), kf.data());
+    EXPECT_EQ(kf[3], -1.0);
+    for (size_t i = 0; i < rates.size(); i++) {
+        rates[i].update_C(theta.data());
+        double k = rates[i].updateRC(std::log(T), 1.0 / T);
+        EXPECT_DOUBLE_EQ(kf[rxn[i]], k) << i;
+        EXPECT_DOUBLE_EQ(batch.effectivePreExponentialFactor(rxn[i]),
+                         rates[i].preExponentialFactor());
+        EXPECT_DOUBLE_EQ(batch.effectiveActivationEnergy_R(rxn[i]),
+                         rates[i].activationEnergy_R());
+        EXPECT_DOUBLE_EQ(batch.effectiveTemperatureExponent(rxn[i]),
+                         rates[i].temperatureExponent());
+    }
+
+    // Replaced rates are used after repacking the coverage dependencies
+    rates[1].addCoverageDependence(1, 0.5, 0.0, 100.0);
+    batch.replace(1, rates[1]);
+    batch.update_C(theta.data());
+    batch.update(T, std::log(T), kf.data());
+    rates[1].update_C(theta.data());
+    EXPECT_DOUBLE_EQ(kf[1], rates[1].updateRC(std::log(T), 1.0 / T));
+    EXPECT_THROW(batch.effectiveActivationEnergy_R(3), std::out_of_range);
+}
+
+TEST(Kinetics, RateTabulation)
+{
+    auto sol = newSolution("gri30.yaml", "", "None");
+    auto ref = newSolution("gri30.yaml", "", "None");
+    auto& kin = dynamic_cast<GasKinetics&>(*sol->kinetics());
+    size_t nr = kin.nReactions();
+    kin.setRateTabulation(500., 2500.);
+    EXPECT_TRUE(kin.rateTabulationEnabled());
+    EXPECT_FALSE(kin.rateTable().ready());
+
+    vector_fp kf(nr), kf_ref(nr), kr(nr), kr_ref(nr);
+    std::string X = "CH4:1.0, O2:2.0, N2:7.52, H:0.01, OH:0.02";
+    for (double T : {300., 500., 731.3, 1287.9, 2143.2, 2500., 3000.}) {
+        sol->thermo()->setState_TPX(T, 2 * OneAtm, X);
+        ref->thermo()->setState_TPX(T, 2 * OneAtm, X);
+        kin.getFwdRateConstants(kf.data());
+        kin.getRevRateConstants(kr.data());
+        ref->kinetics()->getFwdRateConstants(kf_ref.data());
+        ref->kinetics()->getRevRateConstants(kr_ref.data());
+        EXPECT_DOUBLE_EQ(sol->thermo()->temperature(), T);
+        for (size_t i = 0; i < nr; i++) {
+            EXPECT_NEAR(kf[i], kf_ref[i], 1e-5 * kf_ref[i]) << T << ", " << i;
+            EXPECT_NEAR(kr[i], kr_ref[i], 2e-5 * kr_ref[i]) << T << ", " << i;
+        }
+    }
+    EXPECT_TRUE(kin.rateTable().ready());
+    EXPECT_LE(kin.rateTable().maxError(), 1e-5);
+
+    // Irreversible reactions have no reverse rates after the equilibrium
+    // constants have been evaluated separately
+    vector_fp Kc(nr), ropr(nr);
+    sol->thermo()->setState_TPX(1287.9, 2 * OneAtm, X);
+    kin.getEquilibriumConstants(Kc.data());
+    kin.getRevRatesOfProgress(ropr.data());
+    size_t nIrrev = 0;
+    for (size_t i = 0; i < nr; i++) {
+        if (!kin.isReversible(i)) {
+            EXPECT_EQ(ropr[i], 0.0) << i;
+            nIrrev++;
+        }
+    }
+    EXPECT_GT(nIrrev, 0u);
+
+    // Table is rebuilt after modifying a reaction
+    AnyMap rxn = AnyMap::fromYamlString(
+        "{equation: O + H2 <=> H + OH, rate-constant: [5.0e+04, 2.7, 6260.0]}");
+    kin.modifyReaction(2, newReaction(rxn, kin));
+    EXPECT_FALSE(kin.rateTable().ready());
+    ref->kinetics()->modifyReaction(2, newReaction(rxn, *ref->kinetics()));
+    sol->thermo()->setState_TPX(1500., OneAtm, X);
+    ref->thermo()->setState_TPX(1500., OneAtm, X);
+    kin.getFwdRateConstants(kf.data());
+    ref->kinetics()->getFwdRateConstants(kf_ref.data());
+    EXPECT_NEAR(kf[2], kf_ref[2], 1e-5 * kf_ref[2]);
+
+    // Logarithms of the magnitudes of negative rate constants are tabulated
+    rxn = AnyMap::fromYamlString(
+        "{equation: O + H2 <=> H + OH, rate-constant: [-5.0e+04, 2.7, 6260.0],"
+        " negative-A: true}");
+    kin.modifyReaction(2, newReaction(rxn, kin));
+    ref->kinetics()->modifyReaction(2, newReaction(rxn, *ref->kinetics()));
+    sol->thermo()->setState_TPX(1400., OneAtm, X);
+    ref->thermo()->setState_TPX(1400., OneAtm, X);
+    kin.getFwdRateConstants(kf.data());
+    ref->kinetics()->getFwdRateConstants(kf_ref.data());
+    EXPECT_LT(kf_ref[2], 0.0);
+    EXPECT_NEAR(kf[2], kf_ref[2], -1e-5 * kf_ref[2]);
+    EXPECT_TRUE(kin.rateTable().ready());
+
+    kin.disableRateTabulation();
+    EXPECT_FALSE(kin.rateTabulationEnabled());
+    EXPECT_THROW(kin.setRateTabulation(1000., 500.), CanteraError);
+    kin.setRateTabulation(300., 3000., 1e-9, 1000);
+    EXPECT_THROW(kin.getFwdRateConstants(kf.data()), CanteraError);
+}
+
+TEST(Kinetics, AdaptiveChemistry)
+{
+    auto sol = newSolution("gri30.yaml", "", "None");
+    auto ref = newSolution("gri30.yaml", "", "None");
+    auto& kin = dynamic_cast<GasKinetics&>(*sol->kinetics());
+    size_t nr = kin.nReactions();
+    size_t nsp = kin.nTotalSpecies();
+    EXPECT_THROW(kin.enableAdaptiveChemistry({"XYZ"}), CanteraError);
+    EXPECT_THROW(kin.enableAdaptiveChemistry({"CH4"}, 2.0), CanteraError);
+    kin.enableAdaptiveChemistry({"CH4", "O2"}, 1e-3);
+    EXPECT_TRUE(kin.adaptiveChemistryEnabled());
+    EXPECT_TRUE(kin.activeSpecies().empty());
+
+    std::string X = "CH4:1.0, O2:2.0, N2:7.52, H:0.01, OH:0.02, CO:0.1, H2O:0.1";
+    sol->thermo()->setState_TPX(1400., OneAtm, X);
+    ref->thermo()->setState_TPX(1400., OneAtm, X);
+    vector_fp rop(nr), rop_ref(nr), wdot(nsp), wdot_ref(nsp);
+    ref->kinetics()->getNetRatesOfProgress(rop_ref.data());
+    ref->kinetics()->getNetProductionRates(wdot_ref.data());
+
+    // The first evaluation uses the full mechanism to find the active set
+    kin.getNetRatesOfProgress(rop.data());
+    EXPECT_EQ(kin.nAdaptiveRefreshes(), 1u);
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_DOUBLE_EQ(rop[i], rop_ref[i]);
+    }
+    const auto& active = kin.activeReactions();
+    ASSERT_EQ(active.size(), nr);
+    size_t nActive = std::count(active.begin(), active.end(), true);
+    EXPECT_GT(nActive, 0u);
+    EXPECT_LT(nActive, nr);
+
+    // Subsequent evaluations are restricted to the active set
+    kin.getNetRatesOfProgress(rop.data());
+    EXPECT_EQ(kin.nAdaptiveRefreshes(), 1u);
+    for (size_t i = 0; i < nr; i++) {
+        if (active[i]) {
+            EXPECT_DOUBLE_EQ(rop[i], rop_ref[i]) << i;
+        } else {
+            EXPECT_EQ(rop[i], 0.0) << i;
+        }
+    }
+
+    // The refresh interval is doubled if the active set does not change
+    kin.getNetProductionRates(wdot.data());
+    EXPECT_EQ(kin.nAdaptiveRefreshes(), 2u);
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_DOUBLE_EQ(wdot[k], wdot_ref[k]);
+    }
+    for (int n = 0; n < 2; n++) {
+        kin.getNetProductionRates(wdot.data());
+        EXPECT_EQ(kin.nAdaptiveRefreshes(), 2u);
+        for (size_t k = 0; k < nsp; k++) {
+            if (!kin.activeSpecies()[k]) {
+                EXPECT_EQ(wdot[k], 0.0) << k;
+            }
+        }
+        for (auto name : {"CH4", "O2"}) {
+            size_t k = kin.kineticsSpeciesIndex(name);
+            EXPECT_NEAR(wdot[k], wdot_ref[k], 1e-2 * std::abs(wdot_ref[k]));
+        }
+    }
+    kin.getNetProductionRates(wdot.data());
+    EXPECT_EQ(kin.nAdaptiveRefreshes(), 3u);
+
+    // Changes of the state beyond the tolerance trigger a refresh
+    sol->thermo()->setState_TPX(1405., OneAtm, X);
+    kin.getNetRatesOfProgress(rop.data());
+    EXPECT_EQ(kin.nAdaptiveRefreshes(), 3u);
+
+    // Reverse rate constants are available for all reactions after a
+    // restricted evaluation at a new temperature
+    vector_fp kr(nr), kr_ref(nr);
+    ref->thermo()->setState_TPX(1405., OneAtm, X);
+    kin.getRevRateConstants(kr.data());
+    ref->kinetics()->getRevRateConstants(kr_ref.data());
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_DOUBLE_EQ(kr[i], kr_ref[i]) << i;
+    }
+    sol->thermo()->setState_TPX(1500., OneAtm, X);
+    ref->thermo()->setState_TPX(1500., OneAtm, X);
+    kin.getNetRatesOfProgress(rop.data());
+    ref->kinetics()->getNetRatesOfProgress(rop_ref.data());
+    EXPECT_EQ(kin.nAdaptiveRefreshes(), 4u);
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_DOUBLE_EQ(rop[i], rop_ref[i]) << i;
+    }
+
+    // Setting a multiplier to or from zero updates the reaction mask and the
+    // active set in the same evaluation
+    size_t j = std::find(active.begin(), active.end(), true) - active.begin();
+    ASSERT_LT(j, nr);
+    for (double f : {0.0, 1.0}) {
+        kin.setMultiplier(j, f);
+        ref->kinetics()->setMultiplier(j, f);
+        size_t nRefresh = kin.nAdaptiveRefreshes();
+        kin.getNetRatesOfProgress(rop.data());
+        ref->kinetics()->getNetRatesOfProgress(rop_ref.data());
+        EXPECT_EQ(kin.nAdaptiveRefreshes(), nRefresh + 1);
+        for (size_t i = 0; i < nr; i++) {
+            EXPECT_DOUBLE_EQ(rop[i], rop_ref[i]) << f << ", " << i;
+        }
+    }
+
+    // Modifying the mechanism discards the active set
+    AnyMap rxn = AnyMap::fromYamlString(
+        "{equation: O + H2 <=> H + OH, rate-constant: [5.0e+04, 2.7, 6260.0]}");
+    kin.modifyReaction(2, newReaction(rxn, kin));
+    EXPECT_TRUE(kin.activeSpecies().empty());
+
+    kin.disableAdaptiveChemistry();
+    EXPECT_FALSE(kin.adaptiveChemistryEnabled());
+    ref->kinetics()->modifyReaction(2, newReaction(rxn, *ref->kinetics()));
+    ref->thermo()->setState_TPX(1500., OneAtm, X);
+    kin.getNetRatesOfProgress(rop.data());
+    ref->kinetics()->getNetRatesOfProgress(rop_ref.data());
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_DOUBLE_EQ(rop[i], rop_ref[i]);
+    }
+}
+
+TEST(Kinetics, ZeroMultipliers)
+{
+    auto sol = newSolution("gri30.yaml", "", "None");
+    auto ref = newSolution("gri30.yaml", "", "None");
+    auto& kin = *sol->kinetics();
+    size_t nr = kin.nReactions();
+    std::string X = "CH4:1.0, O2:2.0, N2:7.52, H:0.01, OH:0.02, CO:0.1, H2O:0.1";
+    sol->thermo()->setState_TPX(1400., OneAtm, X);
+    ref->thermo()->setState_TPX(1400., OneAtm, X);
+    vector_fp rop(nr), rop_ref(nr), drop(nr), drop_ref(nr), kf(nr), kf_ref(nr);
+    kin.getNetRatesOfProgress(rop.data());
+
+    // Reactions with zero multipliers are skipped, including three-body and
+    // falloff reactions
+    for (size_t i = 0; i < nr; i += 2) {
+        kin.setMultiplier(i, 0.0);
+    }
+    for (double T : {1400., 1600.}) {
+        sol->thermo()->setState_TPX(T, OneAtm, X);
+        ref->thermo()->setState_TPX(T, OneAtm, X);
+        kin.getNetRatesOfProgress(rop.data());
+        ref->kinetics()->getNetRatesOfProgress(rop_ref.data());
+        kin.getNetRatesOfProgress_ddT(drop.data());
+        ref->kinetics()->getNetRatesOfProgress_ddT(drop_ref.data());
+        kin.getFwdRateConstants(kf.data());
+        for (size_t i = 0; i < nr; i++) {
+            if (i % 2) {
+                EXPECT_DOUBLE_EQ(rop[i], rop_ref[i]) << i;
+                EXPECT_NEAR(drop[i], drop_ref[i], 1e-12 * std::abs(drop_ref[i]));
+            } else {
+                EXPECT_EQ(rop[i], 0.0) << i;
+                EXPECT_EQ(drop[i], 0.0) << i;
+                EXPECT_EQ(kf[i], 0.0) << i;
+            }
+        }
+    }
+
+    // Rates of reactions are updated when multipliers are reset at the same
+    // state
+    for (size_t i = 0; i < nr; i += 2) {
+        kin.setMultiplier(i, 1.0);
+    }
+    kin.getNetRatesOfProgress(rop.data());
+    kin.getFwdRateConstants(kf.data());
+    ref->kinetics()->getFwdRateConstants(kf_ref.data());
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_DOUBLE_EQ(rop[i], rop_ref[i]) << i;
+        EXPECT_DOUBLE_EQ(kf[i], kf_ref[i]) << i;
+    }
+}
+
+TEST(Kinetics, QssSpecies)
+{
+    auto sol = newSolution("gri30.yaml", "", "None");
+    auto& kin = dynamic_cast<GasKinetics&>(*sol->kinetics());
+    size_t nsp = kin.nTotalSpecies();
+    EXPECT_THROW(kin.setQssSpecies({"XYZ"}), CanteraError);
+    EXPECT_TRUE(kin.qssSpecies().empty());
+
+    std::string X = "CH4:1.0, O2:2.0, N2:7.52, H:0.01, O:0.01, OH:0.02, CH3:0.01";
+    sol->thermo()->setState_TPX(1400., OneAtm, X);
+    vector_fp wdot(nsp), wdot_ref(nsp), cdot(nsp);
+    kin.getNetProductionRates(wdot_ref.data());
+
+    // Singlet and triplet methylene are coupled and only participate in
+    // reactions that are of first order in these species
+    kin.setQssSpecies({"CH2", "CH2(S)"});
+    EXPECT_TRUE(kin.isQssSpecies(kin.kineticsSpeciesIndex("CH2(S)")));
+    EXPECT_FALSE(kin.isQssSpecies(kin.kineticsSpeciesIndex("CH3")));
+    kin.getNetProductionRates(wdot.data());
+    kin.getCreationRates(cdot.data());
+    EXPECT_EQ(kin.nQssGroups(), 1u);
+    for (size_t k : kin.qssSpecies()) {
+        EXPECT_GT(cdot[k], 0.0);
+        EXPECT_NEAR(wdot[k], 0.0, 1e-8 * cdot[k]);
+        // methylene is produced, as the mixture does not contain it
+        EXPECT_GT(wdot_ref[k], 0.0);
+    }
+    // Rates of other species are affected by the methylene concentrations
+    size_t kCH = kin.kineticsSpeciesIndex("CH");
+    EXPECT_GT(std::abs(wdot[kCH] - wdot_ref[kCH]), 1e-6 * std::abs(wdot_ref[kCH]));
+
+    // Declaring QSS species in the input file; the recombination of HO2 yields
+    // a nonlinear system
+    AnyMap phase = AnyMap::fromYamlString(
+        "{name: qss, thermo: ideal-gas, kinetics: gas,"
+        " species: [{h2o2.yaml/species: all}],"
+        " reactions: [{h2o2.yaml/reactions: all}],"
+        " qss-species: [HO2, H2O2]}");
+    auto h2o2 = newSolution(phase);
+    auto& kin2 = dynamic_cast<GasKinetics&>(*h2o2->kinetics());
+    ASSERT_EQ(kin2.qssSpecies().size(), 2u);
+    EXPECT_EQ(h2o2->parameters()["qss-species"].asVector<std::string>(),
+              (std::vector<std::string>{"HO2", "H2O2"}));
+    h2o2->thermo()->setState_TPX(1000., OneAtm, "H2:2, O2:1, AR:5, H:0.01, OH:0.01");
+    nsp = kin2.nTotalSpecies();
+    wdot.resize(nsp);
+    cdot.resize(nsp);
+    for (int n = 0; n < 2; n++) {
+        kin2.getNetProductionRates(wdot.data());
+        kin2.getCreationRates(cdot.data());
+        EXPECT_EQ(kin2.nQssGroups(), 1u);
+        for (size_t k : kin2.qssSpecies()) {
+            EXPECT_GT(cdot[k], 0.0);
+            EXPECT_NEAR(wdot[k], 0.0, 1e-8 * cdot[k]);
+        }
+        h2o2->thermo()->setState_TP(1100., OneAtm);
+    }
+
+    // Modifying the mechanism or the QSS species discards the groups
+    kin2.modifyReaction(0, kin2.reaction(0));
+    EXPECT_EQ(kin2.nQssGroups(), 0u);
+    kin2.setQssSpecies({});
+    EXPECT_FALSE(h2o2->parameters().hasKey("qss-species"));
+
+    phase["qss-species"] = std::vector<std::string>{"XYZ"};
+    EXPECT_THROW(newSolution(phase), CanteraError);
+    phase["kinetics"] = "none";
+    phase["reactions"] = "none";
+    EXPECT_THROW(newSolution(phase), InputFileError);
+
+    // A QSS species consumed only by its self-recombination is solved on the
+    // first evaluation
+    AnyMap root = AnyMap::fromYamlString(
+        "phases: [{name: recombination, thermo: ideal-gas, kinetics: gas,"
+        "  species: [{h2o2.yaml/species: all}], qss-species: [HO2]}]\n"
+        "reactions:\n"
+        "- {equation: H + O2 => HO2, rate-constant: [1.0e+12, 0.0, 0.0]}\n"
+        "- {equation: 2 HO2 => H2O2 + O2, rate-constant: [1.3e+11, 0.0, -1630.0]}");
+    auto recomb = newSolution(root["phases"].getMapWhere("name", "recombination"),
+                              root);
+    auto& kin3 = dynamic_cast<GasKinetics&>(*recomb->kinetics());
+    recomb->thermo()->setState_TPX(1000., OneAtm, "H2:2, O2:1, AR:5, H:0.01");
+    nsp = kin3.nTotalSpecies();
+    wdot.resize(nsp);
+    cdot.resize(nsp);
+    kin3.getNetProductionRates(wdot.data());
+    kin3.getCreationRates(cdot.data());
+    size_t kHO2 = kin3.kineticsSpeciesIndex("HO2");
+    EXPECT_GT(cdot[kHO2], 0.0);
+    EXPECT_NEAR(wdot[kHO2], 0.0, 1e-8 * cdot[kHO2]);
+}
+
+TEST(Kinetics, FusedEvaluation)
+{
+    for (std::string mech : {"gri30.yaml", "frac.yaml"}) {
+        auto sol = newSolution(mech, "", "None");
+        auto ref = newSolution(mech, "", "None");
+        auto& kin = dynamic_cast<GasKinetics&>(*sol->kinetics());
+        size_t nr = kin.nReactions();
+        size_t nsp = kin.nTotalSpecies();
+        kin.setFusedEvaluation(true);
+        EXPECT_TRUE(kin.fusedEvaluationEnabled());
+        EXPECT_EQ(kin.fusedKernel().nReactions(), 0u);
+
+        vector_fp wdot(nsp), wdot_ref(nsp), ropf(nr), ropf_ref(nr);
+        vector_fp ropr(nr), ropr_ref(nr);
+        for (double T : {900., 1500.}) {
+            std::string X = (mech == "gri30.yaml")
+                ? "CH4:1.0, O2:2.0, N2:7.52, H:0.01, OH:0.02, CO:0.1, H2O:0.1"
+                : "H2:2.0, O2:1.0, H:0.01, O:0.01, OH:0.02, H2O:0.5";
+            sol->thermo()->setState_TPX(T, OneAtm, X);
+            ref->thermo()->setState_TPX(T, OneAtm, X);
+            kin.getNetProductionRates(wdot.data());
+            kin.getFwdRatesOfProgress(ropf.data());
+            kin.getRevRatesOfProgress(ropr.data());
+            ref->kinetics()->getNetProductionRates(wdot_ref.data());
+            ref->kinetics()->getFwdRatesOfProgress(ropf_ref.data());
+            ref->kinetics()->getRevRatesOfProgress(ropr_ref.data());
+            double scale = 0.0;
+            for (size_t i = 0; i < nr; i++) {
+                EXPECT_NEAR(ropf[i], ropf_ref[i], 1e-13 * ropf_ref[i]) << i;
+                EXPECT_NEAR(ropr[i], ropr_ref[i], 1e-13 * ropr_ref[i]) << i;
+                scale = std::max({scale, ropf_ref[i], ropr_ref[i]});
+            }
+            for (size_t k = 0; k < nsp; k++) {
+                EXPECT_NEAR(wdot[k], wdot_ref[k], 1e-12 * scale) << k;
+            }
+        }
+        EXPECT_EQ(kin.fusedKernel().nReactions(), nr);
+        EXPECT_LT(kin.fusedKernel().dataSize(),
+                  kin.fusedKernel().multiPassDataSize());
+
+        // Reactions with zero multipliers use the multi-pass evaluation
+        kin.setMultiplier(0, 0.0);
+        ref->kinetics()->setMultiplier(0, 0.0);
+        kin.getNetProductionRates(wdot.data());
+        ref->kinetics()->getNetProductionRates(wdot_ref.data());
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(wdot[k], wdot_ref[k],
+                        1e-12 * std::abs(wdot_ref[k]) + 1e-20) << k;
+        }
+
+        kin.setFusedEvaluation(false);
+        EXPECT_EQ(kin.fusedKernel().nReactions(), 0u);
+    }
+}
+
+TEST(Kinetics, SharedArrheniusTerms)
+{
+    auto sol = newSolution("h2o2.yaml", "", "None");
+    auto thermo = sol->thermo();
+    std::vector<std::string> equations = {
+        "H + O2 <=> O + OH", "H2 + O <=> H + OH", "H2 + OH <=> H + H2O",
+        "2 OH <=> H2O + O", "H + HO2 <=> 2 OH"};
+    // Reactions 0, 1 and 3 share the same temperature exponent and activation
+    // energy, and reactions 2 and 4 share the same temperature exponent
+    vector_fp A = {2.6e13, 3.8e9, 2.2e5, 8.4e8, 7.1e10};
+    vector_fp b = {0.5, 0.5, 1.5, 0.5, 1.5};
+    vector_fp Ea = {6.2e7, 6.2e7, 1.4e7, 6.2e7, 1.4e6};
+    for (std::string type : {"elementary", "elementary-legacy"}) {
+        GasKinetics kin;
+        kin.addPhase(*thermo);
+        kin.init();
+        auto makeReaction = [&](size_t i) {
+            AnyMap rxn = AnyMap::fromYamlString(fmt::format(
+                "{{equation: {}, type: {}, rate-constant: "
+                "{{A: {}, b: {}, Ea: {}}}}}", equations[i], type, A[i], b[i],
+                Ea[i]));
+            return newReaction(rxn, kin);
+        };
+        for (size_t i = 0; i < equations.size(); i++) {
+            kin.addReaction(makeReaction(i));
+        }
+        vector_fp kf(kin.nReactions());
+        auto check = [&]() {
+            for (double T : {500., 1300.}) {
+                thermo->setState_TP(T, OneAtm);
+                kin.getFwdRateConstants(kf.data());
+                for (size_t i = 0; i < kf.size(); i++) {
+                    double k = A[i] * std::pow(T, b[i])
+                        * std::exp(-Ea[i] / (GasConstant * T));
+                    EXPECT_NEAR(kf[i], k, 1e-13 * k) << type << ", " << i;
+                }
+            }
+        };
+        check();
+
+        // Modify a reaction sharing its parameters with other reactions
+        b[1] = 0.7;
+        kin.modifyReaction(1, makeReaction(1));
+        check();
+        A[3] = 1.2e9;
+        kin.modifyReaction(3, makeReaction(3));
+        check();
+        b[1] = 0.5;
+        A[3] = 8.4e8;
+    }
+}
+
+TEST(KineticsFromYaml, ParallelReactionCreation)
+{
+    setReactionThreads(1);
+    auto serial = newSolution("gri30.yaml", "gri30", "None");
+    setReactionThreads(4);
+    auto parallel = newSolution("gri30.yaml", "gri30", "None");
+    setReactionThreads(0);
+    auto kin1 = serial->kinetics();
+    auto kin2 = parallel->kinetics();
+    ASSERT_EQ(kin1->nReactions(), kin2->nReactions());
+    for (auto soln : {serial, parallel}) {
+        soln->thermo()->setState_TPX(1500, OneAtm, "CH4:1, O2:2, N2:7.52, H:0.01");
+    }
+    vector_fp kf1(kin1->nReactions()), kf2(kin2->nReactions());
+    kin1->getFwdRateConstants(kf1.data());
+    kin2->getFwdRateConstants(kf2.data());
+    for (size_t i = 0; i < kin1->nReactions(); i++) {
+        EXPECT_EQ(kin1->reactionString(i), kin2->reactionString(i));
+        EXPECT_EQ(kin1->reaction(i)->type(), kin2->reaction(i)->type());
+        EXPECT_DOUBLE_EQ(kf1[i], kf2[i]) << kin1->reactionString(i);
+    }
+    EXPECT_EQ(kin2->checkDuplicates(false).first, npos);
+
+    // Undeclared duplicates of three-body reactions are detected unless the
+    // third-body efficiencies do not overlap
+    AnyMap rxn = AnyMap::fromYamlString(
+        "{equation: 2 OH + M <=> H2O2 + M, rate-constant: {A: 1e10, b: 0, Ea: 0},"
+        " type: three-body, default-efficiency: 0, efficiencies: {AR: 1, N2: 1}}");
+    kin2->addReaction(newReaction(rxn, *kin2));
+    size_t i1 = kin2->nReactions() - 1;
+    rxn["efficiencies"] = AnyMap::fromYamlString("{H2: 1, N2: 0}");
+    kin2->addReaction(newReaction(rxn, *kin2));
+    EXPECT_EQ(kin2->checkDuplicates(false).first, npos);
+    rxn["efficiencies"] = AnyMap::fromYamlString("{N2: 2}");
+    kin2->addReaction(newReaction(rxn, *kin2));
+    auto dup = kin2->checkDuplicates(false);
+    EXPECT_EQ(dup.first, kin2->nReactions() - 1);
+    EXPECT_EQ(dup.second, i1);
+}
+
 TEST(KineticsFromYaml, NoKineticsModelOrReactionsField1)
 {
     auto soln = newSolution("phase-reaction-spec1.yaml",
@@ -662,3 +1412,46 @@ TEST_F(ReactionToYaml, BlowersMaselInterface)
     EXPECT_TRUE(std::dynamic_pointer_cast<BlowersMaselInterfaceReaction>(duplicate));
     compareReactions();
 }
+
+TEST(KineticsInstrumentation, gasAndInterface)
+{
+    auto gas = newSolution("ptcombust.yaml", "gas", "None");
+    auto surf = newSolution("ptcombust.yaml", "Pt_surf", "None", {gas});
+    auto& kin = *gas->kinetics();
+    vector_fp ropnet(kin.nReactions());
+    EXPECT_FALSE(kin.instrumentationEnabled());
+    kin.getNetRatesOfProgress(ropnet.data());
+    EXPECT_EQ(kin.instrumentationReport().size(), 0u);
+
+    kin.setInstrumentation(true);
+    gas->thermo()->setState_TPX(900, OneAtm, "CH4:0.095, O2:0.21, AR:0.79");
+    kin.getNetRatesOfProgress(ropnet.data());
+    kin.getNetRatesOfProgress(ropnet.data());
+    AnyMap report = kin.instrumentationReport();
+    EXPECT_EQ(report["updateROP"]["calls"].asInt(), 2);
+    EXPECT_EQ(report["update_rates_T"]["calls"].asInt(), 2);
+    EXPECT_EQ(report["update_rates_T"]["cache-hits"].asInt(), 1);
+    EXPECT_EQ(report["updateKc"]["calls"].asInt(), 1);
+    EXPECT_EQ(report["rates: Arrhenius"]["calls"].asInt(), 2);
+    EXPECT_EQ(report["rates: Arrhenius"]["cache-hits"].asInt(), 1);
+    EXPECT_GE(report["updateROP"]["time"].asDouble(),
+              report["update_rates_T"]["time"].asDouble());
+
+    kin.clearInstrumentation();
+    kin.setInstrumentation(false);
+    kin.getNetRatesOfProgress(ropnet.data());
+    EXPECT_EQ(kin.instrumentationReport().size(), 0u);
+
+    auto& skin = *surf->kinetics();
+    vector_fp sropnet(skin.nReactions());
+    skin.setInstrumentation(true);
+    skin.getNetRatesOfProgress(sropnet.data());
+    skin.getNetRatesOfProgress(sropnet.data());
+    report = skin.instrumentationReport();
+    EXPECT_EQ(report["updateROP"]["calls"].asInt(), 2);
+    // surface rate constants are not cached
+    EXPECT_EQ(report["update_rates_T"]["calls"].asInt(), 2);
+    EXPECT_EQ(report["update_rates_T"]["cache-hits"].asInt(), 0);
+    EXPECT_EQ(report["rates: surface-Arrhenius"]["calls"].asInt(), 2);
+    EXPECT_TRUE(report.hasKey("concentration products"));
+}
@@ -0,0 +1,181 @@
+#include "gtest/gtest.h"
+#include "cantera/base/Solution.h"
+#include "cantera/kinetics/GeneratedKinetics.h"
+#include "cantera/kinetics/KineticsFactory.h"
+#include "cantera/kinetics/Reaction.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include <fstream>
+
+using namespace Cantera;
+
+// The kinetics manager "h2o2-generated" is defined in h2o2Generated.cpp, which
+// was created using writeGeneratedKinetics for phase "ohmech" in h2o2.yaml. The
+// test "GeneratedKinetics.checkedInSource" fails if the file is out of date.
+
+class GeneratedKineticsTest : public testing::Test
+{
+public:
+    void setup(const std::string& infile, const std::string& name) {
+        AnyMap root = AnyMap::fromYamlFile(infile);
+        AnyMap phaseNode = root["phases"].getMapWhere("name", name);
+        gas = newPhase(phaseNode, root);
+        kin_ref = newKinetics({gas.get()}, phaseNode, root);
+        phaseNode["kinetics"] = "h2o2-generated";
+        kin = newKinetics({gas.get()}, phaseNode, root);
+        nr = kin->nReactions();
+        nk = gas->nSpecies();
+    }
+
+    void compare(double rtol) {
+        vector_fp v(nr), v_ref(nr), w(nk), w_ref(nk);
+        kin->getFwdRatesOfProgress(v.data());
+        kin_ref->getFwdRatesOfProgress(v_ref.data());
+        for (size_t i = 0; i < nr; i++) {
+            EXPECT_NEAR(v[i], v_ref[i], rtol * std::abs(v_ref[i])) << i;
+        }
+        kin->getRevRatesOfProgress(v.data());
+        kin_ref->getRevRatesOfProgress(v_ref.data());
+        for (size_t i = 0; i < nr; i++) {
+            EXPECT_NEAR(v[i], v_ref[i], rtol * std::abs(v_ref[i])) << i;
+        }
+        kin->getNetProductionRates(w.data());
+        kin_ref->getNetProductionRates(w_ref.data());
+        double scale = 0.0;
+        for (size_t k = 0; k < nk; k++) {
+            scale = std::max(scale, std::abs(w_ref[k]));
+        }
+        for (size_t k = 0; k < nk; k++) {
+            EXPECT_NEAR(w[k], w_ref[k], rtol * scale) << k;
+        }
+    }
+
+protected:
+    shared_ptr<ThermoPhase> gas;
+    unique_ptr<Kinetics> kin, kin_ref;
+    size_t nr, nk;
+};
+
+TEST_F(GeneratedKineticsTest, factory)
+{
+    setup("h2o2.yaml", "ohmech");
+    auto& gk = dynamic_cast<GeneratedKinetics&>(*kin);
+    EXPECT_EQ(kin->kineticsType(), "Gas");
+    EXPECT_TRUE(gk.usesGeneratedCode());
+}
+
+TEST_F(GeneratedKineticsTest, compare)
+{
+    setup("h2o2.yaml", "ohmech");
+    std::vector<double> T{300, 900, 1200, 2500};
+    std::vector<double> P{0.1 * OneAtm, OneAtm, 5 * OneAtm, 40 * OneAtm};
+    for (size_t n = 0; n < T.size(); n++) {
+        gas->setState_TPX(T[n], P[n], "H2:0.6, O2:0.3, H2O:0.1, H:0.01, O:0.005, "
+                          "OH:0.02, HO2:1e-4, H2O2:1e-5, AR:0.1, N2:0.2");
+        compare(1e-12);
+    }
+}
+
+TEST_F(GeneratedKineticsTest, multipliers)
+{
+    setup("h2o2.yaml", "ohmech");
+    gas->setState_TPX(1500, OneAtm, "H2:0.6, O2:0.3, H:0.01, OH:0.02, AR:0.1");
+    for (size_t i = 0; i < nr; i += 3) {
+        kin->setMultiplier(i, 0.5 * i);
+        kin_ref->setMultiplier(i, 0.5 * i);
+    }
+    compare(1e-12);
+}
+
+TEST_F(GeneratedKineticsTest, modified_reaction)
+{
+    setup("h2o2.yaml", "ohmech");
+    gas->setState_TPX(1500, OneAtm, "H2:0.6, O2:0.3, H:0.01, OH:0.02, AR:0.1");
+    EXPECT_EQ(kin->reactionString(2), "H2 + O <=> H + OH");
+    AnyMap rxn = AnyMap::fromYamlString(
+        "{equation: O + H2 <=> H + OH, rate-constant: [5.0e+04, 2.7, 6260.0]}");
+    kin->modifyReaction(2, newReaction(rxn, *kin));
+    kin_ref->modifyReaction(2, newReaction(rxn, *kin_ref));
+    EXPECT_FALSE(dynamic_cast<GeneratedKinetics&>(*kin).usesGeneratedCode());
+    compare(1e-12);
+}
+
+TEST_F(GeneratedKineticsTest, unsupported_features)
+{
+    setup("h2o2.yaml", "ohmech");
+    gas->setState_TPX(1500, OneAtm, "H2:0.6, O2:0.3, H:0.01, OH:0.02, AR:0.1");
+    auto& gk = dynamic_cast<GeneratedKinetics&>(*kin);
+    auto& ref = dynamic_cast<GasKinetics&>(*kin_ref);
+
+    // QSS species are handled by the generic implementation
+    gk.setQssSpecies({"HO2"});
+    ref.setQssSpecies({"HO2"});
+    EXPECT_FALSE(gk.usesGeneratedCode());
+    compare(1e-12);
+    EXPECT_EQ(gk.nQssGroups(), 1u);
+    gk.setQssSpecies({});
+    ref.setQssSpecies({});
+    EXPECT_TRUE(gk.usesGeneratedCode());
+
+    // Dynamic adaptive chemistry is handled by the generic implementation
+    gk.enableAdaptiveChemistry({"H2", "O2"}, 1e-3);
+    ref.enableAdaptiveChemistry({"H2", "O2"}, 1e-3);
+    EXPECT_FALSE(gk.usesGeneratedCode());
+    compare(1e-12);
+    EXPECT_GE(gk.nAdaptiveRefreshes(), 1u);
+    gk.disableAdaptiveChemistry();
+    ref.disableAdaptiveChemistry();
+    EXPECT_TRUE(gk.usesGeneratedCode());
+}
+
+TEST_F(GeneratedKineticsTest, mechanism_mismatch)
+{
+    setup("gri30.yaml", "gri30");
+    gas->setState_TPX(1500, OneAtm, "CH4:1.0, O2:2.0, N2:7.52, H:0.01");
+    EXPECT_FALSE(dynamic_cast<GeneratedKinetics&>(*kin).usesGeneratedCode());
+    compare(1e-14);
+}
+
+TEST(GeneratedKinetics, generate)
+{
+    auto sol = newSolution("h2o2.yaml", "", "None");
+    std::stringstream ss;
+    writeGeneratedKinetics(*sol->kinetics(), "TestKinetics", "Test-Model", ss);
+    std::string code = ss.str();
+    EXPECT_NE(code.find("class TestKinetics : public GeneratedKinetics"),
+              std::string::npos);
+    EXPECT_NE(code.find("reg(\"test-model\""), std::string::npos);
+    EXPECT_NE(code.find(fmt::format("return {}ull;",
+        GeneratedKinetics::mechanismHash(*sol->kinetics()))), std::string::npos);
+
+    // Legacy reactions are not supported
+    auto legacy = newSolution("h2o2.yaml", "", "None");
+    AnyMap rxn = AnyMap::fromYamlString(
+        "{equation: O + H2 <=> H + OH, type: elementary-legacy,"
+        " rate-constant: [3.87e+04, 2.7, 6260.0]}");
+    legacy->kinetics()->addReaction(newReaction(rxn, *legacy->kinetics()));
+    EXPECT_THROW(writeGeneratedKinetics(*legacy->kinetics(), "A", "b", ss),
+                 NotImplementedError);
+}
+
+TEST(GeneratedKinetics, checkedInSource)
+{
+    // Regenerate h2o2Generated.cpp and compare it to the checked-in version,
+    // skipping the first line, which contains the Cantera version
+    auto sol = newSolution("h2o2.yaml", "", "None");
+    std::stringstream generated;
+    writeGeneratedKinetics(*sol->kinetics(), "H2O2GeneratedKinetics",
+                           "h2o2-generated", generated);
+    std::ifstream checkedIn("../kinetics/h2o2Generated.cpp");
+    ASSERT_TRUE(checkedIn.good());
+    std::string line, ref;
+    std::getline(generated, line);
+    std::getline(checkedIn, ref);
+    size_t n = 1;
+    while (std::getline(checkedIn, ref)) {
+        n++;
+        ASSERT_TRUE(std::getline(generated, line)) << "line " << n;
+        ASSERT_EQ(line, ref) << "line " << n;
+    }
+    EXPECT_FALSE(std::getline(generated, line)) << "line " << n + 1;
+}
@@ -0,0 +1,103 @@
+#include "gtest/gtest.h"
+#include "cantera/kinetics/ReactionPath.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/base/Solution.h"
+#include <sstream>
+
+namespace Cantera
+{
+
+class ReactionPathAccumulatorTest : public testing::Test
+{
+public:
+    ReactionPathAccumulatorTest() {
+        soln = newSolution("gri30.yaml", "gri30", "None");
+    }
+
+    void setState(double T) {
+        soln->thermo()->setState_TPX(T, OneAtm,
+            "CH4:1, O2:2, N2:7.52, H:0.01, O:0.01, OH:0.01, CO:0.1, H2O:0.1");
+    }
+
+    //! One-way fluxes of `element` for the current state
+    Eigen::MatrixXd snapshotFluxes(const std::string& element) {
+        ReactionPathBuilder builder;
+        ReactionPathDiagram diagram;
+        std::stringstream log;
+        builder.init(log, *soln->kinetics());
+        builder.build(*soln->kinetics(), element, log, diagram, true);
+        size_t nsp = soln->thermo()->nSpecies();
+        Eigen::MatrixXd flux = Eigen::MatrixXd::Zero(nsp, nsp);
+        for (size_t n = 0; n < diagram.nPaths(); n++) {
+            Path* path = diagram.path(n);
+            flux(path->begin()->number, path->end()->number) = path->flow();
+        }
+        return flux;
+    }
+
+protected:
+    shared_ptr<Solution> soln;
+};
+
+TEST_F(ReactionPathAccumulatorTest, weightedSamples)
+{
+    ReactionPathAccumulator acc(*soln->kinetics());
+    setState(1200);
+    Eigen::MatrixXd F1 = snapshotFluxes("C");
+    acc.addSample(0.25);
+    setState(1800);
+    Eigen::MatrixXd F2 = snapshotFluxes("C");
+    acc.addSample(0.75);
+    EXPECT_DOUBLE_EQ(acc.totalWeight(), 1.0);
+
+    Eigen::MatrixXd expected = 0.25 * F1 + 0.75 * F2;
+    Eigen::MatrixXd flux = acc.fluxMatrix("C");
+    ASSERT_GT(expected.norm(), 0.0);
+    EXPECT_NEAR((flux - expected).norm(), 0.0, 1e-12 * expected.norm());
+    EXPECT_NEAR(flux(soln->thermo()->speciesIndex("CH4"),
+                     soln->thermo()->speciesIndex("CH3")),
+                expected(soln->thermo()->speciesIndex("CH4"),
+                         soln->thermo()->speciesIndex("CH3")),
+                1e-12 * expected.norm());
+
+    ReactionPathDiagram diagram;
+    std::stringstream log;
+    EXPECT_EQ(acc.build("C", log, diagram), 1);
+    EXPECT_GT(diagram.nPaths(), 0u);
+    EXPECT_NEAR(diagram.maxFlow(), expected.maxCoeff(), 1e-12 * expected.norm());
+    EXPECT_THROW(acc.fluxMatrix("Xx"), CanteraError);
+
+    acc.clear();
+    EXPECT_EQ(acc.totalWeight(), 0.0);
+    EXPECT_EQ(acc.fluxMatrix("C").nonZeros(), 0);
+}
+
+TEST_F(ReactionPathAccumulatorTest, trapezoidalIntervals)
+{
+    ReactionPathAccumulator acc(*soln->kinetics());
+    setState(1200);
+    Eigen::MatrixXd F1 = snapshotFluxes("C");
+    acc.startIntegration();
+    setState(1500);
+    Eigen::MatrixXd F2 = snapshotFluxes("C");
+    acc.addInterval(0.5);
+    setState(1800);
+    Eigen::MatrixXd F3 = snapshotFluxes("C");
+    acc.addInterval(0.25);
+    EXPECT_DOUBLE_EQ(acc.totalWeight(), 0.75);
+
+    Eigen::MatrixXd expected = 0.25 * (F1 + F2) + 0.125 * (F2 + F3);
+    Eigen::MatrixXd flux = acc.fluxMatrix("C");
+    ASSERT_GT(expected.norm(), 0.0);
+    EXPECT_NEAR((flux - expected).norm(), 0.0, 1e-12 * expected.norm());
+
+    // The state of another phase with the same species is copied
+    auto other = newSolution("gri30.yaml", "gri30", "None");
+    other->thermo()->setState_TPX(1500, OneAtm, "CH4:1, O2:2, N2:7.52");
+    acc.syncState(*other->thermo());
+    EXPECT_DOUBLE_EQ(soln->thermo()->temperature(), 1500);
+    auto h2o2 = newSolution("h2o2.yaml", "", "None");
+    EXPECT_THROW(acc.syncState(*h2o2->thermo()), CanteraError);
+}
+
+}
@@ -0,0 +1,174 @@
+#include "gtest/gtest.h"
+#include "cantera/kinetics/DirectedRelationGraph.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/kinetics/Reaction.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/base/Solution.h"
+#include "cantera/base/stringUtils.h"
+
+namespace Cantera
+{
+
+class DirectedRelationGraphTest : public testing::TestWithParam<std::string>
+{
+public:
+    static void SetUpTestCase() {
+        soln_ = newSolution("gri30.yaml", "gri30", "None");
+    }
+
+    static void TearDownTestCase() {
+        soln_.reset();
+    }
+
+    //! Set the state of `soln` to a partially burned methane/air mixture,
+    //! omitting species that are not part of `soln`
+    static void setState(shared_ptr<Solution> soln, double T) {
+        compositionMap X = parseCompString(
+            "CH4:1, O2:2, N2:7.52, H:0.01, O:0.01, OH:0.01, CH3:0.001, "
+            "HO2:0.001, CO:0.1, H2O:0.1");
+        compositionMap Xr;
+        for (const auto& item : X) {
+            if (soln->thermo()->speciesIndex(item.first) != npos) {
+                Xr[item.first] = item.second;
+            }
+        }
+        soln->thermo()->setState_TPX(T, OneAtm, Xr);
+    }
+
+    void sample(DirectedRelationGraph& drg) {
+        drg.setTargets({"CH4", "O2"});
+        drg.setRetainedSpecies({"N2"});
+        for (double T : {1200.0, 1600.0, 2000.0}) {
+            setState(soln_, T);
+            drg.addSample();
+        }
+    }
+
+protected:
+    static shared_ptr<Solution> soln_;
+};
+
+shared_ptr<Solution> DirectedRelationGraphTest::soln_;
+
+TEST_P(DirectedRelationGraphTest, importance)
+{
+    DirectedRelationGraph drg(soln_, GetParam());
+    sample(drg);
+    EXPECT_EQ(drg.nSamples(), 3u);
+    auto thermo = soln_->thermo();
+    const auto& R = drg.importance();
+    ASSERT_EQ(R.size(), thermo->nSpecies());
+    EXPECT_DOUBLE_EQ(R[thermo->speciesIndex("CH4")], 1.0);
+    EXPECT_DOUBLE_EQ(R[thermo->speciesIndex("O2")], 1.0);
+    for (double r : R) {
+        EXPECT_GE(r, 0.0);
+        EXPECT_LE(r, 1.0);
+    }
+    // Methyl is strongly coupled to methane, while argon only participates as
+    // explicit collision partner and is absent from the sampled mixtures
+    EXPECT_GT(R[thermo->speciesIndex("CH3")], 0.1);
+    EXPECT_EQ(R[thermo->speciesIndex("AR")], 0.0);
+
+    EXPECT_EQ(drg.retainedSpecies(0.0).size(), thermo->nSpecies());
+    auto names = drg.retainedSpecies(1.1);
+    ASSERT_EQ(names.size(), 3u);
+    EXPECT_EQ(names[0], "O2");
+    EXPECT_EQ(names[1], "CH4");
+    EXPECT_EQ(names[2], "N2");
+
+    drg.clearSamples();
+    EXPECT_EQ(drg.nSamples(), 0u);
+    EXPECT_EQ(drg.importance()[thermo->speciesIndex("CH3")], 0.0);
+}
+
+TEST_P(DirectedRelationGraphTest, reducedSolution)
+{
+    DirectedRelationGraph drg(soln_, GetParam());
+    sample(drg);
+    auto reduced = drg.reducedSolution(0.05);
+    auto names = drg.retainedSpecies(0.05);
+    auto thermo = reduced->thermo();
+    auto kin = reduced->kinetics();
+    ASSERT_EQ(thermo->nSpecies(), names.size());
+    EXPECT_LT(thermo->nSpecies(), soln_->thermo()->nSpecies());
+    EXPECT_GT(kin->nReactions(), 0u);
+    for (size_t k = 0; k < names.size(); k++) {
+        EXPECT_EQ(thermo->speciesName(k), names[k]);
+    }
+
+    // All reactions of the detailed mechanism involving only retained species
+    // are retained, except for those with an explicit collider that is removed
+    auto full = soln_->kinetics();
+    size_t nRetained = 0;
+    for (size_t i = 0; i < full->nReactions(); i++) {
+        auto rxn = full->reaction(i);
+        bool retained = true;
+        for (const auto& sp : rxn->reactants) {
+            retained &= (thermo->speciesIndex(sp.first) != npos);
+        }
+        for (const auto& sp : rxn->products) {
+            retained &= (thermo->speciesIndex(sp.first) != npos);
+        }
+        nRetained += retained;
+    }
+    EXPECT_LE(kin->nReactions(), nRetained);
+    EXPECT_GE(kin->nReactions() + 5, nRetained);
+
+    // Rates of retained reactions are unchanged
+    setState(soln_, 1600.0);
+    setState(reduced, 1600.0);
+    vector_fp kf_full(full->nReactions()), kf(kin->nReactions());
+    full->getFwdRateConstants(kf_full.data());
+    kin->getFwdRateConstants(kf.data());
+    size_t j = 0;
+    for (size_t i = 0; i < full->nReactions() && j < kin->nReactions(); i++) {
+        if (full->reactionString(i) != kin->reactionString(j)) {
+            continue;
+        }
+        if (kin->reaction(j)->type() == "elementary") {
+            EXPECT_NEAR(kf[j], kf_full[i], 1e-12 * kf_full[i])
+                << kin->reactionString(j);
+        }
+        j++;
+    }
+    EXPECT_EQ(j, kin->nReactions());
+}
+
+TEST_P(DirectedRelationGraphTest, findThreshold)
+{
+    DirectedRelationGraph drg(soln_, GetParam());
+    EXPECT_THROW(drg.findThreshold(), CanteraError);
+    sample(drg);
+    // Net production rate of methane for a partially burned mixture
+    auto metric = [](shared_ptr<Solution> soln) {
+        setState(soln, 1600.0);
+        vector_fp wdot(soln->thermo()->nSpecies());
+        soln->kinetics()->getNetProductionRates(wdot.data());
+        return wdot[soln->thermo()->speciesIndex("CH4")];
+    };
+    drg.addErrorTarget(metric, 0.02);
+    double threshold = drg.findThreshold();
+    EXPECT_GT(threshold, 0.0);
+    auto reduced = drg.reducedSolution(threshold);
+    EXPECT_LT(reduced->thermo()->nSpecies(), soln_->thermo()->nSpecies());
+    double ref = metric(soln_);
+    EXPECT_NEAR(metric(reduced), ref, 0.02 * std::abs(ref));
+}
+
+INSTANTIATE_TEST_CASE_P(Methods, DirectedRelationGraphTest,
+                        testing::Values("DRG", "DRGEP"));
+
+TEST(DirectedRelationGraph, invalidInput)
+{
+    auto soln = newSolution("h2o2.yaml", "", "None");
+    EXPECT_THROW(DirectedRelationGraph(soln, "DRGX"), CanteraError);
+    DirectedRelationGraph drg(soln);
+    EXPECT_EQ(drg.method(), "DRGEP");
+    EXPECT_THROW(drg.addSample(), CanteraError);
+    EXPECT_THROW(drg.setTargets({"CH4"}), CanteraError);
+    drg.setTargets({"H2"});
+    auto other = newSolution("gri30.yaml", "gri30", "None");
+    EXPECT_THROW(drg.addSample(*other->thermo()), CanteraError);
+}
+
+}
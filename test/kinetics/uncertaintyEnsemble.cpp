@@ -0,0 +1,177 @@
+#include "gtest/gtest.h"
+#include "cantera/kinetics/UncertaintyEnsemble.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/base/Solution.h"
+#include <fstream>
+
+namespace Cantera
+{
+
+//! Outputs two forward rate constants and the temperature, and fails if the
+//! multiplier of the first reaction exceeds `maxMultiplier`
+class RateConstantCase : public EnsembleCase
+{
+public:
+    explicit RateConstantCase(double maxMultiplier)
+        : m_maxMultiplier(maxMultiplier) {}
+
+    std::vector<std::string> outputNames() const {
+        return {"kf0", "kf2", "T"};
+    }
+
+    void setup(shared_ptr<Solution> sol) {
+        m_sol = sol;
+        m_kf.resize(sol->kinetics()->nReactions());
+    }
+
+    void run(double* outputs) {
+        if (m_sol->kinetics()->multiplier(0) > m_maxMultiplier) {
+            throw CanteraError("RateConstantCase::run", "Multiplier too large");
+        }
+        m_sol->kinetics()->getFwdRateConstants(m_kf.data());
+        outputs[0] = m_kf[0];
+        outputs[1] = m_kf[2];
+        outputs[2] = m_sol->thermo()->temperature();
+        // the state is reset before the next sample
+        m_sol->thermo()->setState_TP(300.0, OneAtm);
+    }
+
+protected:
+    shared_ptr<Solution> m_sol;
+    vector_fp m_kf;
+    double m_maxMultiplier;
+};
+
+class UncertaintyEnsembleTest : public testing::Test
+{
+public:
+    UncertaintyEnsembleTest() : m_nCases(0) {
+        m_gas = newSolution("h2o2.yaml", "", "None");
+        m_gas->thermo()->setState_TPX(1200.0, OneAtm, "H2:2.0, O2:1.0");
+        m_gas->kinetics()->setMultiplier(2, 0.5);
+    }
+
+    std::unique_ptr<UncertaintyEnsemble> newEnsemble(double maxMultiplier) {
+        auto newCase = [this, maxMultiplier]() {
+            m_nCases++;
+            return std::unique_ptr<EnsembleCase>(
+                new RateConstantCase(maxMultiplier));
+        };
+        return std::unique_ptr<UncertaintyEnsemble>(
+            new UncertaintyEnsemble(m_gas, newCase));
+    }
+
+protected:
+    shared_ptr<Solution> m_gas;
+    size_t m_nCases;
+};
+
+TEST_F(UncertaintyEnsembleTest, sampleAndRun)
+{
+    auto ens = newEnsemble(1e300);
+    size_t nr = m_gas->kinetics()->nReactions();
+    ens->setUncertaintyFactors(vector_fp(nr, 3.0));
+    ens->setThreads(3);
+    ens->setOutputFile("generated-ensemble.csv", true);
+    vector_fp kf(nr);
+    m_gas->kinetics()->getFwdRateConstants(kf.data());
+
+    size_t nSamples = 20;
+    ens->run(nSamples);
+    EXPECT_EQ(ens->nWorkers(), 3u);
+    EXPECT_EQ(m_nCases, 3u);
+    EXPECT_EQ(ens->nFailed(), 0u);
+    const Array2D& results = ens->results();
+    ASSERT_EQ(results.nRows(), nSamples);
+    ASSERT_EQ(results.nColumns(), 3u);
+    vector_fp mult(nr);
+    for (size_t n = 0; n < nSamples; n++) {
+        ens->sampleMultipliers(n, mult.data());
+        for (size_t i = 0; i < nr; i++) {
+            EXPECT_GE(mult[i], 1.0 / 3.0);
+            EXPECT_LE(mult[i], 3.0);
+        }
+        EXPECT_NEAR(results(n, 0), kf[0] * mult[0], 1e-12 * kf[0]);
+        EXPECT_NEAR(results(n, 1), kf[2] * mult[2], 1e-12 * kf[2]);
+        EXPECT_DOUBLE_EQ(results(n, 2), 1200.0);
+    }
+    EXPECT_NE(results(0, 0), results(1, 0));
+
+    // The original Solution is not modified
+    EXPECT_DOUBLE_EQ(m_gas->kinetics()->multiplier(0), 1.0);
+    EXPECT_DOUBLE_EQ(m_gas->kinetics()->multiplier(2), 0.5);
+    EXPECT_DOUBLE_EQ(m_gas->thermo()->temperature(), 1200.0);
+
+    std::ifstream file("generated-ensemble.csv");
+    std::string line;
+    std::getline(file, line);
+    EXPECT_EQ(line.substr(0, 30), "sample,kf0,kf2,T,multiplier-0,");
+    size_t nRows = 0;
+    std::vector<bool> found(nSamples, false);
+    while (std::getline(file, line)) {
+        size_t n = std::stoul(line.substr(0, line.find(',')));
+        ASSERT_LT(n, nSamples);
+        found[n] = true;
+        nRows++;
+    }
+    EXPECT_EQ(nRows, nSamples);
+    EXPECT_EQ(std::count(found.begin(), found.end(), true), (int) nSamples);
+
+    // Results do not depend on the number of threads, and workers are reused
+    // unless the number of threads changes
+    Array2D results3 = results;
+    ens->setOutputFile("");
+    ens->run(nSamples);
+    EXPECT_EQ(m_nCases, 3u);
+    ens->setThreads(1);
+    ens->run(nSamples);
+    EXPECT_EQ(m_nCases, 4u);
+    for (size_t n = 0; n < nSamples; n++) {
+        for (size_t j = 0; j < 3; j++) {
+            EXPECT_EQ(results(n, j), results3(n, j));
+        }
+    }
+}
+
+TEST_F(UncertaintyEnsembleTest, failedSamples)
+{
+    auto ens = newEnsemble(1.0);
+    size_t nr = m_gas->kinetics()->nReactions();
+    ens->setUncertaintyFactor(0, 2.0);
+    ens->setDistribution("log-normal", 3.0);
+    ens->setSeed(42);
+    ens->setThreads(2);
+    size_t nSamples = 30;
+    ens->run(nSamples);
+
+    vector_fp mult(nr);
+    size_t nFailed = 0;
+    for (size_t n = 0; n < nSamples; n++) {
+        ens->sampleMultipliers(n, mult.data());
+        for (size_t i = 1; i < nr; i++) {
+            EXPECT_EQ(mult[i], 1.0);
+        }
+        if (mult[0] > 1.0) {
+            nFailed++;
+            EXPECT_TRUE(std::isnan(ens->results()(n, 0)));
+        } else {
+            EXPECT_FALSE(std::isnan(ens->results()(n, 0)));
+        }
+    }
+    EXPECT_GT(nFailed, 0u);
+    EXPECT_LT(nFailed, nSamples);
+    EXPECT_EQ(ens->nFailed(), nFailed);
+}
+
+TEST_F(UncertaintyEnsembleTest, invalidInput)
+{
+    auto ens = newEnsemble(1.0);
+    EXPECT_THROW(ens->setUncertaintyFactor(0, 0.5), CanteraError);
+    EXPECT_THROW(ens->setUncertaintyFactor(1000, 2.0), IndexError);
+    EXPECT_THROW(ens->setUncertaintyFactors({2.0, 2.0}), CanteraError);
+    EXPECT_THROW(ens->setDistribution("uniform"), CanteraError);
+    EXPECT_THROW(ens->setDistribution("log-normal", 0.0), CanteraError);
+}
+
+}
@@ -4,6 +4,10 @@
 #include "cantera/thermo.h"
 #include "cantera/kinetics.h"
 #include "cantera/zerodim.h"
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/numerics/AdaptivePreconditioner.h"
+#include "cantera/kinetics/ReactionPath.h"
+#include "cantera/zeroD/ReactorSampling.h"
 
 using namespace Cantera;
 
@@ -50,6 +54,276 @@ TEST(ZeroDim, test_individual_reactor_initialization)
     }
 }
 
+TEST(AdaptivePreconditionerTests, test_solve)
+{
+    // a diagonally dominant matrix is factorized exactly by ILUT
+    size_t n = 5;
+    AdaptivePreconditioner precon;
+    precon.initialize(n);
+    precon.setGamma(0.1);
+    for (size_t i = 0; i < n; i++) {
+        precon.setValue(i, i, -30.0 - i);
+        if (i > 0) {
+            precon.setValue(i, i - 1, 2.0);
+            precon.setValue(i - 1, i, 1.0);
+        }
+    }
+    precon.setup();
+    vector_fp rhs {1.0, 2.0, 3.0, 4.0, 5.0};
+    vector_fp x(n);
+    precon.solve(n, rhs.data(), x.data());
+    Eigen::VectorXd res = precon.matrix() * Eigen::Map<Eigen::VectorXd>(x.data(), n);
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_NEAR(res[i], rhs[i], 1e-12);
+    }
+    EXPECT_DOUBLE_EQ(precon.matrix().coeff(2, 2), 1.0 + 0.1 * 32.0);
+    EXPECT_DOUBLE_EQ(precon.matrix().coeff(2, 1), -0.2);
+}
+
+//! Preconditioner which counts how often it is formed and applied
+class CountingPreconditioner : public AdaptivePreconditioner
+{
+public:
+    void setup() override {
+        nSetup++;
+        AdaptivePreconditioner::setup();
+    }
+
+    void solve(const size_t stateSize, double* rhs, double* output) override {
+        nSolve++;
+        AdaptivePreconditioner::solve(stateSize, rhs, output);
+    }
+
+    int nSetup = 0;
+    int nSolve = 0;
+};
+
+// Integration with the preconditioned GMRES solver should give the same result
+// as the default dense direct solver
+TEST(ZeroDim, test_preconditioned_integration)
+{
+    double T0 = 1100.0;
+    double P0 = 10 * OneAtm;
+    std::string X0 = "H2:1.0, O2:0.5, AR:8.0";
+    for (std::string model : {"IdealGasReactor", "IdealGasConstPressureReactor"}) {
+        for (int energy = 0; energy < 2; energy++) {
+            std::shared_ptr<Solution> sol1 = newSolution("h2o2.yaml");
+            sol1->thermo()->setState_TPX(T0, P0, X0);
+            std::unique_ptr<ReactorBase> base1(newReactor(model));
+            Reactor& reactor1 = dynamic_cast<Reactor&>(*base1);
+            reactor1.insert(sol1);
+            reactor1.setEnergy(energy);
+            ReactorNet network1;
+            network1.addReactor(reactor1);
+            auto precon = std::make_shared<CountingPreconditioner>();
+            network1.setPreconditioner(precon);
+            network1.advance(0.1);
+
+            std::shared_ptr<Solution> sol2 = newSolution("h2o2.yaml");
+            sol2->thermo()->setState_TPX(T0, P0, X0);
+            std::unique_ptr<ReactorBase> base2(newReactor(model));
+            Reactor& reactor2 = dynamic_cast<Reactor&>(*base2);
+            reactor2.insert(sol2);
+            reactor2.setEnergy(energy);
+            ReactorNet network2;
+            network2.addReactor(reactor2);
+            network2.advance(0.1);
+
+            // the preconditioner was formed and applied by CVODES
+            EXPECT_GT(precon->nSetup, 0) << model << ", " << energy;
+            EXPECT_GT(precon->nSolve, precon->nSetup) << model << ", " << energy;
+
+            EXPECT_NEAR(sol1->thermo()->temperature(),
+                        sol2->thermo()->temperature(), 1e-3);
+            vector_fp Y1(sol1->thermo()->nSpecies());
+            vector_fp Y2(sol2->thermo()->nSpecies());
+            sol1->thermo()->getMassFractions(Y1.data());
+            sol2->thermo()->getMassFractions(Y2.data());
+            for (size_t k = 0; k < Y1.size(); k++) {
+                EXPECT_NEAR(Y1[k], Y2[k], 1e-6) << model << ", " << energy;
+            }
+        }
+    }
+}
+
+// Compare the approximate Jacobian used for preconditioning with a finite
+// difference Jacobian of the governing equations
+TEST(ZeroDim, test_reactor_jacobian_elements)
+{
+    for (std::string model : {"IdealGasReactor", "IdealGasConstPressureReactor"}) {
+        std::shared_ptr<Solution> sol = newSolution("h2o2.yaml");
+        sol->thermo()->setState_TPX(1100.0, 10 * OneAtm,
+            "H2:1.0, O2:0.5, H2O:0.2, H:0.01, O:0.005, OH:0.02, HO2:0.001, "
+            "H2O2:0.0005, AR:8.0");
+        std::unique_ptr<ReactorBase> base(newReactor(model));
+        Reactor& reactor = dynamic_cast<Reactor&>(*base);
+        reactor.insert(sol);
+        ReactorNet network;
+        network.addReactor(reactor);
+        network.initialize();
+
+        size_t nv = network.neq();
+        size_t iT = reactor.componentIndex("temperature");
+        vector_fp y(nv), ydot0(nv), ydot1(nv);
+        network.getState(y.data());
+        network.eval(0.0, y.data(), ydot0.data(), nullptr);
+        SparseTriplets trips;
+        reactor.getJacobianElements(trips);
+        Eigen::SparseMatrix<double> jac(nv, nv);
+        jac.setFromTriplets(trips.begin(), trips.end());
+
+        // The constant pressure reactor neglects the dependence of the density
+        // on composition, such that only the temperature column is exact
+        size_t jmax = (model == "IdealGasReactor") ? nv : iT + 1;
+        Eigen::MatrixXd fd = Eigen::MatrixXd::Zero(nv, nv);
+        for (size_t j = iT; j < jmax; j++) {
+            vector_fp yp = y;
+            double dy = 1e-7 * std::abs(y[j]) + 1e-9;
+            yp[j] += dy;
+            network.eval(0.0, yp.data(), ydot1.data(), nullptr);
+            for (size_t i = iT; i < nv; i++) {
+                fd(i, j) = (ydot1[i] - ydot0[i]) / dy;
+            }
+        }
+        for (size_t i = iT; i < nv; i++) {
+            double scale = fd.row(i).cwiseAbs().maxCoeff();
+            for (size_t j = iT; j < jmax; j++) {
+                EXPECT_NEAR(jac.coeff(i, j), fd(i, j),
+                            1e-4 * std::abs(fd(i, j)) + 1e-8 * scale)
+                    << model << ": " << reactor.componentName(i) << ", "
+                    << reactor.componentName(j);
+            }
+        }
+    }
+}
+
+// Set up and apply the preconditioner as done by the CVODES callbacks
+TEST(ZeroDim, test_reactor_net_preconditioner)
+{
+    std::shared_ptr<Solution> sol = newSolution("h2o2.yaml");
+    sol->thermo()->setState_TPX(1100.0, 10 * OneAtm,
+                                "H2:1.0, O2:0.5, H:0.01, OH:0.02, AR:8.0");
+    IdealGasReactor reactor;
+    reactor.insert(sol);
+    ReactorNet network;
+    network.addReactor(reactor);
+    auto precon = std::make_shared<AdaptivePreconditioner>();
+    network.setPreconditioner(precon);
+    network.initialize();
+
+    size_t nv = network.neq();
+    vector_fp y(nv), rhs(nv), x(nv);
+    network.getState(y.data());
+    for (size_t i = 0; i < nv; i++) {
+        rhs[i] = 1.0 + 0.1 * i;
+    }
+    SparseTriplets trips;
+    reactor.getJacobianElements(trips);
+    Eigen::SparseMatrix<double> jac(nv, nv);
+    jac.setFromTriplets(trips.begin(), trips.end());
+
+    // The preconditioner matrix is I - gamma*J, using the Jacobian elements of
+    // the reactor. As the incomplete factorization truncates the dense row of
+    // the energy equation, the solution of the linear system is compared to
+    // the one obtained from the preconditioner directly.
+    auto check = [&](double gamma) {
+        EXPECT_DOUBLE_EQ(precon->gamma(), gamma);
+        Eigen::SparseMatrix<double> M = precon->matrix();
+        for (size_t i = 0; i < nv; i++) {
+            for (size_t j = 0; j < nv; j++) {
+                double expected = (i == j) - gamma * jac.coeff(i, j);
+                EXPECT_NEAR(M.coeff(i, j), expected, 1e-12 * std::abs(expected))
+                    << gamma << ", " << i << ", " << j;
+            }
+        }
+        vector_fp xref(nv);
+        precon->solve(nv, rhs.data(), xref.data());
+        network.preconditionerSolve(rhs.data(), x.data());
+        for (size_t i = 0; i < nv; i++) {
+            EXPECT_DOUBLE_EQ(x[i], xref[i]) << gamma << ", " << i;
+        }
+    };
+    network.preconditionerSetup(0.0, y.data(), 1e-8);
+    check(1e-8);
+    // Only gamma changes when CVODES reuses the Jacobian
+    network.updatePreconditioner(1e-6);
+    check(1e-6);
+}
+
+TEST(ZeroDim, test_preconditioner_unsupported_reactor)
+{
+    std::shared_ptr<Solution> sol = newSolution("h2o2.yaml");
+    sol->thermo()->setState_TPX(1000.0, OneAtm, "H2:1.0, O2:0.5, AR:8.0");
+    Reactor reactor;
+    reactor.insert(sol);
+    ReactorNet network;
+    network.addReactor(reactor);
+    network.setPreconditioner(std::make_shared<AdaptivePreconditioner>());
+    EXPECT_THROW(network.initialize(), CanteraError);
+}
+
+TEST(ZeroDim, test_qss_species_state)
+{
+    std::shared_ptr<Solution> sol = newSolution("gri30.yaml", "", "None");
+    auto& kin = dynamic_cast<GasKinetics&>(*sol->kinetics());
+    kin.setQssSpecies({"CH2", "CH2(S)"});
+    sol->thermo()->setState_TPX(1400.0, OneAtm,
+                                "CH4:1.0, O2:2.0, N2:7.52, H:0.01, OH:0.02");
+    size_t nsp = sol->thermo()->nSpecies();
+    IdealGasConstPressureReactor reactor;
+    reactor.insert(sol);
+    reactor.initialize();
+
+    // QSS species are excluded from the state vector
+    ASSERT_EQ(reactor.neq(), nsp);
+    EXPECT_EQ(reactor.componentIndex("CH2"), npos);
+    size_t iCH3 = reactor.componentIndex("CH3");
+    EXPECT_EQ(iCH3, sol->thermo()->speciesIndex("CH3"));
+    EXPECT_EQ(reactor.componentName(iCH3), "CH3");
+    size_t iCH4 = reactor.componentIndex("CH4");
+    EXPECT_EQ(reactor.componentName(iCH4), "CH4");
+    size_t iN2 = reactor.componentIndex("N2");
+    EXPECT_EQ(reactor.componentName(iN2), "N2");
+    EXPECT_EQ(iN2, sol->thermo()->speciesIndex("N2"));
+
+    vector_fp y(reactor.neq()), ydot(reactor.neq());
+    reactor.getState(y.data());
+    reactor.updateState(y.data());
+    EXPECT_EQ(sol->thermo()->massFraction("CH2"), 0.0);
+    EXPECT_DOUBLE_EQ(y[iCH4], sol->thermo()->massFraction("CH4"));
+    reactor.evalEqs(0.0, y.data(), ydot.data(), nullptr);
+
+    vector_fp wdot(nsp);
+    kin.getNetProductionRates(wdot.data());
+    size_t kCH4 = sol->thermo()->speciesIndex("CH4");
+    EXPECT_DOUBLE_EQ(ydot[iCH4], wdot[kCH4] * sol->thermo()->molecularWeight(kCH4)
+                                 / sol->thermo()->density());
+}
+
+TEST(ZeroDim, test_integrate_reaction_paths)
+{
+    auto sol = newSolution("gri30.yaml", "gri30", "None");
+    sol->thermo()->setState_TPX(1400.0, OneAtm,
+        "CH4:1, O2:2, N2:7.52, H:0.01, O:0.01, OH:0.01, CO:0.1, H2O:0.1");
+    IdealGasConstPressureReactor reactor;
+    reactor.insert(sol);
+    ReactorNet net;
+    net.addReactor(reactor);
+    ReactionPathAccumulator acc(*sol->kinetics());
+    double tEnd = 1e-4;
+    integrateReactor(acc, net, reactor, tEnd);
+    // The last step is truncated at the end time
+    EXPECT_EQ(net.time(), tEnd);
+    EXPECT_NEAR(acc.totalWeight(), tEnd, 1e-14 * tEnd);
+    Eigen::SparseMatrix<double> flux = acc.fluxMatrix("C");
+    EXPECT_GT(flux.nonZeros(), 0);
+    for (int k = 0; k < flux.outerSize(); k++) {
+        for (Eigen::SparseMatrix<double>::InnerIterator it(flux, k); it; ++it) {
+            EXPECT_GE(it.value(), 0.0);
+        }
+    }
+}
+
 int main(int argc, char** argv)
 {
     printf("Running main() from test_zeroD.cpp\n");